@@ -1,6 +1,7 @@
 #include "ADCSampler.h"
 #include "driver/i2s.h"
 #include "driver/adc.h"
+#include "SampleConversion.h"
 
 ADCSampler::ADCSampler(adc_unit_t adcUnit, adc1_channel_t adcChannel) : I2SSampler()
 {
@@ -22,8 +23,15 @@ void ADCSampler::configureI2S()
 void ADCSampler::processI2SData(uint8_t *i2sData, size_t bytesRead)
 {
     uint16_t *rawSamples = (uint16_t *)i2sData;
-    for (int i = 0; i < bytesRead / 2; i++)
+    size_t count = bytesRead / 2;
+    // convert the samples straight into the ring buffer - this takes two goes if the ring buffer wraps
+    while (count > 0)
     {
-        addSample((2048 - (rawSamples[i] & 0xfff)) * 15);
+        size_t length = count;
+        int16_t *dst = getWriteBuffer(length);
+        convertADCSamples(rawSamples, dst, length);
+        commitSamples(length);
+        rawSamples += length;
+        count -= length;
     }
 }
@@ -0,0 +1,172 @@
+#ifndef _capture_store_h_
+#define _capture_store_h_
+
+#include "RingBuffer.h"
+
+// how many samples the cold tier keeps - 5 seconds is enough to cover a slow connection and a 3 second command
+#ifndef AUDIO_COLD_CAPACITY
+#define AUDIO_COLD_CAPACITY 80000
+#endif
+
+/**
+ * The cold tier of the capture store - a much larger ring buffer in PSRAM that holds a copy of everything
+ * that goes through the hot ring buffer, with the same sequence numbers
+ **/
+typedef RingBuffer<int16_t, AUDIO_COLD_CAPACITY, PSRAMRingStorage> ColdRingBuffer;
+
+/**
+ * Copy the samples [from, to) from the hot tier into the cold tier - only the writer should call this
+ **/
+inline void copyToColdTier(AudioRingBuffer *hot, ColdRingBuffer *cold, uint64_t from, uint64_t to)
+{
+    int count = to - from;
+    cold->beginWrite(count);
+    RingBufferSpan spans[2];
+    int span_count = hot->getSpans(from, count, spans);
+    for (int i = 0; i < span_count; i++)
+    {
+        const int16_t *src = spans[i].samples;
+        int remaining = spans[i].length;
+        while (remaining > 0)
+        {
+            int length = remaining;
+            int16_t *dst = cold->getWritePointer(length);
+            memcpy(dst, src, length * sizeof(int16_t));
+            cold->commitWrite(length);
+            src += length;
+            remaining -= length;
+        }
+    }
+    cold->endWrite();
+}
+
+/**
+ * A reader of the capture store - samples are addressed by sequence number and come from the hot ring
+ * buffer if it still has them and from the cold tier if it doesn't. Works just like a RingBufferAccessor
+ * if there is no cold tier.
+ **/
+class CaptureReader
+{
+private:
+    AudioRingBuffer *m_hot;
+    ColdRingBuffer *m_cold;
+    uint64_t m_position;
+    uint64_t m_lost_samples;
+    // which tier the last call to getSpans used
+    bool m_spans_from_cold;
+
+    uint64_t getOldest(bool cold)
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return cold ? m_cold->getOldestSequence() : m_hot->getOldestSequence();
+    }
+
+public:
+    CaptureReader(AudioRingBuffer *hot, ColdRingBuffer *cold)
+    {
+        m_hot = hot;
+        m_cold = cold;
+        m_position = hot->getWriteSequence();
+        m_lost_samples = 0;
+        m_spans_from_cold = false;
+    }
+    uint64_t getPosition()
+    {
+        return m_position;
+    }
+    void setPosition(uint64_t position)
+    {
+        m_position = position;
+    }
+    // the sequence number of the next sample the writer will publish
+    uint64_t getWritePosition()
+    {
+        return m_hot->getWriteSequence();
+    }
+    // the number of samples that have been written but not read yet
+    int getAvailable()
+    {
+        uint64_t write_sequence = getWritePosition();
+        return write_sequence > m_position ? write_sequence - m_position : 0;
+    }
+    // total number of samples this reader has lost to the writer overwriting them
+    uint64_t getLostSamples()
+    {
+        return m_lost_samples;
+    }
+    /**
+     * Get up to count samples from start as contiguous spans from whichever tier still has them - the spans
+     * may cover fewer than count samples if they come from the cold tier and it hasn't caught up yet.
+     * Returns the number of spans.
+     **/
+    int getSpans(uint64_t start, int count, RingBufferSpan spans[2])
+    {
+        m_spans_from_cold = m_cold && start < getOldest(false);
+        if (!m_spans_from_cold)
+        {
+            return m_hot->getSpans(start, count, spans);
+        }
+        uint64_t cold_write_sequence = m_cold->getWriteSequence();
+        count = std::min<uint64_t>(count, cold_write_sequence > start ? cold_write_sequence - start : 0);
+        if (count == 0)
+        {
+            return 0;
+        }
+        return m_cold->getSpans(start, count, spans);
+    }
+    /**
+     * The number of samples from start onwards that have been overwritten in the tier the last call
+     * to getSpans used - call this after reading the spans to check they were valid.
+     **/
+    uint64_t getOverwritten(uint64_t start)
+    {
+        uint64_t oldest = getOldest(m_spans_from_cold);
+        return oldest > start ? oldest - start : 0;
+    }
+    /**
+     * If the reader has fallen behind everything the store holds move it forward to the oldest sample
+     * that can still be read. Returns the number of samples that were skipped.
+     **/
+    uint64_t skipOverwritten()
+    {
+        uint64_t oldest = getOldest(m_cold != NULL);
+        uint64_t lost = oldest > m_position ? oldest - m_position : 0;
+        m_position += lost;
+        m_lost_samples += lost;
+        return lost;
+    }
+    /**
+     * Copy up to count samples from the cursor and move the cursor on. Returns the number of samples
+     * read - if the reader had been overrun (or the writer got to some of the samples while they were
+     * being copied) then lost is set to the number of samples that were skipped.
+     **/
+    int read(int16_t *samples, int count, uint64_t *lost = NULL)
+    {
+        uint64_t lost_samples = skipOverwritten();
+        RingBufferSpan spans[2];
+        int span_count = getSpans(m_position, std::min(count, getAvailable()), spans);
+        count = 0;
+        for (int i = 0; i < span_count; i++)
+        {
+            memcpy(samples + count, spans[i].samples, spans[i].length * sizeof(int16_t));
+            count += spans[i].length;
+        }
+        // anything the writer got to while we were copying is not valid - drop it from the front
+        uint64_t torn = std::min((uint64_t)count, getOverwritten(m_position));
+        if (torn > 0)
+        {
+            memmove(samples, samples + torn, (count - torn) * sizeof(int16_t));
+            count -= torn;
+            lost_samples += torn;
+            m_lost_samples += torn;
+        }
+        m_position += count + torn;
+        if (lost)
+        {
+            *lost = lost_samples;
+        }
+        return count;
+    }
+};
+
+#endif
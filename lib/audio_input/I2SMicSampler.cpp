@@ -1,6 +1,7 @@
 #include "I2SMicSampler.h"
 #include "driver/i2s.h"
 #include "soc/i2s_reg.h"
+#include "SampleConversion.h"
 
 I2SMicSampler::I2SMicSampler(i2s_pin_config_t &i2sPins, bool fixSPH0645) : I2SSampler()
 {
@@ -23,8 +24,22 @@ void I2SMicSampler::configureI2S()
 void I2SMicSampler::processI2SData(uint8_t *i2sData, size_t bytesRead)
 {
     int32_t *samples = (int32_t *)i2sData;
-    for (int i = 0; i < bytesRead / 4; i++)
+    size_t count = bytesRead / 4;
+    // convert the samples straight into the ring buffer - this takes two goes if the ring buffer wraps
+    while (count > 0)
     {
-        addSample(samples[i] >> 11);
+        size_t length = count;
+        int16_t *dst = getWriteBuffer(length);
+        if (m_fixSPH0645)
+        {
+            convertSPH0645Samples(samples, dst, length, 11);
+        }
+        else
+        {
+            convertI2SSamples(samples, dst, length, 11);
+        }
+        commitSamples(length);
+        samples += length;
+        count -= length;
     }
 }
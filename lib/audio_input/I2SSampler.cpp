@@ -2,43 +2,142 @@
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "driver/i2s.h"
-#include "RingBuffer.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "I2SSampler.h"
+#include "FIRFilter.h"
 
-class I2SSampler
+I2SSampler::I2SSampler()
 {
-public:
-    I2SSampler();
-    void start(i2s_port_t i2s_port, i2s_config_t &i2s_config, TaskHandle_t processor_task_handle);
-
-private:
-    static void i2sReaderTask(void *param);
+    m_ring_buffer = new AudioRingBuffer();
+    // keep a longer history of the audio in PSRAM if we have room for it
+    m_cold_ring_buffer = NULL;
+    if (heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM) >= sizeof(int16_t) * ColdRingBuffer::CAPACITY)
+    {
+        m_cold_ring_buffer = new ColdRingBuffer();
+    }
+    if (m_cold_ring_buffer)
+    {
+        ESP_LOGI("I2S", "Cold tier enabled");
+    }
+    else
+    {
+        // without it only the hot ring buffer's lookback is kept - commands that take longer than that to connect lose their start
+        ESP_LOGW("I2S", "Cold tier disabled - not enough PSRAM, commands that are slow to connect will lose their start");
+    }
+    m_notification_interval = DEFAULT_NOTIFICATION_INTERVAL;
+    m_next_notification_sequence = DEFAULT_NOTIFICATION_INTERVAL;
+    m_last_publish_time.store(0);
+    m_filter = NULL;
+    m_filtered_samples = 0;
+    m_write_buffer = NULL;
+}
 
-    void processI2SData(uint8_t *i2sData, size_t bytesRead);
+void I2SSampler::addSample(int16_t sample)
+{
+    if (m_filter)
+    {
+        m_filter->processPart(&sample, 1);
+        m_filtered_samples++;
+    }
+    // store the sample - it won't be visible to readers until it is published
+    m_ring_buffer->writeSample(sample);
+}
 
-    RingBufferAccessor *getRingBufferReader();
+void I2SSampler::addSamples(const int16_t *samples, size_t count)
+{
+    while (count > 0)
+    {
+        size_t length = count;
+        int16_t *dst = getWriteBuffer(length);
+        memcpy(dst, samples, length * sizeof(int16_t));
+        commitSamples(length);
+        samples += length;
+        count -= length;
+    }
+}
 
-    i2s_port_t m_i2s_port;
-    TaskHandle_t m_processor_task_handle;
-    TaskHandle_t m_reader_task_handle;
-    xQueueHandle m_i2s_queue;
-    RingBufferAccessor *m_write_ring_buffer_accessor;
-    AudioBuffer *m_audio_buffers[AUDIO_BUFFER_COUNT];
+int16_t *I2SSampler::getWriteBuffer(size_t &count)
+{
+    int length = count;
+    int16_t *dst = m_ring_buffer->getWritePointer(length);
+    count = length;
+    m_write_buffer = dst;
+    return dst;
+}
 
-    void addSample(int16_t sample);
-};
+void I2SSampler::commitSamples(size_t count)
+{
+    // filter the block of samples the converter has just written in place - this is at most a DMA read's worth
+    if (m_filter)
+    {
+        m_filter->processPart(m_write_buffer, count);
+        m_filtered_samples += count;
+    }
+    // like addSample these are not visible to readers until they are published
+    m_ring_buffer->commitWrite(count);
+}
 
-void I2SSampler::addSample(int16_t sample)
+void I2SSampler::publishSamples()
 {
-    // store the sample
-    m_write_ring_buffer_accessor->setCurrentSample(sample);
-    if (m_write_ring_buffer_accessor->moveToNextSample())
+    uint64_t write_sequence = m_ring_buffer->endWrite();
+    // the filter's profiling counts a whole read's worth of samples as a block - reads that wrap round the end of the
+    // ring buffer are done in pieces
+    size_t samples_per_read = I2S_READ_SIZE / m_raw_sample_size;
+    if (m_filter && m_filtered_samples >= samples_per_read)
+    {
+        m_filter->endBlock();
+        m_filtered_samples -= samples_per_read;
+    }
+    m_last_publish_time.store(esp_timer_get_time(), std::memory_order_relaxed);
+    if (write_sequence >= m_next_notification_sequence)
     {
-        // trigger the processor task as we've filled a buffer
+        // move on to the next interval after the samples we've just published - if we've crossed several
+        // intervals in one go (or the processor task is still busy) we still only send one notification
+        while (m_next_notification_sequence <= write_sequence)
+        {
+            m_next_notification_sequence += m_notification_interval;
+        }
+        // trigger the processor task - notifications set the same bit so they don't pile up if it's running behind
         xTaskNotify(m_processor_task_handle, 1, eSetBits);
     }
+    // copy the new samples into the cold tier - this is done after waking up the processor task so it doesn't add any latency
+    if (m_cold_ring_buffer)
+    {
+        copyToColdTier(m_ring_buffer, m_cold_ring_buffer, m_cold_ring_buffer->getWriteSequence(), write_sequence);
+    }
 }
 
-void I2SSampler::i2sReaderTask(void *param)
+size_t I2SSampler::readI2SData()
+{
+    size_t bytesRead = 0;
+    // work out how many raw samples will fit before the ring buffer wraps - the raw samples can be bigger than the converted ones
+    size_t slots = I2S_READ_SIZE / sizeof(int16_t);
+    uint8_t *i2sData = (uint8_t *)getWriteBuffer(slots);
+    size_t bytesToRead = (slots * sizeof(int16_t) / m_raw_sample_size) * m_raw_sample_size;
+    if (bytesToRead > 0)
+    {
+        // let readers know which samples are about to be overwritten
+        m_ring_buffer->beginWrite(slots);
+        // read straight into the ring buffer and convert the samples in place
+        i2s_read(m_i2s_port, i2sData, bytesToRead, &bytesRead, 10);
+        processI2SData(i2sData, bytesRead);
+    }
+    else
+    {
+        // there's not enough room for a whole raw sample before the ring buffer wraps so read one sample via the stack
+        uint8_t rawSample[4];
+        i2s_read(m_i2s_port, rawSample, m_raw_sample_size, &bytesRead, 10);
+        m_ring_buffer->beginWrite(1);
+        processI2SData(rawSample, bytesRead);
+    }
+    // and make the new samples visible to readers
+    publishSamples();
+    return bytesRead;
+}
+
+void i2sReaderTask(void *param)
 {
     I2SSampler *sampler = (I2SSampler *)param;
     while (true)
@@ -52,12 +151,8 @@ void I2SSampler::i2sReaderTask(void *param)
                 size_t bytesRead = 0;
                 do
                 {
-                    // read data from the I2S peripheral
-                    uint8_t i2sData[1024];
-                    // read from i2s
-                    i2s_read(sampler->m_i2s_port, i2sData, 1024, &bytesRead, 10);
-                    // process the raw data
-                    sampler->processI2SData(i2sData, bytesRead);
+                    // read data from the I2S peripheral into the ring buffer
+                    bytesRead = sampler->readI2SData();
                 } while (bytesRead > 0);
             }
         }
@@ -69,18 +164,23 @@ void I2SSampler::start(i2s_port_t i2s_port, i2s_config_t &i2s_config, TaskHandle
     ESP_LOGI("I2S", "Starting i2s");
     m_i2s_port = i2s_port;
     m_processor_task_handle = processor_task_handle;
+    m_raw_sample_size = i2s_config.bits_per_sample / 8;
     // Install and start i2s driver
     i2s_driver_install(m_i2s_port, &i2s_config, 4, &m_i2s_queue);
     // Set up the I2S configuration from the subclass
-    // configureI2S();
-    // Start a task to read samples
-    xTaskCreate(i2sReaderTask, "i2s Reader Task", 4096, this, 1, &m_reader_task_handle);
+    configureI2S();
+    // Start a task to read samples - it reads straight into the ring buffer so it doesn't need much stack
+    xTaskCreate(i2sReaderTask, "i2s Reader Task", 2048, this, 1, &m_reader_task_handle);
 }
 
 RingBufferAccessor *I2SSampler::getRingBufferReader()
 {
-    RingBufferAccessor *reader = new RingBufferAccessor(m_audio_buffers, AUDIO_BUFFER_COUNT);
-    // place the reader at the same position as the writer - clients can move it around as required
-    reader->setIndex(m_write_ring_buffer_accessor->getIndex());
-    return reader;
+    // the reader starts at the same position as the writer - clients can move it around as required
+    return new RingBufferAccessor(m_ring_buffer);
+}
+
+CaptureReader *I2SSampler::getCaptureReader()
+{
+    // like getRingBufferReader this starts at the writer's position
+    return new CaptureReader(m_ring_buffer, m_cold_ring_buffer);
 }
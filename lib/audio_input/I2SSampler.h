@@ -6,8 +6,14 @@
 #include <algorithm>
 
 #include "RingBuffer.h"
+#include "CaptureStore.h"
 
-#define AUDIO_BUFFER_COUNT 11
+class FIRFilter;
+
+// by default wake up the processor task every 100ms of audio
+#define DEFAULT_NOTIFICATION_INTERVAL 1600
+// maximum number of bytes to read from the I2S peripheral in one go
+#define I2S_READ_SIZE 1024
 
 /**
  * Base Class for both the ADC and I2S sampler
@@ -15,11 +21,10 @@
 class I2SSampler
 {
 private:
-    // audio buffers
-    AudioBuffer *m_audio_buffers[AUDIO_BUFFER_COUNT];
-    RingBufferAccessor *m_write_ring_buffer_accessor;
-    // current audio buffer
-    int m_current_audio_buffer;
+    // audio samples
+    AudioRingBuffer *m_ring_buffer;
+    // a longer copy of the audio samples in PSRAM - NULL if there isn't enough PSRAM
+    ColdRingBuffer *m_cold_ring_buffer;
     // I2S reader task
     TaskHandle_t m_reader_task_handle;
     // processor task
@@ -28,10 +33,32 @@ private:
     QueueHandle_t m_i2s_queue;
     // i2s port
     i2s_port_t m_i2s_port;
+    // size of the samples we get from the I2S peripheral
+    size_t m_raw_sample_size;
+    // how often to wake up the processor task and the sequence number that will trigger the next wake up
+    int m_notification_interval;
+    uint64_t m_next_notification_sequence;
+    // when the last samples were published in microseconds
+    std::atomic<int64_t> m_last_publish_time;
+    // filters the samples as they go into the ring buffer - NULL if there isn't one
+    FIRFilter *m_filter;
+    // samples that have been filtered since the filter's profiling last counted a block
+    size_t m_filtered_samples;
+    // where the converters are writing samples to
+    int16_t *m_write_buffer;
+
+    size_t readI2SData();
+    void publishSamples();
 
 protected:
     void addSample(int16_t sample);
+    void addSamples(const int16_t *samples, size_t count);
+    // direct access to the ring buffer so converters can write samples in place - count is reduced
+    // to the number of samples that can be written before the ring buffer wraps
+    int16_t *getWriteBuffer(size_t &count);
+    void commitSamples(size_t count);
     virtual void configureI2S() = 0;
+    // convert the raw I2S data into samples - i2sData may point at the ring buffer's write buffer so this must be able to work in place
     virtual void processI2SData(uint8_t *i2sData, size_t bytesRead) = 0;
     i2s_port_t getI2SPort()
     {
@@ -43,14 +70,36 @@ public:
     void start(i2s_port_t i2s_port, i2s_config_t &i2s_config, TaskHandle_t processor_task_handle);
 
     RingBufferAccessor *getRingBufferReader();
+    // a reader that can go further back than the ring buffer if there is a cold tier
+    CaptureReader *getCaptureReader();
 
-    int getCurrentWritePosition()
+    // the sequence number of the next sample to be written - this is a count of all the samples captured so far
+    uint64_t getCurrentWritePosition()
+    {
+        return m_ring_buffer->getWriteSequence();
+    }
+    // the time in microseconds (from esp_timer_get_time) when the newest samples were published
+    int64_t getLastPublishTime()
+    {
+        return m_last_publish_time.load(std::memory_order_relaxed);
+    }
+    // wake the processor task every time this many samples have been captured
+    void setNotificationInterval(int samples)
+    {
+        m_notification_interval = samples;
+    }
+    // filter the samples before they go into the ring buffer - set this before calling start
+    void setFilter(FIRFilter *filter)
+    {
+        m_filter = filter;
+    }
+    FIRFilter *getFilter()
     {
-        return m_write_ring_buffer_accessor->getIndex();
+        return m_filter;
     }
     int getRingBufferSize()
     {
-        return AUDIO_BUFFER_COUNT * SAMPLE_BUFFER_SIZE;
+        return AudioRingBuffer::CAPACITY;
     }
 
     friend void i2sReaderTask(void *param);
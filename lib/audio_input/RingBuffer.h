@@ -1,81 +1,354 @@
 #ifndef _ring_buffer_h_
 #define _ring_buffer_h_
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <atomic>
+#include <algorithm>
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
 
-#define SAMPLE_BUFFER_SIZE 1600
+// how many samples of audio we keep - override this in the build flags to change the lookback.
+// A power of two lets the ring buffer use a mask instead of a division when it works out where a sample is.
+#ifndef AUDIO_RING_CAPACITY
+#define AUDIO_RING_CAPACITY 17600
+#endif
+// where the audio samples are stored - StaticRingStorage or PSRAMRingStorage
+#ifndef AUDIO_RING_STORAGE
+#define AUDIO_RING_STORAGE StaticRingStorage
+#endif
 
-class AudioBuffer
+/**
+ * A contiguous run of samples in the ring buffer
+ **/
+template <typename SampleT>
+struct SampleSpan
 {
+    const SampleT *samples;
+    int length;
+};
+
+/**
+ * Storage for the samples as part of the ring buffer object itself
+ **/
+template <typename SampleT, int Capacity>
+class StaticRingStorage
+{
+private:
+    SampleT m_samples[Capacity];
+
+public:
+    StaticRingStorage()
+    {
+        memset(m_samples, 0, sizeof(m_samples));
+    }
+    inline SampleT *data()
+    {
+        return m_samples;
+    }
+};
+
+/**
+ * Storage for the samples in PSRAM - falls back to the normal heap if there isn't any
+ **/
+template <typename SampleT, int Capacity>
+class PSRAMRingStorage
+{
+private:
+    SampleT *m_samples;
+
+    PSRAMRingStorage(const PSRAMRingStorage &);
+    PSRAMRingStorage &operator=(const PSRAMRingStorage &);
+
+public:
+    PSRAMRingStorage()
+    {
+        m_samples = NULL;
+#ifdef ESP_PLATFORM
+        m_samples = static_cast<SampleT *>(heap_caps_malloc(sizeof(SampleT) * Capacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+#endif
+        if (!m_samples)
+        {
+            m_samples = static_cast<SampleT *>(malloc(sizeof(SampleT) * Capacity));
+        }
+        memset(m_samples, 0, sizeof(SampleT) * Capacity);
+    }
+    ~PSRAMRingStorage()
+    {
+        free(m_samples);
+    }
+    inline SampleT *data()
+    {
+        return m_samples;
+    }
+};
+
+/**
+ * Single producer, multiple consumer ring buffer of samples.
+ *
+ * Samples are addressed by their sequence number - the number of samples written before them since
+ * the ring buffer was created. The writer publishes how far it has got with an atomic 64 bit write
+ * sequence, readers keep their own cursor (see RingBufferReader) and use the sequences to work out
+ * if the samples they are reading have been overwritten.
+ *
+ * The sample type, capacity and where the samples are stored are all fixed at compile time.
+ **/
+template <typename SampleT, int Capacity, template <typename, int> class Storage = StaticRingStorage>
+class RingBuffer
+{
+public:
+    typedef SampleT Sample;
+    typedef SampleSpan<SampleT> Span;
+    static const int CAPACITY = Capacity;
+    static const bool IS_POWER_OF_TWO = (Capacity & (Capacity - 1)) == 0;
+
+private:
+    Storage<SampleT, Capacity> m_storage;
+    SampleT *m_samples;
+    // the writer's position in m_samples and the sequence number of the next sample it will write
+    int m_write_index;
+    uint64_t m_pending_sequence;
+    // everything before this has been written and can be read
+    std::atomic<uint64_t> m_write_sequence;
+    // the end of the slots the writer has written anything to - a writer can scribble on more slots than it ends up
+    // committing (raw I2S samples are bigger than the converted ones) and those slots stay overwritten until they are
+    // written again
+    uint64_t m_dirty_sequence;
+    // everything before this may be being written to - samples older than this minus the size are not safe to read
+    std::atomic<uint64_t> m_overwrite_sequence;
+
+    RingBuffer(const RingBuffer &);
+    RingBuffer &operator=(const RingBuffer &);
+
+    // where a sample sequence number lives in m_samples - the compiler drops whichever branch isn't needed
+    static inline int indexOf(uint64_t sequence)
+    {
+        if (IS_POWER_OF_TWO)
+        {
+            return sequence & (uint64_t)(Capacity - 1);
+        }
+        return sequence % Capacity;
+    }
+    static inline int wrapIndex(int index)
+    {
+        if (IS_POWER_OF_TWO)
+        {
+            return index & (Capacity - 1);
+        }
+        return index == Capacity ? 0 : index;
+    }
+
 public:
-    int16_t samples[SAMPLE_BUFFER_SIZE];
-    AudioBuffer()
+    RingBuffer()
     {
-        memset(samples, 0, SAMPLE_BUFFER_SIZE * sizeof(int16_t));
+        static_assert(Capacity > 0, "The ring buffer capacity must be positive");
+        m_samples = m_storage.data();
+        m_write_index = 0;
+        m_pending_sequence = 0;
+        m_dirty_sequence = 0;
+        m_write_sequence.store(0);
+        m_overwrite_sequence.store(0);
+    }
+    int getSize()
+    {
+        return Capacity;
+    }
+    uint64_t getWriteSequence()
+    {
+        return m_write_sequence.load(std::memory_order_acquire);
+    }
+    // the oldest sample that is still safe to read
+    uint64_t getOldestSequence()
+    {
+        uint64_t overwrite_sequence = m_overwrite_sequence.load(std::memory_order_relaxed);
+        return overwrite_sequence > (uint64_t)Capacity ? overwrite_sequence - Capacity : 0;
+    }
+    /**
+     * Writer - call beginWrite with the maximum number of slots that are about to be written to,
+     * write the samples and then publish them with endWrite
+     **/
+    void beginWrite(int max_count)
+    {
+        m_dirty_sequence = std::max(m_dirty_sequence, m_pending_sequence + max_count);
+        m_overwrite_sequence.store(m_dirty_sequence, std::memory_order_relaxed);
+        // make sure readers see the new overwrite sequence before any of the samples change
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    inline void writeSample(SampleT sample)
+    {
+        m_samples[m_write_index] = sample;
+        m_write_index = wrapIndex(m_write_index + 1);
+        m_pending_sequence++;
+    }
+    /**
+     * Direct access to the storage for bulk writers - returns a pointer to where the next samples should go
+     * and reduces count to the number of contiguous slots before the ring buffer wraps. Call commitWrite
+     * once the samples have been written.
+     **/
+    inline SampleT *getWritePointer(int &count)
+    {
+        count = std::min(count, Capacity - m_write_index);
+        return m_samples + m_write_index;
+    }
+    inline void commitWrite(int count)
+    {
+        m_write_index = wrapIndex(m_write_index + count);
+        m_pending_sequence += count;
+    }
+    uint64_t endWrite()
+    {
+        // any slots past the samples that were written still hold whatever was scribbled on them
+        m_dirty_sequence = std::max(m_dirty_sequence, m_pending_sequence);
+        m_overwrite_sequence.store(m_dirty_sequence, std::memory_order_relaxed);
+        m_write_sequence.store(m_pending_sequence, std::memory_order_release);
+        return m_pending_sequence;
+    }
+    /**
+     * Get the samples in the range [start, start + count) as contiguous spans - a second span is
+     * needed if the range wraps around the end of the ring buffer. Returns the number of spans.
+     **/
+    int getSpans(uint64_t start, int count, Span spans[2])
+    {
+        int start_index = indexOf(start);
+        int first_length = std::min(count, Capacity - start_index);
+        spans[0].samples = m_samples + start_index;
+        spans[0].length = first_length;
+        if (first_length == count)
+        {
+            return 1;
+        }
+        spans[1].samples = m_samples;
+        spans[1].length = count - first_length;
+        return 2;
     }
 };
 
-class RingBufferAccessor
+/**
+ * A reader of a ring buffer with its own cursor
+ **/
+template <class RingBufferT>
+class RingBufferReader
 {
+public:
+    typedef typename RingBufferT::Sample Sample;
+    typedef typename RingBufferT::Span Span;
+
 private:
-    AudioBuffer **m_audio_buffers;
-    int m_number_audio_buffers;
-    AudioBuffer *m_current_buffer;
-    int m_buffer_pos;
-    int m_buffer_idx;
-    int m_total_size;
+    RingBufferT *m_ring_buffer;
+    uint64_t m_position;
+    uint64_t m_lost_samples;
 
 public:
-    RingBufferAccessor(AudioBuffer **audioBuffers, int number_audio_buffers)
+    RingBufferReader(RingBufferT *ring_buffer)
+    {
+        m_ring_buffer = ring_buffer;
+        m_position = ring_buffer->getWriteSequence();
+        m_lost_samples = 0;
+    }
+    uint64_t getPosition()
     {
-        m_buffer_pos = 0;
-        m_buffer_idx = 0;
-        m_total_size = number_audio_buffers * SAMPLE_BUFFER_SIZE;
-        m_audio_buffers = audioBuffers;
-        m_number_audio_buffers = number_audio_buffers;
-        m_current_buffer = audioBuffers[0];
+        return m_position;
     }
-    int getIndex()
+    void setPosition(uint64_t position)
     {
-        return m_buffer_idx * SAMPLE_BUFFER_SIZE + m_buffer_pos;
+        m_position = position;
     }
-    void setIndex(int index)
+    // the sequence number of the next sample the writer will publish
+    uint64_t getWritePosition()
     {
-        // handle negative indexes
-        index = (index + m_total_size) % m_total_size;
-        // work out which buffer
-        m_buffer_idx = (index / SAMPLE_BUFFER_SIZE) % m_number_audio_buffers;
-        // and where we are in the buffer
-        m_buffer_pos = index % SAMPLE_BUFFER_SIZE;
-        m_current_buffer = m_audio_buffers[m_buffer_idx];
+        return m_ring_buffer->getWriteSequence();
     }
-    inline int16_t getCurrentSample()
+    void rewind(int samples)
     {
-        return m_current_buffer->samples[m_buffer_pos];
+        m_position = m_position > (uint64_t)samples ? m_position - samples : 0;
     }
-    inline void setCurrentSample(int16_t sample)
+    // the number of samples that have been written but not read yet
+    int getAvailable()
     {
-        m_current_buffer->samples[m_buffer_pos] = sample;
+        uint64_t write_sequence = getWritePosition();
+        return write_sequence > m_position ? write_sequence - m_position : 0;
     }
-    inline void rewind(int samples) {
-        setIndex(getIndex() - samples);
+    // total number of samples this reader has lost to the writer overwriting them
+    uint64_t getLostSamples()
+    {
+        return m_lost_samples;
+    }
+    int getSpans(uint64_t start, int count, Span spans[2])
+    {
+        return m_ring_buffer->getSpans(start, count, spans);
     }
-    inline bool moveToNextSample()
+    /**
+     * The number of samples from start onwards that have been overwritten (or are in the process of
+     * being overwritten). Call this after reading samples in place from spans to check they were valid.
+     **/
+    uint64_t getOverwritten(uint64_t start)
     {
-        m_buffer_pos++;
-        if (m_buffer_pos == SAMPLE_BUFFER_SIZE)
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t oldest = m_ring_buffer->getOldestSequence();
+        return oldest > start ? oldest - start : 0;
+    }
+    /**
+     * If the reader has fallen too far behind the writer move it forward to the oldest sample that can
+     * still be read. Returns the number of samples that were skipped.
+     **/
+    uint64_t skipOverwritten()
+    {
+        uint64_t lost = getOverwritten(m_position);
+        m_position += lost;
+        m_lost_samples += lost;
+        return lost;
+    }
+    /**
+     * Copy up to count samples from the cursor and move the cursor on. Returns the number of samples
+     * read - if the reader had been overrun then lost is set to the number of samples that were skipped.
+     **/
+    int read(Sample *samples, int count, uint64_t *lost = NULL)
+    {
+        uint64_t lost_samples = skipOverwritten();
+        count = std::min(count, getAvailable());
+        Span spans[2];
+        int span_count = getSpans(m_position, count, spans);
+        Sample *dst = samples;
+        for (int i = 0; i < span_count; i++)
         {
-            m_buffer_pos = 0;
-            m_buffer_idx++;
-            if (m_buffer_idx == m_number_audio_buffers)
-            {
-                m_buffer_idx = 0;
-            }
-            m_current_buffer = m_audio_buffers[m_buffer_idx];
-            return true;
+            memcpy(dst, spans[i].samples, spans[i].length * sizeof(Sample));
+            dst += spans[i].length;
         }
-        return false;
+        // anything the writer got to while we were copying is not valid - drop it from the front
+        uint64_t torn = std::min((uint64_t)count, getOverwritten(m_position));
+        if (torn > 0)
+        {
+            memmove(samples, samples + torn, (count - torn) * sizeof(Sample));
+            count -= torn;
+            lost_samples += torn;
+            m_lost_samples += torn;
+        }
+        m_position += count + torn;
+        if (lost)
+        {
+            *lost = lost_samples;
+        }
+        return count;
+    }
+};
+
+/**
+ * The ring buffer the samplers write audio to
+ **/
+typedef RingBuffer<int16_t, AUDIO_RING_CAPACITY, AUDIO_RING_STORAGE> AudioRingBuffer;
+typedef AudioRingBuffer::Span RingBufferSpan;
+
+/**
+ * A reader of the audio ring buffer - this is a class rather than a typedef so it can be forward declared
+ **/
+class RingBufferAccessor : public RingBufferReader<AudioRingBuffer>
+{
+public:
+    RingBufferAccessor(AudioRingBuffer *ring_buffer) : RingBufferReader<AudioRingBuffer>(ring_buffer)
+    {
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,103 @@
+#include <string.h>
+#include "SampleConversion.h"
+
+// SAMPLE_CONVERSION_SCALAR builds just the plain C versions - the host tests use it to check the vector versions against
+#if defined(__SSE2__) && !defined(SAMPLE_CONVERSION_SCALAR)
+#define SSE2_CONVERSION
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && !defined(SAMPLE_CONVERSION_SCALAR)
+#define NEON_CONVERSION
+#include <arm_neon.h>
+#endif
+
+// mask for the 18 valid bits of an SPH0645 sample
+#define SPH0645_MASK ((int32_t)0xFFFFC000)
+
+static inline int16_t saturate(int32_t sample)
+{
+    if (sample > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (sample < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return sample;
+}
+
+static void convertShiftedSamples(const int32_t *src, int16_t *dst, size_t count, int shift, int32_t mask)
+{
+    size_t i = 0;
+#if defined(SSE2_CONVERSION)
+    const __m128i mask_vector = _mm_set1_epi32(mask);
+    const __m128i shift_vector = _mm_cvtsi32_si128(shift);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i high = _mm_loadu_si128((const __m128i *)(src + i + 4));
+        low = _mm_sra_epi32(_mm_and_si128(low, mask_vector), shift_vector);
+        high = _mm_sra_epi32(_mm_and_si128(high, mask_vector), shift_vector);
+        // packs does the saturation for us
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(low, high));
+    }
+#elif defined(NEON_CONVERSION)
+    const int32x4_t mask_vector = vdupq_n_s32(mask);
+    // neon only shifts right by a constant so shift left by a negative amount instead
+    const int32x4_t shift_vector = vdupq_n_s32(-shift);
+    for (; i + 8 <= count; i += 8)
+    {
+        int32x4_t low = vld1q_s32(src + i);
+        int32x4_t high = vld1q_s32(src + i + 4);
+        low = vshlq_s32(vandq_s32(low, mask_vector), shift_vector);
+        high = vshlq_s32(vandq_s32(high, mask_vector), shift_vector);
+        // qmovn does the saturation for us
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        // read through memcpy so the compiler knows src and dst may be the same buffer
+        int32_t sample;
+        memcpy(&sample, src + i, sizeof(int32_t));
+        dst[i] = saturate((sample & mask) >> shift);
+    }
+}
+
+void convertI2SSamples(const int32_t *src, int16_t *dst, size_t count, int shift)
+{
+    convertShiftedSamples(src, dst, count, shift, (int32_t)0xFFFFFFFF);
+}
+
+void convertSPH0645Samples(const int32_t *src, int16_t *dst, size_t count, int shift)
+{
+    convertShiftedSamples(src, dst, count, shift, SPH0645_MASK);
+}
+
+void convertADCSamples(const uint16_t *src, int16_t *dst, size_t count)
+{
+    size_t i = 0;
+    // (2048 - 4095) * 15 and 2048 * 15 both fit in an int16 so the vector versions don't overflow
+#if defined(SSE2_CONVERSION)
+    const __m128i mask_vector = _mm_set1_epi16(0xfff);
+    const __m128i centre_vector = _mm_set1_epi16(2048);
+    const __m128i scale_vector = _mm_set1_epi16(15);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i raw = _mm_and_si128(_mm_loadu_si128((const __m128i *)(src + i)), mask_vector);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_mullo_epi16(_mm_sub_epi16(centre_vector, raw), scale_vector));
+    }
+#elif defined(NEON_CONVERSION)
+    const uint16x8_t mask_vector = vdupq_n_u16(0xfff);
+    const int16x8_t centre_vector = vdupq_n_s16(2048);
+    for (; i + 8 <= count; i += 8)
+    {
+        int16x8_t raw = vreinterpretq_s16_u16(vandq_u16(vld1q_u16(src + i), mask_vector));
+        vst1q_s16(dst + i, vmulq_n_s16(vsubq_s16(centre_vector, raw), 15));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = saturate((2048 - (src[i] & 0xfff)) * 15);
+    }
+}
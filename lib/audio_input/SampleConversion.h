@@ -0,0 +1,24 @@
+#ifndef _sample_conversion_h_
+#define _sample_conversion_h_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Kernels for converting the raw data read from the I2S peripheral into 16 bit samples.
+ *
+ * These work on blocks of samples so they can be vectorised - there are SSE2 and NEON versions for
+ * host builds and plain C versions for everything else. All of them saturate to the int16 range.
+ *
+ * They can also convert in place (dst pointing at the same memory as src) - the output samples are never
+ * bigger than the input samples so we never write over input that hasn't been read yet.
+ **/
+
+// 32 bit samples from an I2S microphone shifted down by shift bits
+void convertI2SSamples(const int32_t *src, int16_t *dst, size_t count, int shift);
+// the SPH0645 only has 18 valid bits, the rest of the 32 bit word needs to be masked off before shifting
+void convertSPH0645Samples(const int32_t *src, int16_t *dst, size_t count, int shift);
+// 12 bit samples from the built in ADC - these are centred on 2048, inverted and scaled up
+void convertADCSamples(const uint16_t *src, int16_t *dst, size_t count);
+
+#endif
@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "CaptureStore.h"
+
+// the sample with a sequence number - wraps round at 16 bits which is fine for checking the order
+static int16_t sample_at(uint64_t sequence)
+{
+    return (int16_t)(sequence * 7 + 3);
+}
+
+// write a block to the hot tier and copy it to the cold tier the way I2SSampler::publishSamples does
+static void write_block(AudioRingBuffer *hot, ColdRingBuffer *cold, uint64_t &sequence, int count)
+{
+    uint64_t from = sequence;
+    hot->beginWrite(count);
+    for (int i = 0; i < count; i++)
+    {
+        hot->writeSample(sample_at(sequence++));
+    }
+    hot->endWrite();
+    if (cold)
+    {
+        copyToColdTier(hot, cold, from, sequence);
+    }
+}
+
+// read everything from start to the write position a chunk at a time like RecogniseCommandState does
+static int read_back(CaptureReader &reader, uint64_t start, int chunk_size, uint64_t &lost, bool &in_order)
+{
+    std::vector<int16_t> chunk(chunk_size);
+    reader.setPosition(start);
+    lost = 0;
+    in_order = true;
+    int total = 0;
+    while (reader.getAvailable() > 0)
+    {
+        uint64_t chunk_lost = 0;
+        uint64_t position = reader.getPosition();
+        int count = reader.read(chunk.data(), chunk_size, &chunk_lost);
+        lost += chunk_lost;
+        for (int i = 0; i < count; i++)
+        {
+            in_order = in_order && chunk[i] == sample_at(position + chunk_lost + i);
+        }
+        total += count;
+    }
+    return total;
+}
+
+/**
+ * Fill well past the hot tier's capacity and read back from before the oldest sample it still has - everything
+ * should come from the cold tier and then carry on from the hot tier with nothing lost
+ **/
+static void test_reads_from_cold_tier()
+{
+    AudioRingBuffer *hot = new AudioRingBuffer();
+    ColdRingBuffer *cold = new ColdRingBuffer();
+    uint64_t sequence = 0;
+    const int total = 3 * AudioRingBuffer::CAPACITY;
+    while (sequence < (uint64_t)total)
+    {
+        write_block(hot, cold, sequence, 256);
+    }
+    CaptureReader reader(hot, cold);
+    CHECK(hot->getOldestSequence() > 0);
+    // odd chunk sizes so the reads straddle the end of both tiers' storage and the cold to hot boundary
+    const int chunk_sizes[] = {1600, 999, 4097};
+    for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+    {
+        uint64_t lost = 0;
+        bool in_order = false;
+        int read = read_back(reader, 0, chunk_sizes[c], lost, in_order);
+        CHECK(read == (int)sequence);
+        CHECK(lost == 0);
+        CHECK(in_order);
+    }
+    // the spans for a range before the hot tier's oldest sample come from the cold tier
+    uint64_t start = hot->getOldestSequence() - 100;
+    RingBufferSpan spans[2];
+    int span_count = reader.getSpans(start, 100, spans);
+    int length = 0;
+    bool spans_in_order = true;
+    for (int i = 0; i < span_count; i++)
+    {
+        for (int j = 0; j < spans[i].length; j++, length++)
+        {
+            spans_in_order = spans_in_order && spans[i].samples[j] == sample_at(start + length);
+        }
+    }
+    CHECK(length == 100);
+    CHECK(spans_in_order);
+    CHECK(reader.getOverwritten(start) == 0);
+    printf("Read %d samples back through the cold tier, %d more than the hot tier holds\n", (int)sequence,
+           (int)(sequence - AudioRingBuffer::CAPACITY));
+    delete hot;
+    delete cold;
+}
+
+/**
+ * Without a cold tier a reader that starts before the hot tier's oldest sample loses everything before it
+ **/
+static void test_without_cold_tier()
+{
+    AudioRingBuffer *hot = new AudioRingBuffer();
+    uint64_t sequence = 0;
+    const int total = 3 * AudioRingBuffer::CAPACITY;
+    while (sequence < (uint64_t)total)
+    {
+        write_block(hot, NULL, sequence, 256);
+    }
+    CaptureReader reader(hot, NULL);
+    uint64_t oldest = hot->getOldestSequence();
+    uint64_t lost = 0;
+    bool in_order = false;
+    int read = read_back(reader, 0, 1600, lost, in_order);
+    CHECK(lost == oldest);
+    CHECK(reader.getLostSamples() == oldest);
+    CHECK(read == (int)(sequence - oldest));
+    CHECK(in_order);
+    printf("Without a cold tier %d samples were lost\n", (int)lost);
+    delete hot;
+}
+
+/**
+ * Once the cold tier has been overrun as well the reader loses whatever is older than the cold tier's oldest sample
+ **/
+static void test_cold_tier_overrun()
+{
+    AudioRingBuffer *hot = new AudioRingBuffer();
+    ColdRingBuffer *cold = new ColdRingBuffer();
+    uint64_t sequence = 0;
+    const int total = 2 * ColdRingBuffer::CAPACITY;
+    while (sequence < (uint64_t)total)
+    {
+        write_block(hot, cold, sequence, 256);
+    }
+    CaptureReader reader(hot, cold);
+    uint64_t oldest = cold->getOldestSequence();
+    CHECK(oldest > 0);
+    uint64_t lost = 0;
+    bool in_order = false;
+    int read = read_back(reader, 0, 1600, lost, in_order);
+    CHECK(lost == oldest);
+    CHECK(read == (int)(sequence - oldest));
+    CHECK(in_order);
+    delete hot;
+    delete cold;
+}
+
+int main()
+{
+    test_reads_from_cold_tier();
+    test_without_cold_tier();
+    test_cold_tier_overrun();
+    return host_test_result("test_capture_store");
+}
@@ -0,0 +1,255 @@
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "SampleConversion.h"
+
+typedef RingBuffer<int16_t, 1000> TestRingBuffer;
+typedef RingBufferReader<TestRingBuffer> TestReader;
+
+// the sample with a sequence number - wraps round at 16 bits which is fine for checking the order
+static int16_t sample_at(uint64_t sequence)
+{
+    return (int16_t)(sequence * 7 + 3);
+}
+
+static void write_samples(TestRingBuffer &ring_buffer, uint64_t &sequence, int count)
+{
+    ring_buffer.beginWrite(count);
+    for (int i = 0; i < count; i++)
+    {
+        ring_buffer.writeSample(sample_at(sequence++));
+    }
+    ring_buffer.endWrite();
+}
+
+static void test_spans()
+{
+    TestRingBuffer ring_buffer;
+    uint64_t sequence = 0;
+    write_samples(ring_buffer, sequence, 2500);
+    TestReader reader(&ring_buffer);
+    // ranges that fit before the end of the storage and ones that wrap round it
+    const uint64_t starts[] = {1500, 1900, 1999, 2000, 2100};
+    for (size_t s = 0; s < sizeof(starts) / sizeof(starts[0]); s++)
+    {
+        int count = (int)std::min<uint64_t>(400, sequence - starts[s]);
+        TestRingBuffer::Span spans[2];
+        int span_count = reader.getSpans(starts[s], count, spans);
+        int total = 0;
+        bool in_order = true;
+        for (int i = 0; i < span_count; i++)
+        {
+            for (int j = 0; j < spans[i].length; j++)
+            {
+                in_order &= spans[i].samples[j] == sample_at(starts[s] + total + j);
+            }
+            total += spans[i].length;
+        }
+        CHECK(total == count);
+        CHECK(in_order);
+        CHECK(span_count == ((starts[s] % 1000) + count > 1000 ? 2 : 1));
+    }
+}
+
+static void test_read()
+{
+    TestRingBuffer ring_buffer;
+    uint64_t sequence = 0;
+    TestReader reader(&ring_buffer);
+    std::vector<int16_t> samples(300);
+    // keep up with the writer in blocks that don't line up with the size of the ring buffer
+    uint64_t position = 0;
+    for (int block = 0; block < 20; block++)
+    {
+        write_samples(ring_buffer, sequence, 170);
+        uint64_t lost = 0;
+        int read = reader.read(samples.data(), 300, &lost);
+        CHECK(lost == 0);
+        CHECK(read == 170);
+        for (int i = 0; i < read; i++)
+        {
+            CHECK(samples[i] == sample_at(position + i));
+        }
+        position += read;
+    }
+    // fall behind and we should get told how much we missed and then the oldest samples that are left
+    write_samples(ring_buffer, sequence, 1500);
+    uint64_t lost = 0;
+    int read = reader.read(samples.data(), 300, &lost);
+    CHECK(lost == 500);
+    CHECK(read == 300);
+    CHECK(samples[0] == sample_at(position + 500));
+}
+
+/**
+ * Write like I2SSampler::readI2SData does with 32 bit raw samples - the raw samples are read into the slots after the
+ * write pointer and converted in place, so twice as many slots get scribbled on as there are samples committed
+ **/
+template <class RingBufferT>
+static void write_raw_samples(RingBufferT &ring_buffer, uint64_t &sequence, int slots)
+{
+    int count = slots;
+    int16_t *dst = ring_buffer.getWritePointer(count);
+    int raw_count = count * sizeof(int16_t) / sizeof(int32_t);
+    ring_buffer.beginWrite(count);
+    if (raw_count == 0)
+    {
+        // not enough room for a raw sample before the wrap - the sampler reads this one via the stack
+        ring_buffer.writeSample(sample_at(sequence++));
+    }
+    else
+    {
+        int32_t *raw = (int32_t *)dst;
+        for (int i = 0; i < raw_count; i++)
+        {
+            // the raw samples are the final ones shifted up with some noise in the bottom bits
+            raw[i] = ((int32_t)sample_at(sequence + i) << 11) | (i & 0x7ff);
+        }
+        convertI2SSamples(raw, dst, raw_count, 11);
+        ring_buffer.commitWrite(raw_count);
+        sequence += raw_count;
+    }
+    ring_buffer.endWrite();
+}
+
+// the oldest samples the ring buffer says are valid have to be converted samples and not left over raw ones
+template <class RingBufferT>
+static void test_raw_writes()
+{
+    RingBufferT ring_buffer;
+    uint64_t sequence = 0;
+    std::vector<int16_t> samples(RingBufferT::CAPACITY);
+    for (int block = 0; block < 50; block++)
+    {
+        write_raw_samples(ring_buffer, sequence, 512);
+        // a reader that has fallen behind gets moved on to the oldest sample and reads everything from there
+        RingBufferReader<RingBufferT> reader(&ring_buffer);
+        reader.setPosition(0);
+        uint64_t lost = 0;
+        int read = reader.read(samples.data(), RingBufferT::CAPACITY, &lost);
+        CHECK(lost + read == sequence);
+        bool valid = true;
+        for (int i = 0; i < read; i++)
+        {
+            valid &= samples[i] == sample_at(lost + i);
+        }
+        if (!valid)
+        {
+            printf("Read raw samples from the oldest part of the ring buffer after %d blocks\n", block + 1);
+        }
+        CHECK(valid);
+        // only the slots that were scribbled on are lost - everything else in the ring can be read
+        CHECK(read >= (int)std::min<uint64_t>(sequence, RingBufferT::CAPACITY - 512));
+    }
+}
+
+/**
+ * How the readers used to get at the samples - a sample at a time with the index worked out and the end of the storage
+ * checked for every one. This is the baseline for the benchmark.
+ **/
+class PerSampleReader
+{
+private:
+    const int16_t *m_samples;
+    int m_size;
+    int m_index;
+
+public:
+    PerSampleReader(const int16_t *samples, int size)
+    {
+        m_samples = samples;
+        m_size = size;
+        m_index = 0;
+    }
+    void setIndex(uint64_t sequence)
+    {
+        m_index = sequence % m_size;
+    }
+    inline int16_t getCurrentSample()
+    {
+        return m_samples[m_index];
+    }
+    inline void moveToNextSample()
+    {
+        m_index++;
+        if (m_index == m_size)
+        {
+            m_index = 0;
+        }
+    }
+};
+
+// read a second of audio out of the audio ring buffer over and over starting at different places so it wraps round
+static void benchmark_spans()
+{
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    uint64_t sequence = 0;
+    ring_buffer->beginWrite(AudioRingBuffer::CAPACITY);
+    for (int i = 0; i < AudioRingBuffer::CAPACITY; i++)
+    {
+        ring_buffer->writeSample(sample_at(sequence++));
+    }
+    ring_buffer->endWrite();
+    RingBufferAccessor reader(ring_buffer);
+    const int window = 16000;
+    std::vector<int16_t> copy(window);
+    // sequence 0 is at the start of the storage
+    RingBufferSpan storage[2];
+    reader.getSpans(0, 1, storage);
+    PerSampleReader per_sample(storage[0].samples, AudioRingBuffer::CAPACITY);
+
+    int64_t sum = 0;
+    int runs = 0;
+    int64_t start = host_time_us();
+    int64_t per_sample_time = 0;
+    do
+    {
+        per_sample.setIndex(runs * 997);
+        for (int i = 0; i < window; i++)
+        {
+            copy[i] = per_sample.getCurrentSample();
+            per_sample.moveToNextSample();
+        }
+        sum += copy[runs % window];
+        runs++;
+        per_sample_time = host_time_us() - start;
+    } while (per_sample_time < 200000);
+    double per_sample_rate = (double)runs * window * sizeof(int16_t) * 1e6 / per_sample_time;
+
+    runs = 0;
+    start = host_time_us();
+    int64_t span_time = 0;
+    do
+    {
+        RingBufferSpan read_spans[2];
+        int count = reader.getSpans(runs * 997, window, read_spans);
+        int16_t *dst = copy.data();
+        for (int i = 0; i < count; i++)
+        {
+            memcpy(dst, read_spans[i].samples, read_spans[i].length * sizeof(int16_t));
+            dst += read_spans[i].length;
+        }
+        sum += copy[runs % window];
+        runs++;
+        span_time = host_time_us() - start;
+    } while (span_time < 200000);
+    double span_rate = (double)runs * window * sizeof(int16_t) * 1e6 / span_time;
+    // stop the compiler from throwing the copies away
+    volatile int64_t sink = sum;
+    (void)sink;
+    printf("Reading a second of audio: %.0f MB/s a sample at a time, %.0f MB/s with spans (%.1fx)\n", per_sample_rate / 1e6,
+           span_rate / 1e6, span_rate / per_sample_rate);
+    delete ring_buffer;
+}
+
+int main()
+{
+    test_spans();
+    test_read();
+    test_raw_writes<RingBuffer<int16_t, 1000> >();
+    test_raw_writes<RingBuffer<int16_t, 2048> >();
+    benchmark_spans();
+    return host_test_result("test_ring_buffer");
+}
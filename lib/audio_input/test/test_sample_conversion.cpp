@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "HostTest.h"
+#include "SampleConversion.h"
+
+// the same kernels built with SAMPLE_CONVERSION_SCALAR - the Makefile renames them so both versions can be linked together
+void scalarConvertI2SSamples(const int32_t *src, int16_t *dst, size_t count, int shift);
+void scalarConvertSPH0645Samples(const int32_t *src, int16_t *dst, size_t count, int shift);
+void scalarConvertADCSamples(const uint16_t *src, int16_t *dst, size_t count);
+
+typedef void (*shifted_converter_fn)(const int32_t *src, int16_t *dst, size_t count, int shift);
+typedef void (*adc_converter_fn)(const uint16_t *src, int16_t *dst, size_t count);
+
+// random 32 bit samples with the extremes mixed in so the saturation gets tested
+static std::vector<int32_t> make_i2s_samples(size_t count)
+{
+    uint32_t state = 12345;
+    std::vector<int32_t> samples(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[i] = (int32_t)host_random(state);
+    }
+    const int32_t extremes[] = {INT32_MAX, INT32_MIN, 0, -1, 1 << 26, -(1 << 26), (1 << 26) - 1};
+    for (size_t i = 0; i < sizeof(extremes) / sizeof(extremes[0]) && i * 3 < count; i++)
+    {
+        samples[i * 3] = extremes[i];
+    }
+    return samples;
+}
+
+static std::vector<uint16_t> make_adc_samples(size_t count)
+{
+    uint32_t state = 54321;
+    std::vector<uint16_t> samples(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        // the top nibble has the channel number in it and has to be masked off
+        samples[i] = (uint16_t)host_random(state);
+    }
+    return samples;
+}
+
+static void check_shifted_converter(const char *name, shifted_converter_fn convert, shifted_converter_fn reference)
+{
+    // counts either side of the 8 sample vector blocks so the scalar tail gets used as well
+    const size_t counts[] = {0, 1, 7, 8, 9, 15, 16, 17, 255, 256};
+    std::vector<int32_t> src = make_i2s_samples(256);
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        for (int shift = 0; shift <= 16; shift += 4)
+        {
+            size_t count = counts[c];
+            std::vector<int16_t> expected(count + 1, 0x5a5a), actual(count + 1, 0x5a5a);
+            reference(src.data(), expected.data(), count, shift);
+            convert(src.data(), actual.data(), count, shift);
+            if (expected != actual)
+            {
+                printf("%s differs from the scalar version for %d samples shifted by %d\n", name, (int)count, shift);
+            }
+            CHECK(expected == actual);
+            // and in place like the samplers do it - the 16 bit output overwrites the start of the 32 bit input
+            std::vector<int32_t> in_place(src.begin(), src.begin() + count);
+            convert(in_place.data(), (int16_t *)in_place.data(), count, shift);
+            CHECK(count == 0 || memcmp(in_place.data(), expected.data(), count * sizeof(int16_t)) == 0);
+        }
+    }
+}
+
+static void check_adc_converter()
+{
+    std::vector<uint16_t> src = make_adc_samples(256);
+    for (size_t count = 0; count <= 40; count++)
+    {
+        std::vector<int16_t> expected(count + 1, 0x5a5a), actual(count + 1, 0x5a5a);
+        scalarConvertADCSamples(src.data(), expected.data(), count);
+        convertADCSamples(src.data(), actual.data(), count);
+        CHECK(expected == actual);
+        std::vector<uint16_t> in_place(src.begin(), src.begin() + count);
+        convertADCSamples(in_place.data(), (int16_t *)in_place.data(), count);
+        CHECK(count == 0 || memcmp(in_place.data(), expected.data(), count * sizeof(int16_t)) == 0);
+    }
+    // the two ends of the ADC range
+    uint16_t ends[] = {0, 0xfff};
+    int16_t converted[2];
+    convertADCSamples(ends, converted, 2);
+    CHECK(converted[0] == 2048 * 15);
+    CHECK(converted[1] == (2048 - 4095) * 15);
+}
+
+// how many bytes of raw samples a kernel gets through per second - a DMA read's worth at a time like the samplers
+template <typename RawT, typename Convert>
+static double bytes_per_second(Convert convert, const std::vector<RawT> &raw)
+{
+    const size_t block = 1024 / sizeof(RawT);
+    std::vector<RawT> src(raw);
+    std::vector<int16_t> dst(raw.size());
+    int64_t start = host_time_us();
+    int64_t bytes = 0;
+    int64_t elapsed = 0;
+    do
+    {
+        for (size_t i = 0; i + block <= src.size(); i += block)
+        {
+            convert(src.data() + i, dst.data() + i, block);
+        }
+        bytes += (src.size() / block) * block * sizeof(RawT);
+        elapsed = host_time_us() - start;
+    } while (elapsed < 200000);
+    // stop the compiler from throwing the conversions away
+    volatile int16_t sink = dst[dst.size() / 2];
+    (void)sink;
+    return bytes * 1e6 / elapsed;
+}
+
+int main()
+{
+    check_shifted_converter("convertI2SSamples", convertI2SSamples, scalarConvertI2SSamples);
+    check_shifted_converter("convertSPH0645Samples", convertSPH0645Samples, scalarConvertSPH0645Samples);
+    check_adc_converter();
+
+    std::vector<int32_t> i2s_samples = make_i2s_samples(16384);
+    std::vector<uint16_t> adc_samples = make_adc_samples(16384);
+    double i2s_vector = bytes_per_second([](const int32_t *src, int16_t *dst, size_t count)
+                                         { convertSPH0645Samples(src, dst, count, 11); },
+                                         i2s_samples);
+    double i2s_scalar = bytes_per_second([](const int32_t *src, int16_t *dst, size_t count)
+                                         { scalarConvertSPH0645Samples(src, dst, count, 11); },
+                                         i2s_samples);
+    double adc_vector = bytes_per_second(convertADCSamples, adc_samples);
+    double adc_scalar = bytes_per_second(scalarConvertADCSamples, adc_samples);
+    printf("I2S 32 bit samples: %.0f MB/s vectorised, %.0f MB/s scalar (%.1fx)\n", i2s_vector / 1e6, i2s_scalar / 1e6, i2s_vector / i2s_scalar);
+    printf("ADC 16 bit samples: %.0f MB/s vectorised, %.0f MB/s scalar (%.1fx)\n", adc_vector / 1e6, adc_scalar / 1e6, adc_vector / adc_scalar);
+    return host_test_result("test_sample_conversion");
+}
@@ -0,0 +1,189 @@
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "HostTest.h"
+#include "SimulatedI2S.h"
+#include "I2SMicSampler.h"
+#include "SampleConversion.h"
+
+// two seconds of audio so the ring buffer wraps round
+#define TEST_SAMPLES 32000
+#define DMA_BUFFER_COUNT 4
+#define DMA_BUFFER_LENGTH 64
+
+static i2s_config_t make_config()
+{
+    i2s_config_t config = {
+        .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX),
+        .sample_rate = 16000,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
+        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
+        .communication_format = I2S_COMM_FORMAT_I2S,
+        .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
+        .dma_buf_count = DMA_BUFFER_COUNT,
+        .dma_buf_len = DMA_BUFFER_LENGTH,
+        .use_apll = false,
+        .tx_desc_auto_clear = false,
+        .fixed_mclk = 0};
+    return config;
+}
+
+// what an SPH0645 sends - 18 bits of audio at the top of the word and junk below it
+static std::vector<int32_t> make_raw_samples()
+{
+    uint32_t state = 2024;
+    std::vector<int32_t> raw(TEST_SAMPLES);
+    for (int i = 0; i < TEST_SAMPLES; i++)
+    {
+        int32_t audio = (int32_t)(8000 * sin(i * 0.05)) + (int32_t)(host_random(state) % 200) - 100;
+        raw[i] = (int32_t)((uint32_t)audio << 11) | (int32_t)(host_random(state) & 0x3fff);
+    }
+    return raw;
+}
+
+// wait for the reader task to have written the samples to the ring buffer
+static bool wait_for_samples(I2SSampler *sampler, uint64_t count)
+{
+    int64_t start = host_time_us();
+    while (sampler->getCurrentWritePosition() < count)
+    {
+        if (host_time_us() - start > 2000000)
+        {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+static void receive(i2s_port_t port, const int32_t *raw, int count)
+{
+    // a DMA buffer at a time - the simulated peripheral waits for the reader rather than dropping anything
+    for (int i = 0; i < count; i += DMA_BUFFER_LENGTH)
+    {
+        simulated_i2s_receive(port, raw + i, std::min(DMA_BUFFER_LENGTH, count - i) * sizeof(int32_t), true);
+    }
+}
+
+/**
+ * The samples read through the simulated peripheral by the sampler's reader task have to come out of the ring buffer
+ * exactly as the converter would have made them - the raw samples are read straight into the ring buffer so this
+ * checks none of them are left behind
+ **/
+static double test_sampler(const std::vector<int32_t> &raw, const std::vector<int16_t> &expected)
+{
+    i2s_pin_config_t pins = {.bck_io_num = 33, .ws_io_num = 26, .data_out_num = I2S_PIN_NO_CHANGE, .data_in_num = 25};
+    i2s_config_t config = make_config();
+    I2SSampler *sampler = new I2SMicSampler(pins, true);
+    sampler->start(I2S_NUM_0, config, xTaskGetCurrentTaskHandle());
+    RingBufferAccessor *reader = sampler->getRingBufferReader();
+    // the ring buffer storage starts at sequence 0 - the samples should be read straight into it
+    RingBufferSpan storage[2];
+    reader->getSpans(0, AudioRingBuffer::CAPACITY, storage);
+    simulated_i2s_set_destination(I2S_NUM_0, storage[0].samples, AudioRingBuffer::CAPACITY * sizeof(int16_t));
+
+    std::vector<int16_t> samples(AudioRingBuffer::CAPACITY);
+    // whole DMA buffers so none of the samples are left waiting for a buffer to fill
+    const int block = 50 * DMA_BUFFER_LENGTH;
+    bool matches = true;
+    for (int start = 0; start < TEST_SAMPLES; start += block)
+    {
+        receive(I2S_NUM_0, raw.data() + start, block);
+        CHECK(wait_for_samples(sampler, start + block));
+        // keep up with the writer and check everything that's arrived
+        uint64_t position = reader->getPosition();
+        uint64_t lost = 0;
+        int read = reader->read(samples.data(), AudioRingBuffer::CAPACITY, &lost);
+        CHECK(lost == 0);
+        CHECK(read == block);
+        matches &= memcmp(samples.data(), expected.data() + position, read * sizeof(int16_t)) == 0;
+    }
+    CHECK(matches);
+    // a reader that has fallen behind gets the oldest samples the ring buffer still has - these must be valid as well. Give
+    // the reader task time to work through the events that are still queued and give up waiting for more data first so it
+    // isn't in the middle of a read.
+    vTaskDelay(pdMS_TO_TICKS(200));
+    reader->setPosition(0);
+    uint64_t lost = 0;
+    int read = reader->read(samples.data(), AudioRingBuffer::CAPACITY, &lost);
+    CHECK(lost + read == TEST_SAMPLES);
+    CHECK(memcmp(samples.data(), expected.data() + lost, read * sizeof(int16_t)) == 0);
+    // and the processor task should have been woken up
+    CHECK(ulTaskNotifyTake(pdTRUE, 0) != 0);
+
+    SimulatedI2SStats stats = simulated_i2s_get_stats(I2S_NUM_0);
+    CHECK(stats.bytes_read == TEST_SAMPLES * sizeof(int32_t));
+    CHECK(stats.bytes_dropped == 0);
+    // the converter rewrites the samples in place so only the ones that went through the stack are copied again
+    double bytes_per_sample = (stats.bytes_read + stats.bytes_read_elsewhere / sizeof(int32_t) * sizeof(int16_t)) / (double)TEST_SAMPLES;
+    printf("Sampler: %.3f bytes copied per sample - %.1f out of the DMA buffers, %.4f through the stack (%llu of %llu reads)\n",
+           bytes_per_sample, (double)stats.bytes_read / TEST_SAMPLES, (double)stats.bytes_read_elsewhere / TEST_SAMPLES,
+           (unsigned long long)(stats.bytes_read_elsewhere / sizeof(int32_t)), (unsigned long long)stats.reads);
+    delete reader;
+    return bytes_per_sample;
+}
+
+/**
+ * How the samples used to be read - into a 1024 byte buffer on the reader task's stack and then converted from there
+ * into the ring buffer. This is the baseline.
+ **/
+static double test_stack_buffer_reads(const std::vector<int32_t> &raw, const std::vector<int16_t> &expected)
+{
+    i2s_config_t config = make_config();
+    i2s_driver_install(I2S_NUM_1, &config, 0, NULL);
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    RingBufferAccessor reader(ring_buffer);
+    RingBufferSpan storage[2];
+    reader.getSpans(0, AudioRingBuffer::CAPACITY, storage);
+    simulated_i2s_set_destination(I2S_NUM_1, storage[0].samples, AudioRingBuffer::CAPACITY * sizeof(int16_t));
+
+    uint64_t converted_bytes = 0;
+    uint8_t i2sData[1024];
+    for (int start = 0; start < TEST_SAMPLES; start += DMA_BUFFER_COUNT * DMA_BUFFER_LENGTH)
+    {
+        receive(I2S_NUM_1, raw.data() + start, std::min(DMA_BUFFER_COUNT * DMA_BUFFER_LENGTH, TEST_SAMPLES - start));
+        size_t bytesRead = 0;
+        i2s_read(I2S_NUM_1, i2sData, sizeof(i2sData), &bytesRead, 10);
+        const int32_t *src = (const int32_t *)i2sData;
+        int count = bytesRead / sizeof(int32_t);
+        ring_buffer->beginWrite(count);
+        while (count > 0)
+        {
+            int length = count;
+            int16_t *dst = ring_buffer->getWritePointer(length);
+            convertSPH0645Samples(src, dst, length, 11);
+            ring_buffer->commitWrite(length);
+            converted_bytes += length * sizeof(int16_t);
+            src += length;
+            count -= length;
+        }
+        ring_buffer->endWrite();
+    }
+    std::vector<int16_t> samples(AudioRingBuffer::CAPACITY);
+    reader.setPosition(TEST_SAMPLES - 1000);
+    CHECK(reader.read(samples.data(), 1000) == 1000);
+    CHECK(memcmp(samples.data(), expected.data() + TEST_SAMPLES - 1000, 1000 * sizeof(int16_t)) == 0);
+
+    SimulatedI2SStats stats = simulated_i2s_get_stats(I2S_NUM_1);
+    CHECK(stats.bytes_read == TEST_SAMPLES * sizeof(int32_t));
+    double bytes_per_sample = (stats.bytes_read + converted_bytes) / (double)TEST_SAMPLES;
+    printf("Stack buffer: %.3f bytes copied per sample - %.1f out of the DMA buffers onto the stack, %.1f from there into the ring buffer\n",
+           bytes_per_sample, (double)stats.bytes_read / TEST_SAMPLES, (double)converted_bytes / TEST_SAMPLES);
+    delete ring_buffer;
+    return bytes_per_sample;
+}
+
+int main()
+{
+    std::vector<int32_t> raw = make_raw_samples();
+    std::vector<int16_t> expected(TEST_SAMPLES);
+    convertSPH0645Samples(raw.data(), expected.data(), TEST_SAMPLES, 11);
+
+    double stack_buffer_bytes = test_stack_buffer_reads(raw, expected);
+    double sampler_bytes = test_sampler(raw, expected);
+    CHECK(sampler_bytes < stack_buffer_bytes);
+    CHECK(sampler_bytes < 4.01);
+    return host_test_result("test_simulated_i2s");
+}
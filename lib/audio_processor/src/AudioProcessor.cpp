@@ -1,124 +1,1131 @@
 #include <stdlib.h>
+#include <math.h>
 #include <algorithm>
 #include "AudioProcessor.h"
 #include "HammingWindow.h"
+#include "SlidingWindowStats.h"
+#include "MelFilterbank.h"
+#include "NoiseReductionPCAN.h"
+#include "FFTPlanCache.h"
+#include "WorkerPool.h"
 #include "RingBuffer.h"
+#include "FastMath.h"
+#include "StaticRealFFT.h"
+#include "BatchedRealFFT.h"
+#include "CycleCounter.h"
 
 #define EPSILON 1e-6
+#define SAMPLE_RATE 16000
+// the range the mel filterbank covers
+#define MEL_LOW_FREQUENCY 125.0f
+#define MEL_HIGH_FREQUENCY 7500.0f
+// waking up the other workers takes a while so they only get a share of the frames if there are at least this many each
+#define MIN_FRAMES_PER_WORKER 4
+// log10(2) scaled down to convert a Q16 log2 into a log10
+#define LOG10_2_Q16 (0.30102999566f / 65536.0f)
+// the streaming rows are corrected for the change in the mean in the pooled bins where the window's spectrum has at least
+// this fraction of the energy it has in the bin where it has the most
+#define DC_CORRECTION_THRESHOLD 1e-10f
 
-AudioProcessor::AudioProcessor(int audio_length, int window_size, int step_size, int pooling_size)
+// log2(1 + i/32) in Q16
+static const int32_t LOG2_TABLE[33] = {
+    0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+    27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904, 47705,
+    49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534, 64047, 65536};
+
+// integer log2 of value (which must not be 0) in Q16 - the top 5 bits after the leading one pick an entry
+// in the table and the next 16 bits interpolate to the next entry
+static inline int32_t log2_fixed(uint64_t value)
+{
+    int integer_part = 63 - __builtin_clzll(value);
+    uint64_t normalised = value << (63 - integer_part);
+    int index = (normalised >> 58) & 31;
+    int32_t fraction = (normalised >> 42) & 0xffff;
+    int32_t low = LOG2_TABLE[index];
+    int32_t high = LOG2_TABLE[index + 1];
+    return (integer_part << 16) + low + (((high - low) * fraction) >> 16);
+}
+
+// 2^(i/32) in Q16
+static const int32_t EXP2_TABLE[33] = {
+    65536, 66971, 68438, 69936, 71468, 73032, 74632, 76266, 77936, 79642, 81386,
+    83169, 84990, 86851, 88752, 90696, 92682, 94711, 96785, 98905, 101070, 103283,
+    105545, 107856, 110218, 112631, 115098, 117618, 120194, 122825, 125515, 128263, 131072};
+
+// integer 2^x for x in Q16 (which must be less than 32) rounded down - the top 5 bits of the fraction pick an entry
+// in the table and the rest interpolate to the next entry
+static inline uint32_t exp2_fixed(int32_t x)
+{
+    if (x < 0)
+    {
+        return 0;
+    }
+    int integer_part = x >> 16;
+    int index = (x >> 11) & 31;
+    int32_t fraction = x & 0x7ff;
+    int32_t low = EXP2_TABLE[index];
+    int32_t high = EXP2_TABLE[index + 1];
+    uint32_t mantissa = low + (((high - low) * fraction) >> 11);
+    return integer_part >= 16 ? mantissa << (integer_part - 16) : mantissa >> (16 - integer_part);
+}
+
+AudioProcessor::AudioProcessor(int audio_length, int window_size, int step_size, int pooling_size, bool streaming, bool fixed_point, int mel_bands, bool noise_reduction,
+                               int workers)
 {
     m_audio_length = audio_length;
     m_window_size = window_size;
     m_step_size = step_size;
     m_pooling_size = pooling_size;
+    m_fixed_point = fixed_point;
     m_fft_size = 1;
-    while (m_fft_size < window_size)
+    m_fft_size_log2 = 0;
+    while (m_fft_size < (size_t)window_size)
     {
         m_fft_size <<= 1;
+        m_fft_size_log2++;
     }
-    m_fft_input = static_cast<float *>(malloc(sizeof(float) * m_fft_size));
     m_energy_size = m_fft_size / 2 + 1;
-    m_fft_output = static_cast<kiss_fft_cpx *>(malloc(sizeof(kiss_fft_cpx) * m_energy_size));
-    m_energy = static_cast<float *>(malloc(sizeof(float) * m_energy_size));
-    // work out the pooled energy size
-    m_pooled_energy_size = ceilf((float)m_energy_size / (float)pooling_size);
+    // work out the pooled energy size - or use a mel filterbank instead of pooling
+    m_mel_filterbank = NULL;
+    if (mel_bands > 0)
+    {
+        m_mel_filterbank = get_cached_mel_filterbank(m_fft_size, mel_bands, SAMPLE_RATE, MEL_LOW_FREQUENCY, MEL_HIGH_FREQUENCY);
+        m_pooled_energy_size = mel_bands;
+    }
+    else
+    {
+        m_pooled_energy_size = ceilf((float)m_energy_size / (float)pooling_size);
+    }
     printf("m_pooled_energy_size=%d\n", m_pooled_energy_size);
-    // initialise kiss fftr
-    m_cfg = kiss_fftr_alloc(m_fft_size, false, 0, 0);
-    // initialise the hamming window
-    m_hamming_window = new HammingWindow(m_window_size);
+    m_noise_reduction = NULL;
+    m_channel_signal = NULL;
+    if (noise_reduction)
+    {
+        m_noise_reduction = new NoiseReductionPCAN(m_pooled_energy_size);
+        m_channel_signal = static_cast<uint32_t *>(malloc(sizeof(uint32_t) * m_pooled_energy_size));
+    }
+    m_noise_reduction_hop = 0;
+    m_noise_reduction_cycles = 0;
+    m_noise_reduction_frames = 0;
+    // the workers come from a pool that lives for the life of the app so we don't create tasks every time
+    m_worker_pool = get_worker_pool(workers);
+    m_number_of_workers = m_worker_pool->getNumberOfWorkers();
+    // each worker needs its own fft plan - the plans, their buffers and the hamming window come from the cache so
+    // creating a processor again is quick
+    m_fft_plans = static_cast<FFTPlan **>(malloc(sizeof(FFTPlan *) * m_number_of_workers));
+    for (int worker = 0; worker < m_number_of_workers; worker++)
+    {
+        m_fft_plans[worker] = acquire_fft_plan(m_fft_size, m_window_size, m_fixed_point);
+    }
+    // the hamming window and the normalised copies of it we use to window the samples - the copies may have been
+    // scaled by whoever had the plans before so they always need setting up
+    m_hamming_window = get_cached_hamming_window(m_window_size);
+    m_window_scale = 0;
+    set_window_scale(1.0f);
+    m_frame_cycles = 0;
+    m_frames_computed = 0;
+    // work out how many rows of spectrogram we produce for each run
+    m_number_of_rows = (m_audio_length - m_window_size + m_step_size - 1) / m_step_size;
+    // the list of frames for the workers to compute
+    m_frame_reader = NULL;
+    m_frame_starts = static_cast<uint64_t *>(malloc(sizeof(uint64_t) * m_number_of_rows));
+    m_frame_rows = static_cast<int *>(malloc(sizeof(int) * m_number_of_rows));
+    m_frame_update_noise = static_cast<bool *>(malloc(sizeof(bool) * m_number_of_rows));
+    m_frame_count = 0;
+    m_active_workers = 1;
+    m_frame_mean = 0;
+    m_frame_take_log = false;
+    m_frame_output = NULL;
+    m_fixed_frame_output = NULL;
+    m_frame_dc_output = NULL;
+    // the fixed point rows are converted once they have all been computed - in streaming mode they go in the row cache
+    m_fixed_pooled_energy = NULL;
+    if (m_fixed_point && !streaming)
+    {
+        m_fixed_pooled_energy = static_cast<uint64_t *>(malloc(sizeof(uint64_t) * m_number_of_rows * m_pooled_energy_size));
+    }
+    // set up the row cache for streaming mode
+    m_streaming = streaming;
+    m_row_cache = NULL;
+    m_fixed_row_cache = NULL;
+    m_row_cache_hops = NULL;
+    m_row_cache_valid = NULL;
+    m_window_stats = NULL;
+    m_dc_bins = 0;
+    m_dc_spectrum = NULL;
+    m_dc_offsets = NULL;
+    m_dc_energy = NULL;
+    m_row_cache_means = NULL;
+    m_row_dc_terms = NULL;
+    m_dc_row = NULL;
+    m_fixed_dc_row = NULL;
+    m_output_scale = 1.0f;
+    m_output_zero_point = 0;
+    m_quantize_buffer = NULL;
+    if (m_streaming)
+    {
+        if (m_fixed_point)
+        {
+            m_fixed_row_cache = static_cast<uint64_t *>(malloc(sizeof(uint64_t) * m_number_of_rows * m_pooled_energy_size));
+        }
+        else
+        {
+            m_row_cache = static_cast<float *>(malloc(sizeof(float) * m_number_of_rows * m_pooled_energy_size));
+        }
+        m_row_cache_hops = static_cast<uint64_t *>(malloc(sizeof(uint64_t) * m_number_of_rows));
+        m_row_cache_valid = static_cast<bool *>(calloc(m_number_of_rows, sizeof(bool)));
+        // the normalisation can be kept up to date a hop at a time if the window is a whole number of hops
+        if (m_audio_length % m_step_size == 0)
+        {
+            m_window_stats = new SlidingWindowStats(m_step_size, m_audio_length / m_step_size);
+        }
+        // the noise reduction output isn't linear in the energy so those rows keep the mean they were computed with
+        if (!m_noise_reduction)
+        {
+            setup_dc_correction();
+        }
+    }
 }
 
 AudioProcessor::~AudioProcessor()
 {
-    free(m_cfg);
-    free(m_fft_input);
-    free(m_fft_output);
-    free(m_energy);
-    delete m_hamming_window;
-}
-
-// takes a normalised array of input samples of window_size length
-void AudioProcessor::get_spectrogram_segment(float *output)
-{
-    // apply the hamming window to the samples
-    m_hamming_window->applyWindow(m_fft_input);
-    // do the fft
-    kiss_fftr(
-        m_cfg,
-        m_fft_input,
-        reinterpret_cast<kiss_fft_cpx *>(m_fft_output));
-    // pull out the magnitude squared values
-    for (int i = 0; i < m_energy_size; i++)
-    {
-        const float real = m_fft_output[i].r;
-        const float imag = m_fft_output[i].i;
-        const float mag_squared = (real * real) + (imag * imag);
-        m_energy[i] = mag_squared;
-    }
-    // reduce the size of the output by pooling with average and same padding
-    float *output_src = m_energy;
-    float *output_dst = output;
+    // the plans, hamming window and mel filterbank belong to the cache
+    for (int worker = 0; worker < m_number_of_workers; worker++)
+    {
+        release_fft_plan(m_fft_plans[worker]);
+    }
+    free(m_fft_plans);
+    free(m_frame_starts);
+    free(m_frame_rows);
+    free(m_frame_update_noise);
+    free(m_fixed_pooled_energy);
+    free(m_row_cache);
+    free(m_fixed_row_cache);
+    free(m_row_cache_hops);
+    free(m_row_cache_valid);
+    delete m_window_stats;
+    free(m_dc_spectrum);
+    free(m_dc_offsets);
+    free(m_dc_energy);
+    free(m_row_cache_means);
+    free(m_row_dc_terms);
+    free(m_dc_row);
+    free(m_fixed_dc_row);
+    free(m_quantize_buffer);
+    delete m_noise_reduction;
+    free(m_channel_signal);
+}
+
+// the fft bins that are pooled into a bin of the output (or that a mel filter covers)
+void AudioProcessor::get_pooled_bin(int bin, int &start, int &length)
+{
+    if (m_mel_filterbank)
+    {
+        start = m_mel_filterbank->getStart(bin);
+        length = m_mel_filterbank->getLength(bin);
+        return;
+    }
+    start = bin * m_pooling_size;
+    length = std::min(m_pooling_size, m_energy_size - start);
+}
+
+// works out the window's spectrum by putting a constant 1 through the same window and fft as the frames, and from that
+// which pooled bins need correcting when the mean changes
+void AudioProcessor::setup_dc_correction()
+{
+    FFTPlan *plan = m_fft_plans[0];
+    kiss_fft_cpx *spectrum = static_cast<kiss_fft_cpx *>(malloc(sizeof(kiss_fft_cpx) * m_energy_size));
+    if (m_fixed_point)
+    {
+        // a bigger constant so the rounding in the fixed point fft doesn't matter
+        const int amplitude = 1024;
+        for (size_t i = 0; i < m_fft_size; i++)
+        {
+            plan->fixed_input[i] = (int)i < m_window_size ? amplitude << 8 : 0;
+        }
+        m_hamming_window->applyWindow(plan->fixed_input);
+        kiss_fftr_fixed(plan->fixed_cfg, plan->fixed_input, plan->fixed_output);
+        for (int i = 0; i < m_energy_size; i++)
+        {
+            spectrum[i].r = (float)plan->fixed_output[i].r / amplitude;
+            spectrum[i].i = (float)plan->fixed_output[i].i / amplitude;
+        }
+    }
+    else
+    {
+        const float *coefficients = m_hamming_window->getCoefficients();
+        for (size_t i = 0; i < m_fft_size; i++)
+        {
+            plan->input[i] = (int)i < m_window_size ? coefficients[i] : 0;
+        }
+        if (!static_real_fft(m_fft_size, plan->input, plan->output))
+        {
+            kiss_fftr(plan->cfg, plan->input, plan->output);
+        }
+        memcpy(spectrum, plan->output, sizeof(kiss_fft_cpx) * m_energy_size);
+    }
+    // the weights are the same as the ones that pool the frames - the fixed point energies are divided by the pooling size later
+    const float pooling_weight = m_fixed_point ? 1.0f : 1.0f / m_pooling_size;
+    m_dc_energy = static_cast<float *>(malloc(sizeof(float) * m_pooled_energy_size));
+    m_dc_offsets = static_cast<int *>(malloc(sizeof(int) * m_pooled_energy_size));
+    float max_energy = 0;
+    int spectrum_size = 0;
+    for (int bin = 0; bin < m_pooled_energy_size; bin++)
+    {
+        int start, length;
+        get_pooled_bin(bin, start, length);
+        float energy = 0;
+        for (int j = 0; j < length; j++)
+        {
+            const kiss_fft_cpx &value = spectrum[start + j];
+            energy += (m_mel_filterbank ? m_mel_filterbank->getWeights(bin)[j] : pooling_weight) * (value.r * value.r + value.i * value.i);
+        }
+        m_dc_energy[bin] = energy;
+        m_dc_offsets[bin] = spectrum_size;
+        spectrum_size += length;
+        max_energy = std::max(max_energy, energy);
+    }
+    for (int bin = 0; bin < m_pooled_energy_size; bin++)
+    {
+        if (m_dc_energy[bin] >= max_energy * DC_CORRECTION_THRESHOLD)
+        {
+            m_dc_bins = bin + 1;
+        }
+    }
+    // keep the weighted spectrum of just the bins we correct
+    m_dc_spectrum = static_cast<kiss_fft_cpx *>(malloc(sizeof(kiss_fft_cpx) * (m_dc_bins < m_pooled_energy_size ? m_dc_offsets[m_dc_bins] : spectrum_size)));
+    for (int bin = 0; bin < m_dc_bins; bin++)
+    {
+        int start, length;
+        get_pooled_bin(bin, start, length);
+        kiss_fft_cpx *weighted = m_dc_spectrum + m_dc_offsets[bin];
+        for (int j = 0; j < length; j++)
+        {
+            float weight = m_mel_filterbank ? m_mel_filterbank->getWeights(bin)[j] : pooling_weight;
+            weighted[j].r = spectrum[start + j].r * weight;
+            weighted[j].i = spectrum[start + j].i * weight;
+        }
+    }
+    free(spectrum);
+    m_row_cache_means = static_cast<float *>(malloc(sizeof(float) * m_number_of_rows));
+    m_row_dc_terms = static_cast<float *>(malloc(sizeof(float) * m_number_of_rows * m_dc_bins));
+    if (m_fixed_point)
+    {
+        m_fixed_dc_row = static_cast<uint64_t *>(malloc(sizeof(uint64_t) * m_pooled_energy_size));
+    }
+    else
+    {
+        m_dc_row = static_cast<float *>(malloc(sizeof(float) * m_pooled_energy_size));
+    }
+}
+
+// the pooled sums of the fft output times the window's spectrum - how much each bin's energy changes with the mean
+void AudioProcessor::get_dc_terms(const kiss_fft_cpx *fft_output, float *dc_terms)
+{
+    for (int bin = 0; bin < m_dc_bins; bin++)
+    {
+        int start, length;
+        get_pooled_bin(bin, start, length);
+        const kiss_fft_cpx *bins = fft_output + start;
+        const kiss_fft_cpx *weighted = m_dc_spectrum + m_dc_offsets[bin];
+        float sum = 0;
+        for (int j = 0; j < length; j++)
+        {
+            sum += bins[j].r * weighted[j].r + bins[j].i * weighted[j].i;
+        }
+        dc_terms[bin] = sum;
+    }
+}
+
+void AudioProcessor::get_dc_terms_fixed(const kiss_fft_fixed_cpx *fft_output, float *dc_terms)
+{
+    for (int bin = 0; bin < m_dc_bins; bin++)
+    {
+        int start, length;
+        get_pooled_bin(bin, start, length);
+        const kiss_fft_fixed_cpx *bins = fft_output + start;
+        const kiss_fft_cpx *weighted = m_dc_spectrum + m_dc_offsets[bin];
+        float sum = 0;
+        for (int j = 0; j < length; j++)
+        {
+            sum += (float)bins[j].r * weighted[j].r + (float)bins[j].i * weighted[j].i;
+        }
+        dc_terms[bin] = sum;
+    }
+}
+
+// how much a cached bin's energy changes when difference more is taken off the samples
+inline float AudioProcessor::get_dc_correction(int bin, const float *dc_terms, float difference)
+{
+    return difference * (difference * m_dc_energy[bin] - 2.0f * dc_terms[bin]);
+}
+
+// takes a normalised and windowed array of input samples of fft_size length and outputs the pooled energy - if
+// take_log is set it outputs the log of the pooled energy. The power, pooling and log are done in a single pass
+// over the fft output. If dc_terms is set they're worked out for the bins that need correcting when the mean changes.
+void AudioProcessor::get_pooled_energy_segment(FFTPlan *plan, float *output, bool take_log, float *dc_terms)
+{
+    const kiss_fft_cpx *fft_output = plan->output;
+    // do the fft - falling back to kiss fftr if there isn't a compile time version for this size
+    if (!static_real_fft(m_fft_size, plan->input, plan->output))
+    {
+        kiss_fftr(
+            plan->cfg,
+            plan->input,
+            plan->output);
+    }
+    if (dc_terms)
+    {
+        get_dc_terms(fft_output, dc_terms);
+    }
+    if (m_mel_filterbank)
+    {
+        // the mel band energies are the weighted sums of the magnitude squared values of the bins each filter covers
+        for (int band = 0; band < m_pooled_energy_size; band++)
+        {
+            const kiss_fft_cpx *bins = fft_output + m_mel_filterbank->getStart(band);
+            const float *weights = m_mel_filterbank->getWeights(band);
+            int length = m_mel_filterbank->getLength(band);
+            float sum = 0;
+            for (int j = 0; j < length; j++)
+            {
+                sum += weights[j] * ((bins[j].r * bins[j].r) + (bins[j].i * bins[j].i));
+            }
+            output[band] = take_log ? fast_log10f(sum + EPSILON) : sum;
+        }
+        return;
+    }
+    // reduce the size of the output by pooling the magnitude squared values with average and same padding
+    const float pooling_scale = 1.0f / m_pooling_size;
     for (int i = 0; i < m_energy_size; i += m_pooling_size)
     {
-        float average = 0;
-        for (int j = 0; j < m_pooling_size; j++)
+        int end = std::min(i + m_pooling_size, m_energy_size);
+        float sum = 0;
+        for (int j = i; j < end; j++)
+        {
+            const float real = fft_output[j].r;
+            const float imag = fft_output[j].i;
+            sum += (real * real) + (imag * imag);
+        }
+        float average = sum * pooling_scale;
+        // take the log to give us reasonable values to feed into the network
+        *output = take_log ? fast_log10f(average + EPSILON) : average;
+        output++;
+    }
+}
+
+#if SPECTROGRAM_BATCH_FRAMES > 0
+// batched version of read_window and get_pooled_energy_segment - computes the rows for up to SPECTROGRAM_BATCH_FRAMES
+// windows of samples at once. The frames are stored side by side so every step is a loop over the frames that
+// the compiler can vectorise.
+void AudioProcessor::get_pooled_energy_batch(FFTPlan *plan, RingBufferAccessor *reader, const uint64_t *window_starts, int count, float mean, float **output,
+                                             bool take_log, float **dc_terms)
+{
+    const int lanes = SPECTROGRAM_BATCH_FRAMES;
+    // copy the samples of each window into its column of the input - any unused columns just hold old samples
+    for (int frame = 0; frame < count; frame++)
+    {
+        RingBufferSpan spans[2];
+        int span_count = reader->getSpans(window_starts[frame], m_window_size, spans);
+        float *column = plan->batch_input + frame;
+        for (int span = 0; span < span_count; span++)
+        {
+            const int16_t *samples = spans[span].samples;
+            int length = spans[span].length;
+            for (int i = 0; i < length; i++)
+            {
+                *column = samples[i];
+                column += lanes;
+            }
+        }
+    }
+    // remove the mean and apply the window to all the frames at once
+    float *row = plan->batch_input;
+    for (int i = 0; i < m_window_size; i++)
+    {
+        const float window = plan->window_coefficients[i];
+        for (int l = 0; l < lanes; l++)
+        {
+            row[l] = (row[l] - mean) * window;
+        }
+        row += lanes;
+    }
+    typedef BatchComplex<lanes> Batch;
+    Batch *fft_output = reinterpret_cast<Batch *>(plan->batch_output);
+    batched_real_fft<lanes>(m_fft_size, plan->batch_input, fft_output);
+    for (int bin = 0; dc_terms && bin < m_dc_bins; bin++)
+    {
+        int start, length;
+        get_pooled_bin(bin, start, length);
+        const Batch *bins = fft_output + start;
+        const kiss_fft_cpx *weighted = m_dc_spectrum + m_dc_offsets[bin];
+        float sums[lanes] = {0};
+        for (int j = 0; j < length; j++)
+        {
+            for (int l = 0; l < lanes; l++)
+            {
+                sums[l] += bins[j].r[l] * weighted[j].r + bins[j].i[l] * weighted[j].i;
+            }
+        }
+        for (int frame = 0; frame < count; frame++)
+        {
+            dc_terms[frame][bin] = sums[frame];
+        }
+    }
+    // pool the magnitude squared values (or apply the mel filters to them) and take the log for all the frames at once
+    const float pooling_scale = 1.0f / m_pooling_size;
+    const float epsilon = EPSILON;
+    for (int i = 0, bin = 0; bin < m_pooled_energy_size; i += m_pooling_size, bin++)
+    {
+        float values[lanes] = {0};
+        if (m_mel_filterbank)
+        {
+            const Batch *bins = fft_output + m_mel_filterbank->getStart(bin);
+            const float *weights = m_mel_filterbank->getWeights(bin);
+            int length = m_mel_filterbank->getLength(bin);
+            for (int j = 0; j < length; j++)
+            {
+                for (int l = 0; l < lanes; l++)
+                {
+                    values[l] += weights[j] * (bins[j].r[l] * bins[j].r[l] + bins[j].i[l] * bins[j].i[l]);
+                }
+            }
+        }
+        else
+        {
+            int end = std::min(i + m_pooling_size, m_energy_size);
+            for (int j = i; j < end; j++)
+            {
+                for (int l = 0; l < lanes; l++)
+                {
+                    values[l] += fft_output[j].r[l] * fft_output[j].r[l] + fft_output[j].i[l] * fft_output[j].i[l];
+                }
+            }
+            for (int l = 0; l < lanes; l++)
+            {
+                values[l] *= pooling_scale;
+            }
+        }
+        for (int l = 0; l < lanes; l++)
+        {
+            values[l] = take_log ? fast_log10f(values[l] + epsilon) : values[l];
+        }
+        for (int frame = 0; frame < count; frame++)
+        {
+            output[frame][bin] = values[frame];
+        }
+    }
+}
+#endif
+
+// scale the window coefficients of every worker's plan so that windowing the samples also normalises them
+void AudioProcessor::set_window_scale(float scale)
+{
+    if (scale != m_window_scale)
+    {
+        const float *coefficients = m_hamming_window->getCoefficients();
+        for (int worker = 0; worker < m_number_of_workers; worker++)
+        {
+            float *window_coefficients = m_fft_plans[worker]->window_coefficients;
+            for (int i = 0; i < m_window_size; i++)
+            {
+                window_coefficients[i] = coefficients[i] * scale;
+            }
+        }
+        m_window_scale = scale;
+    }
+}
+
+// fixed point version of get_pooled_energy_segment - takes a window of Q8 (sample - mean) values and outputs the
+// sums of the pooled energy
+void AudioProcessor::get_pooled_energy_segment_fixed(FFTPlan *plan, uint64_t *output, float *dc_terms)
+{
+    const kiss_fft_fixed_cpx *fft_output = plan->fixed_output;
+    // apply the hamming window to the samples - this turns them into Q31
+    m_hamming_window->applyWindow(plan->fixed_input);
+    // do the fft - the output is scaled down by the fft size
+    kiss_fftr_fixed(plan->fixed_cfg, plan->fixed_input, plan->fixed_output);
+    if (dc_terms)
+    {
+        get_dc_terms_fixed(fft_output, dc_terms);
+    }
+    // pool the magnitude squared values - the total energy can't be more than the energy of the Q31
+    // input divided by the fft size so the sums fit in 64 bits. The division by the pooling size is
+    // left to get_spectrogram_segment_fixed.
+    if (m_mel_filterbank)
+    {
+        // the weights are Q16 and no more than 1 so the weighted sums fit too - the energy is split into its
+        // top and bottom 16 bits so the products don't overflow
+        for (int band = 0; band < m_pooled_energy_size; band++)
+        {
+            const kiss_fft_fixed_cpx *bins = fft_output + m_mel_filterbank->getStart(band);
+            const uint32_t *weights = m_mel_filterbank->getFixedWeights(band);
+            int length = m_mel_filterbank->getLength(band);
+            uint64_t sum = 0;
+            for (int j = 0; j < length; j++)
+            {
+                const int64_t real = bins[j].r;
+                const int64_t imag = bins[j].i;
+                uint64_t energy = (uint64_t)(real * real) + (uint64_t)(imag * imag);
+                sum += (energy >> 16) * weights[j] + (((energy & 0xffff) * weights[j]) >> 16);
+            }
+            output[band] = sum;
+        }
+        return;
+    }
+    for (int i = 0; i < m_energy_size; i += m_pooling_size)
+    {
+        int end = std::min(i + m_pooling_size, m_energy_size);
+        uint64_t sum = 0;
+        for (int j = i; j < end; j++)
+        {
+            const int64_t real = fft_output[j].r;
+            const int64_t imag = fft_output[j].i;
+            sum += (uint64_t)(real * real) + (uint64_t)(imag * imag);
+        }
+        *output = sum;
+        output++;
+    }
+}
+
+// works out how to turn the fixed point pooled energy into the same values as the float version - the float
+// energy is the fixed point energy * fft_size^2 / (2^30 * max^2 * pooling_size). We work out the log2 of the
+// divisor and the float version's epsilon scaled up by the same amount. The mel energies aren't averaged so
+// there's no pooling size in mel mode.
+void AudioProcessor::get_log_scale_fixed(float max, int32_t &log2_scale, uint64_t &epsilon)
+{
+    // the output of the noise reduction is already normalised - match the float version's log10(x + 1)
+    if (m_noise_reduction)
+    {
+        log2_scale = 0;
+        epsilon = 1;
+        return;
+    }
+    uint64_t divisor = std::max<uint64_t>(1, (uint64_t)(max * max + 0.5f)) * (m_mel_filterbank ? 1 : m_pooling_size);
+    int shift = 30 - 2 * m_fft_size_log2;
+    log2_scale = log2_fixed(divisor) + shift * 65536;
+    divisor = shift >= 0 ? divisor << shift : divisor >> -shift;
+    epsilon = std::max<uint64_t>(1, divisor * EPSILON);
+}
+
+// takes a row of fixed point pooled energy and outputs the log10 of the normalised energy
+void AudioProcessor::get_spectrogram_segment_fixed(const uint64_t *pooled_energy, int32_t log2_scale, uint64_t epsilon, float *output)
+{
+    for (int i = 0; i < m_pooled_energy_size; i++)
+    {
+        output[i] = (log2_fixed(pooled_energy[i] + epsilon) - log2_scale) * LOG10_2_Q16;
+    }
+}
+
+// the noise estimates should only see each hop once and in order - rows that include samples that haven't been
+// written yet will be computed again so they don't count
+bool AudioProcessor::should_update_noise_estimate(uint64_t hop, bool complete)
+{
+    if (!complete || hop < m_noise_reduction_hop)
+    {
+        return false;
+    }
+    m_noise_reduction_hop = hop + 1;
+    return true;
+}
+
+// replaces a row of pooled energy (that hasn't been normalised) with the output of the noise reduction and PCAN -
+// the channels go in as amplitudes
+void AudioProcessor::apply_noise_reduction(float *pooled_energy, bool update)
+{
+    uint32_t start = get_cycle_count();
+    for (int i = 0; i < m_pooled_energy_size; i++)
+    {
+        m_channel_signal[i] = sqrtf(pooled_energy[i]);
+    }
+    m_noise_reduction->process(m_channel_signal, update);
+    for (int i = 0; i < m_pooled_energy_size; i++)
+    {
+        pooled_energy[i] = m_channel_signal[i];
+    }
+    m_noise_reduction_cycles += get_cycle_count() - start;
+    m_noise_reduction_frames++;
+}
+
+// fixed point version of apply_noise_reduction - the float energy is the fixed point energy * fft_size^2 / (2^30 * pooling_size)
+// so the amplitude is sqrt(energy / pooling_size) * fft_size / 2^15. The square root is done as 2^(log2(x) / 2) which is
+// much quicker than an integer square root and easily accurate enough.
+void AudioProcessor::apply_noise_reduction_fixed(uint64_t *pooled_energy, bool update)
+{
+    uint32_t start = get_cycle_count();
+    int32_t log2_offset = log2_fixed(m_mel_filterbank ? 1 : m_pooling_size) + (30 - 2 * m_fft_size_log2) * 65536;
+    for (int i = 0; i < m_pooled_energy_size; i++)
+    {
+        m_channel_signal[i] = exp2_fixed((log2_fixed(pooled_energy[i] + 1) - log2_offset) / 2);
+    }
+    m_noise_reduction->process(m_channel_signal, update);
+    for (int i = 0; i < m_pooled_energy_size; i++)
+    {
+        pooled_energy[i] = m_channel_signal[i];
+    }
+    m_noise_reduction_cycles += get_cycle_count() - start;
+    m_noise_reduction_frames++;
+}
+
+// works out the mean and the absolute max (taking into account the mean) of the audio starting at start
+void AudioProcessor::get_normalisation(RingBufferAccessor *reader, uint64_t start, float &mean, float &max)
+{
+    RingBufferSpan spans[2];
+    int span_count = reader->getSpans(start, m_audio_length, spans);
+    // sum up the samples and find the range - these are simple loops over contiguous memory so they vectorise well
+    int64_t sum = 0;
+    int16_t min_sample = INT16_MAX;
+    int16_t max_sample = INT16_MIN;
+    for (int span = 0; span < span_count; span++)
+    {
+        const int16_t *samples = spans[span].samples;
+        int length = spans[span].length;
+        // a span is at most the size of the ring buffer so a 32 bit sum cannot overflow
+        int32_t span_sum = 0;
+        for (int i = 0; i < length; i++)
+        {
+            span_sum += samples[i];
+            min_sample = std::min(min_sample, samples[i]);
+            max_sample = std::max(max_sample, samples[i]);
+        }
+        sum += span_sum;
+    }
+    mean = (float)sum / m_audio_length;
+    max = std::max((float)max_sample - mean, mean - (float)min_sample);
+}
+
+// reads a window of samples starting at start into the fft input as (sample - mean) * window - the window
+// coefficients include the scale set by set_window_scale so this is the only pass over the samples
+void AudioProcessor::read_window(FFTPlan *plan, RingBufferAccessor *reader, uint64_t start, float mean)
+{
+    RingBufferSpan spans[2];
+    int span_count = reader->getSpans(start, m_window_size, spans);
+    float *fft_input = plan->input;
+    const float *window = plan->window_coefficients;
+    for (int span = 0; span < span_count; span++)
+    {
+        const int16_t *samples = spans[span].samples;
+        int length = spans[span].length;
+        for (int i = 0; i < length; i++)
+        {
+            fft_input[i] = ((float)samples[i] - mean) * window[i];
+        }
+        fft_input += length;
+        window += length;
+    }
+    // zero out whatever else remains in the top part of the input.
+    for (size_t i = m_window_size; i < m_fft_size; i++)
+    {
+        plan->input[i] = 0;
+    }
+}
+
+// reads a window of samples starting at start into the fixed point fft input as sample - mean in Q8 - we need
+// the fraction of the mean otherwise the rounding error shows up in the lowest frequency bins
+void AudioProcessor::read_window_fixed(FFTPlan *plan, RingBufferAccessor *reader, uint64_t start, int32_t mean)
+{
+    RingBufferSpan spans[2];
+    int span_count = reader->getSpans(start, m_window_size, spans);
+    int32_t *fft_input = plan->fixed_input;
+    for (int span = 0; span < span_count; span++)
+    {
+        const int16_t *samples = spans[span].samples;
+        int length = spans[span].length;
+        for (int i = 0; i < length; i++)
         {
-            if (i + j < m_energy_size)
+            fft_input[i] = (samples[i] << 8) - mean;
+        }
+        fft_input += length;
+    }
+    // zero out whatever else remains in the top part of the input.
+    for (size_t i = m_window_size; i < m_fft_size; i++)
+    {
+        plan->fixed_input[i] = 0;
+    }
+}
+
+// computes the pooled energy of the m_frame_count windows of samples in m_frame_starts - the frames are split between
+// the workers and this returns when they have all finished. The float rows go in output (taking the log if take_log
+// is set) and the fixed point rows go in fixed_output. The rows of dc_output get the terms for correcting them if the mean
+// changes if it's set.
+void AudioProcessor::compute_frames(RingBufferAccessor *reader, float mean, bool take_log, float *output, uint64_t *fixed_output, float *dc_output)
+{
+    if (m_frame_count == 0)
+    {
+        return;
+    }
+    uint32_t start = get_cycle_count();
+    m_frame_reader = reader;
+    m_frame_mean = mean;
+    m_frame_take_log = take_log;
+    m_frame_output = output;
+    m_fixed_frame_output = fixed_output;
+    m_frame_dc_output = dc_output;
+    // normally there's only a new frame or two so it's quicker to do them on this core
+    if (m_frame_count >= m_number_of_workers * MIN_FRAMES_PER_WORKER)
+    {
+        m_active_workers = m_number_of_workers;
+        m_worker_pool->run(compute_frames_job, this);
+    }
+    else
+    {
+        m_active_workers = 1;
+        compute_frames_worker(0);
+    }
+    // with more than one worker this is the time it took to compute all the frames divided by the number of frames
+    m_frame_cycles += get_cycle_count() - start;
+    m_frames_computed += m_frame_count;
+}
+
+void AudioProcessor::compute_frames_job(void *context, int worker)
+{
+    static_cast<AudioProcessor *>(context)->compute_frames_worker(worker);
+}
+
+// computes this worker's share of the frames - the frames are split into equal runs of whole batches so that only
+// the last run can have a partial batch in it
+void AudioProcessor::compute_frames_worker(int worker)
+{
+    FFTPlan *plan = m_fft_plans[worker];
+    int batch_size = 1;
+#if SPECTROGRAM_BATCH_FRAMES > 0
+    if (plan->batch_input)
+    {
+        batch_size = SPECTROGRAM_BATCH_FRAMES;
+    }
+#endif
+    int batches = (m_frame_count + batch_size - 1) / batch_size;
+    int first = batches * worker / m_active_workers * batch_size;
+    int last = std::min(m_frame_count, batches * (worker + 1) / m_active_workers * batch_size);
+#if SPECTROGRAM_BATCH_FRAMES > 0
+    if (plan->batch_input)
+    {
+        float *outputs[SPECTROGRAM_BATCH_FRAMES];
+        float *dc_outputs[SPECTROGRAM_BATCH_FRAMES];
+        for (int frame = first; frame < last; frame += SPECTROGRAM_BATCH_FRAMES)
+        {
+            int count = std::min(SPECTROGRAM_BATCH_FRAMES, last - frame);
+            for (int i = 0; i < count; i++)
             {
-                average += *output_src;
-                output_src++;
+                outputs[i] = m_frame_output + m_frame_rows[frame + i] * m_pooled_energy_size;
+                dc_outputs[i] = m_frame_dc_output + m_frame_rows[frame + i] * m_dc_bins;
             }
+            get_pooled_energy_batch(plan, m_frame_reader, m_frame_starts + frame, count, m_frame_mean, outputs, m_frame_take_log,
+                                    m_frame_dc_output ? dc_outputs : NULL);
         }
-        *output_dst = average / m_pooling_size;
-        output_dst++;
+        return;
     }
-    // now take the log to give us reasonable values to feed into the network
+#endif
+    for (int frame = first; frame < last; frame++)
+    {
+        int row_offset = m_frame_rows[frame] * m_pooled_energy_size;
+        float *dc_terms = m_frame_dc_output ? m_frame_dc_output + m_frame_rows[frame] * m_dc_bins : NULL;
+        if (m_fixed_point)
+        {
+            // the fixed point version only removes the mean - the normalisation is done in the log
+            read_window_fixed(plan, m_frame_reader, m_frame_starts[frame], lroundf(m_frame_mean * 256.0f));
+            get_pooled_energy_segment_fixed(plan, m_fixed_frame_output + row_offset, dc_terms);
+        }
+        else
+        {
+            // read samples into the fft input removing the mean (and normalising them if the window has been scaled)
+            read_window(plan, m_frame_reader, m_frame_starts[frame], m_frame_mean);
+            get_pooled_energy_segment(plan, m_frame_output + row_offset, m_frame_take_log, dc_terms);
+        }
+    }
+}
+
+// runs the rows of a spectrogram of pooled energy through the noise reduction in order and takes the log
+void AudioProcessor::apply_noise_reduction_to_spectrogram(float *spectrogram)
+{
+    if (!m_noise_reduction)
+    {
+        return;
+    }
+    for (int row = 0; row < m_number_of_rows; row++)
+    {
+        apply_noise_reduction(spectrogram, true);
+        for (int i = 0; i < m_pooled_energy_size; i++)
+        {
+            spectrogram[i] = fast_log10f(spectrogram[i] + 1.0f);
+        }
+        spectrogram += m_pooled_energy_size;
+    }
+}
+
+void AudioProcessor::set_output_quantization(float scale, int zero_point)
+{
+    m_output_scale = scale;
+    m_output_zero_point = zero_point;
+}
+
+// quantizes a row of the spectrogram the same way as the model's quantize op would
+void AudioProcessor::quantize_row(const float *row, int8_t *output)
+{
+    const float inverse_scale = 1.0f / m_output_scale;
     for (int i = 0; i < m_pooled_energy_size; i++)
     {
-        output[i] = log10f(output[i] + EPSILON);
+        int32_t value = lrintf(row[i] * inverse_scale) + m_output_zero_point;
+        output[i] = value < -128 ? -128 : (value > 127 ? 127 : value);
+    }
+}
+
+int AudioProcessor::get_spectrogram(RingBufferAccessor *reader, float *output_spectrogram)
+{
+    return compute_spectrogram(reader, output_spectrogram, NULL);
+}
+
+int AudioProcessor::get_spectrogram(RingBufferAccessor *reader, int8_t *output_spectrogram)
+{
+    if (!m_quantize_buffer)
+    {
+        // the float non streaming path runs the noise reduction over the whole spectrogram once it has been computed so
+        // it needs all the rows, the other paths produce the rows one at a time
+        bool whole_spectrogram = !m_streaming && !m_fixed_point;
+        m_quantize_buffer = static_cast<float *>(malloc(sizeof(float) * (whole_spectrogram ? get_spectrogram_size() : m_pooled_energy_size)));
     }
+    return compute_spectrogram(reader, NULL, output_spectrogram);
+}
+
+int AudioProcessor::get_spectrogram_rows(RingBufferAccessor *reader, float *output_rows, int number_of_rows)
+{
+    return get_spectrogram_streaming(reader, output_rows, NULL, m_number_of_rows - number_of_rows);
 }
 
-void AudioProcessor::get_spectrogram(RingBufferAccessor *reader, float *output_spectrogram)
+int AudioProcessor::get_spectrogram_rows(RingBufferAccessor *reader, int8_t *output_rows, int number_of_rows)
 {
-    int startIndex = reader->getIndex();
-    // get the mean value of the samples
-    float mean = 0;
-    for (int i = 0; i < m_audio_length; i++)
+    if (!m_quantize_buffer)
+    {
+        m_quantize_buffer = static_cast<float *>(malloc(sizeof(float) * m_pooled_energy_size));
+    }
+    return get_spectrogram_streaming(reader, NULL, output_rows, m_number_of_rows - number_of_rows);
+}
+
+// only one of output_spectrogram and quantized_output is set
+int AudioProcessor::compute_spectrogram(RingBufferAccessor *reader, float *output_spectrogram, int8_t *quantized_output)
+{
+    if (m_streaming)
+    {
+        return get_spectrogram_streaming(reader, output_spectrogram, quantized_output, 0);
+    }
+    uint64_t startIndex = reader->getPosition();
+    // get the mean value of the samples and the absolute max value of the samples taking into account the mean value
+    float mean, max;
+    get_normalisation(reader, startIndex, mean, max);
+    int32_t log2_scale = 0;
+    uint64_t epsilon = 0;
+    if (m_fixed_point)
     {
-        mean += reader->getCurrentSample();
-        reader->moveToNextSample();
+        get_log_scale_fixed(max, log2_scale, epsilon);
     }
-    mean /= m_audio_length;
-    // get the absolute max value of the samples taking into account the mean value
-    reader->setIndex(startIndex);
-    float max = 0;
-    for (int i = 0; i < m_audio_length; i++)
+    else
     {
-        max = std::max(max, fabsf(((float)reader->getCurrentSample()) - mean));
-        reader->moveToNextSample();
+        // normalise the samples by dividing by the absolute max as we window them - the noise reduction does its own normalisation
+        set_window_scale(m_noise_reduction ? 1.0f : 1.0f / max);
     }
-    // extract windows of samples moving forward by step size each time and compute the spectrum of the window
-    for (int window_start = startIndex; window_start < startIndex + 16000 - m_window_size; window_start += m_step_size)
+    // each run is independent so the noise estimates start again from the beginning of the audio
+    if (m_noise_reduction)
     {
-        // move the reader to the start of the window
-        reader->setIndex(window_start);
-        // read samples from the reader into the fft input normalising them by subtracting the mean and dividing by the absolute max
-        for (int i = 0; i < m_window_size; i++)
+        m_noise_reduction->reset();
+    }
+    // extract windows of samples moving forward by step size each time and compute the spectrum of each window
+    m_frame_count = 0;
+    for (uint64_t window_start = startIndex; window_start < startIndex + m_audio_length - m_window_size; window_start += m_step_size)
+    {
+        m_frame_starts[m_frame_count] = window_start;
+        m_frame_rows[m_frame_count] = m_frame_count;
+        m_frame_count++;
+    }
+    if (quantized_output && !m_fixed_point)
+    {
+        output_spectrogram = m_quantize_buffer;
+    }
+    compute_frames(reader, mean, !m_noise_reduction, output_spectrogram, m_fixed_pooled_energy, NULL);
+    if (m_fixed_point)
+    {
+        // the noise reduction has to see the rows in order so it's done once they have all been computed
+        for (int row = 0; row < m_frame_count; row++)
         {
-            m_fft_input[i] = ((float)reader->getCurrentSample() - mean) / max;
-            reader->moveToNextSample();
+            uint64_t *pooled_energy = m_fixed_pooled_energy + row * m_pooled_energy_size;
+            if (m_noise_reduction)
+            {
+                apply_noise_reduction_fixed(pooled_energy, true);
+            }
+            if (quantized_output)
+            {
+                get_spectrogram_segment_fixed(pooled_energy, log2_scale, epsilon, m_quantize_buffer);
+                quantize_row(m_quantize_buffer, quantized_output + row * m_pooled_energy_size);
+            }
+            else
+            {
+                get_spectrogram_segment_fixed(pooled_energy, log2_scale, epsilon, output_spectrogram + row * m_pooled_energy_size);
+            }
         }
-        // zero out whatever else remains in the top part of the input.
-        for (int i = m_window_size; i < m_fft_size; i++)
+    }
+    else
+    {
+        apply_noise_reduction_to_spectrogram(output_spectrogram);
+        for (int row = 0; quantized_output && row < m_number_of_rows; row++)
         {
-            m_fft_input[i] = 0;
+            quantize_row(output_spectrogram + row * m_pooled_energy_size, quantized_output + row * m_pooled_energy_size);
         }
-        // compute the spectrum for the window of samples and write it to the output
-        get_spectrogram_segment(output_spectrogram);
-        // move to the next row of the output spectrogram
-        output_spectrogram += m_pooled_energy_size;
     }
+    // check that the writer didn't overwrite any of the samples while we were working on them
+    return reader->getOverwritten(startIndex);
+}
+
+// Streaming version of get_spectrogram - the window start is aligned to a hop boundary so that
+// rows line up from one run to the next, and only the rows that are not already in the cache are
+// computed. The cache holds the pooled energy of the mean removed samples, the correction for the
+// change in the mean since then, the normalisation by the absolute max and the log are applied when
+// the rows are copied into the output. Only the rows from first_row on are copied.
+int AudioProcessor::get_spectrogram_streaming(RingBufferAccessor *reader, float *output_spectrogram, int8_t *quantized_output, int first_row)
+{
+    // align the start of the window to a hop
+    uint64_t startIndex = reader->getPosition();
+    startIndex -= startIndex % m_step_size;
+    uint64_t start_hop = startIndex / m_step_size;
+    // rows that include samples that haven't been written yet can be used but not cached
+    uint64_t write_position = reader->getWritePosition();
+    // get the mean value of the samples and the absolute max value of the samples taking into account the mean value -
+    // these are kept up to date a hop at a time
+    float mean, max;
+    if (m_window_stats)
+    {
+        m_window_stats->update(reader, start_hop);
+        m_window_stats->get_normalisation(mean, max);
+    }
+    else
+    {
+        get_normalisation(reader, startIndex, mean, max);
+    }
+    // dividing the samples by max scales the energy by 1/max^2 - the noise reduction output is already normalised
+    float energy_scale = m_noise_reduction ? 1.0f : 1.0f / (max * max);
+    float log_epsilon = m_noise_reduction ? 1.0f : EPSILON;
+    int32_t log2_scale = 0;
+    uint64_t epsilon = 0;
+    if (m_fixed_point)
+    {
+        get_log_scale_fixed(max, log2_scale, epsilon);
+    }
+    else
+    {
+        // the cached rows are not normalised
+        set_window_scale(1.0f);
+    }
+    // work out which rows are missing from the cache - after a cold start that's most of them, normally it's just the newest
+    m_frame_count = 0;
+    for (int row = 0; row < m_number_of_rows; row++)
+    {
+        uint64_t hop = start_hop + row;
+        int slot = hop % m_number_of_rows;
+        uint64_t window_start = startIndex + row * m_step_size;
+        if (!m_row_cache_valid[slot] || m_row_cache_hops[slot] != hop)
+        {
+            m_frame_starts[m_frame_count] = window_start;
+            m_frame_rows[m_frame_count] = slot;
+            m_row_cache_hops[slot] = hop;
+            m_row_cache_valid[slot] = window_start + m_window_size <= write_position;
+            m_frame_update_noise[m_frame_count] = m_noise_reduction && should_update_noise_estimate(hop, m_row_cache_valid[slot]);
+            if (m_row_cache_means)
+            {
+                m_row_cache_means[slot] = mean;
+            }
+            m_frame_count++;
+        }
+    }
+    // compute the pooled energy of the missing rows straight into the cache and then run them through the noise
+    // reduction in order
+    compute_frames(reader, mean, false, m_row_cache, m_fixed_row_cache, m_row_dc_terms);
+    for (int frame = 0; m_noise_reduction && frame < m_frame_count; frame++)
+    {
+        int row_offset = m_frame_rows[frame] * m_pooled_energy_size;
+        if (m_fixed_point)
+        {
+            apply_noise_reduction_fixed(m_fixed_row_cache + row_offset, m_frame_update_noise[frame]);
+        }
+        else
+        {
+            apply_noise_reduction(m_row_cache + row_offset, m_frame_update_noise[frame]);
+        }
+    }
+    // only the rows from first_row on go into the output
+    for (int row = first_row; row < m_number_of_rows; row++)
+    {
+        int slot = (start_hop + row) % m_number_of_rows;
+        int row_offset = slot * m_pooled_energy_size;
+        int output_offset = (row - first_row) * m_pooled_energy_size;
+        // quantized rows go through the scratch row on their way to the output
+        float *output_row = quantized_output ? m_quantize_buffer : output_spectrogram + output_offset;
+        // the mean may have changed since the row was computed - the fixed point rows had the mean taken off in Q8
+        float mean_difference = 0;
+        if (m_row_cache_means)
+        {
+            mean_difference = m_fixed_point ? (lroundf(mean * 256.0f) - lroundf(m_row_cache_means[slot] * 256.0f)) / 256.0f : mean - m_row_cache_means[slot];
+        }
+        const float *dc_terms = m_row_dc_terms + slot * m_dc_bins;
+        // normalise and take the log to give us reasonable values to feed into the network
+        if (m_fixed_point)
+        {
+            const uint64_t *cached_row = m_fixed_row_cache + row_offset;
+            if (mean_difference != 0)
+            {
+                memcpy(m_fixed_dc_row, cached_row, sizeof(uint64_t) * m_pooled_energy_size);
+                for (int i = 0; i < m_dc_bins; i++)
+                {
+                    m_fixed_dc_row[i] = std::max(0.0f, (float)cached_row[i] + get_dc_correction(i, dc_terms, mean_difference));
+                }
+                cached_row = m_fixed_dc_row;
+            }
+            get_spectrogram_segment_fixed(cached_row, log2_scale, epsilon, output_row);
+        }
+        else
+        {
+            const float *cached_row = m_row_cache + row_offset;
+            if (mean_difference != 0)
+            {
+                memcpy(m_dc_row, cached_row, sizeof(float) * m_pooled_energy_size);
+                for (int i = 0; i < m_dc_bins; i++)
+                {
+                    m_dc_row[i] = std::max(0.0f, cached_row[i] + get_dc_correction(i, dc_terms, mean_difference));
+                }
+                cached_row = m_dc_row;
+            }
+            for (int i = 0; i < m_pooled_energy_size; i++)
+            {
+                output_row[i] = fast_log10f(cached_row[i] * energy_scale + log_epsilon);
+            }
+        }
+        if (quantized_output)
+        {
+            quantize_row(output_row, quantized_output + output_offset);
+        }
+    }
+    // if the writer overwrote any of the samples while we were working on them then the cached rows can't be trusted
+    int overwritten = reader->getOverwritten(startIndex);
+    if (overwritten > 0)
+    {
+        memset(m_row_cache_valid, 0, sizeof(bool) * m_number_of_rows);
+        if (m_window_stats)
+        {
+            m_window_stats->reset();
+        }
+    }
+    return overwritten;
+}
+
+uint32_t AudioProcessor::get_average_noise_reduction_cycles()
+{
+    uint32_t average = m_noise_reduction_frames > 0 ? m_noise_reduction_cycles / m_noise_reduction_frames : 0;
+    m_noise_reduction_cycles = 0;
+    m_noise_reduction_frames = 0;
+    return average;
+}
+
+uint32_t AudioProcessor::get_average_frame_cycles()
+{
+    uint32_t average = m_frames_computed > 0 ? m_frame_cycles / m_frames_computed : 0;
+    m_frame_cycles = 0;
+    m_frames_computed = 0;
+    return average;
 }
\ No newline at end of file
@@ -3,10 +3,25 @@
 
 #include <stdlib.h>
 #include <stdint.h>
-// #define FIXED_POINT (16)
 #include "./kissfft/tools/kiss_fftr.h"
+#include "kiss_fftr_fixed.h"
+
+// how many frames to compute at once when there are lots of them to do - this only pays off if the compiler
+// can vectorise across the frames so it's off for targets without SIMD
+#ifndef SPECTROGRAM_BATCH_FRAMES
+#if defined(__SSE2__) || defined(__ARM_NEON)
+#define SPECTROGRAM_BATCH_FRAMES 8
+#else
+#define SPECTROGRAM_BATCH_FRAMES 0
+#endif
+#endif
 
 class HammingWindow;
+class SlidingWindowStats;
+class MelFilterbank;
+class NoiseReductionPCAN;
+struct FFTPlan;
+class WorkerPool;
 
 class RingBufferAccessor;
 
@@ -18,21 +33,151 @@ private:
     int m_step_size;
     int m_pooling_size;
     size_t m_fft_size;
-    float *m_fft_input;
     int m_energy_size;
     int m_pooled_energy_size;
-    float *m_energy;
-    kiss_fft_cpx *m_fft_output;
-    kiss_fftr_cfg m_cfg;
+    // the plans from the cache with the fft buffers, kiss fftr configs and the hamming window multiplied by the
+    // normalisation scale - each worker has its own
+    FFTPlan **m_fft_plans;
 
     HammingWindow *m_hamming_window;
+    float m_window_scale;
+
+    // the frames that need computing are split between the workers - each worker computes a contiguous run of the
+    // windows starting at m_frame_starts into the rows of m_frame_output (or m_fixed_frame_output) in m_frame_rows
+    WorkerPool *m_worker_pool;
+    int m_number_of_workers;
+    int m_active_workers;
+    RingBufferAccessor *m_frame_reader;
+    uint64_t *m_frame_starts;
+    int *m_frame_rows;
+    bool *m_frame_update_noise;
+    int m_frame_count;
+    float m_frame_mean;
+    bool m_frame_take_log;
+    float *m_frame_output;
+    uint64_t *m_fixed_frame_output;
+    float *m_frame_dc_output;
+
+    // mel mode - the power spectrum goes through a mel filterbank instead of being average pooled and
+    // m_pooled_energy_size is the number of mel bands
+    MelFilterbank *m_mel_filterbank;
+
+    // noise reduction mode - the channels go through noise reduction and PCAN before the log instead of being normalised
+    // by the absolute max. The noise estimates follow the audio a hop at a time so m_noise_reduction_hop is the next hop
+    // that will update them.
+    NoiseReductionPCAN *m_noise_reduction;
+    uint32_t *m_channel_signal;
+    uint64_t m_noise_reduction_hop;
+    uint64_t m_noise_reduction_cycles;
+    int m_noise_reduction_frames;
+
+    // profiling - cycles spent computing new frames of the spectrogram
+    uint64_t m_frame_cycles;
+    int m_frames_computed;
+
+    // streaming mode - keeps a cache of pooled energy rows so that only new hops need an fft
+    bool m_streaming;
+    int m_number_of_rows;
+    float *m_row_cache;
+    uint64_t *m_row_cache_hops;
+    bool *m_row_cache_valid;
+    // running mean and max for streaming mode
+    SlidingWindowStats *m_window_stats;
+
+    // streaming mode without noise reduction - each cached row has the mean of the window it was computed in taken out so
+    // they are corrected to the mean of the current window as they are output. Taking d more off the samples takes d times
+    // the window's spectrum off the fft, which changes each pooled bin by d^2 * the pooled energy of the window's spectrum
+    // (m_dc_energy) - 2d * the pooled sum of the fft times the window's spectrum (kept for each row in m_row_dc_terms). The
+    // window's spectrum is only big enough to matter in the lowest m_dc_bins bins - m_dc_spectrum has it for the fft bins of
+    // each of them in turn (starting at m_dc_offsets) already multiplied by the pooling weights.
+    int m_dc_bins;
+    kiss_fft_cpx *m_dc_spectrum;
+    int *m_dc_offsets;
+    float *m_dc_energy;
+    float *m_row_cache_means;
+    float *m_row_dc_terms;
+    float *m_dc_row;
+    uint64_t *m_fixed_dc_row;
+
+    // fixed point mode - the window, fft, power and pooling are done in integers and the log is an integer
+    // log2 that gets converted to a float as the last step. Rows of pooled energy are cached in m_fixed_row_cache in
+    // streaming mode and kept in m_fixed_pooled_energy until they have been converted otherwise.
+    bool m_fixed_point;
+    int m_fft_size_log2;
+    uint64_t *m_fixed_pooled_energy;
+    uint64_t *m_fixed_row_cache;
+
+    // int8 output - each row is quantized for a quantized model's input as soon as it has been computed. The rows are
+    // computed into m_quantize_buffer first, which is a single row unless the whole spectrogram is needed at once.
+    float m_output_scale;
+    int m_output_zero_point;
+    float *m_quantize_buffer;
+
+    void get_normalisation(RingBufferAccessor *reader, uint64_t start, float &mean, float &max);
+    void set_window_scale(float scale);
+    void read_window(FFTPlan *plan, RingBufferAccessor *reader, uint64_t start, float mean);
+    void get_pooled_energy_segment(FFTPlan *plan, float *output_pooled_energy_row, bool take_log, float *dc_terms);
+    void get_pooled_energy_batch(FFTPlan *plan, RingBufferAccessor *reader, const uint64_t *window_starts, int count, float mean, float **output_pooled_energy_rows,
+                                 bool take_log, float **dc_terms);
+    int compute_spectrogram(RingBufferAccessor *reader, float *output_spectrogram, int8_t *quantized_output);
+    int get_spectrogram_streaming(RingBufferAccessor *reader, float *output_spectrogram, int8_t *quantized_output, int first_row);
+    void quantize_row(const float *row, int8_t *output);
+
+    void compute_frames(RingBufferAccessor *reader, float mean, bool take_log, float *output, uint64_t *fixed_output, float *dc_output);
+    void compute_frames_worker(int worker);
+    static void compute_frames_job(void *context, int worker);
+
+    void read_window_fixed(FFTPlan *plan, RingBufferAccessor *reader, uint64_t start, int32_t mean);
+    void get_pooled_energy_segment_fixed(FFTPlan *plan, uint64_t *output_pooled_energy_row, float *dc_terms);
+    void get_log_scale_fixed(float max, int32_t &log2_scale, uint64_t &epsilon);
+    void get_spectrogram_segment_fixed(const uint64_t *pooled_energy_row, int32_t log2_scale, uint64_t epsilon, float *output_spectrogram_row);
+
+    bool should_update_noise_estimate(uint64_t hop, bool complete);
+    void apply_noise_reduction(float *pooled_energy_row, bool update);
+    void apply_noise_reduction_fixed(uint64_t *pooled_energy_row, bool update);
+    void apply_noise_reduction_to_spectrogram(float *spectrogram);
 
-    void get_spectrogram_segment(float *output_spectrogram_row);
+    void get_pooled_bin(int bin, int &start, int &length);
+    void setup_dc_correction();
+    void get_dc_terms(const kiss_fft_cpx *fft_output, float *dc_terms);
+    void get_dc_terms_fixed(const kiss_fft_fixed_cpx *fft_output, float *dc_terms);
+    float get_dc_correction(int bin, const float *dc_terms, float difference);
 
 public:
-    AudioProcessor(int audio_length, int window_size, int step_size, int pooling_size);
+    // if mel_bands is set the output is log mel band energies instead of the average pooled spectrum and pooling_size is ignored.
+    // The frames are split between this many workers.
+    AudioProcessor(int audio_length, int window_size, int step_size, int pooling_size, bool streaming = false, bool fixed_point = false, int mel_bands = 0,
+                   bool noise_reduction = false, int workers = 1);
     ~AudioProcessor();
-    void get_spectrogram(RingBufferAccessor *reader, float *output_spectrogram);
+    // returns the number of samples that were overwritten before they could be processed (normally 0)
+    int get_spectrogram(RingBufferAccessor *reader, float *output_spectrogram);
+    // the same but quantized as round(value / scale) + zero_point for a model with an int8 input - call
+    // set_output_quantization with the input tensor's parameters first
+    int get_spectrogram(RingBufferAccessor *reader, int8_t *output_spectrogram);
+    void set_output_quantization(float scale, int zero_point);
+    // streaming mode only - the same as get_spectrogram but just the last number_of_rows rows for a streaming model that takes
+    // the spectrogram a row at a time. The rows only stay the same from one call to the next with noise reduction on, otherwise
+    // every row is normalised by the loudest sample in the window.
+    int get_spectrogram_rows(RingBufferAccessor *reader, float *output_rows, int number_of_rows);
+    int get_spectrogram_rows(RingBufferAccessor *reader, int8_t *output_rows, int number_of_rows);
+    // the number of values get_spectrogram writes
+    int get_spectrogram_size()
+    {
+        return m_number_of_rows * m_pooled_energy_size;
+    }
+    int get_number_of_rows()
+    {
+        return m_number_of_rows;
+    }
+    // the number of values in each row - what a streaming model takes each time it runs
+    int get_row_size()
+    {
+        return m_pooled_energy_size;
+    }
+    // the average number of cpu cycles it took to compute each new frame since the last call
+    uint32_t get_average_frame_cycles();
+    // the same for the noise reduction and PCAN of each frame
+    uint32_t get_average_noise_reduction_cycles();
 };
 
 #endif
\ No newline at end of file
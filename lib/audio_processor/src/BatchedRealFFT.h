@@ -0,0 +1,205 @@
+#ifndef _batched_real_fft_h_
+#define _batched_real_fft_h_
+
+#include "StaticRealFFT.h"
+
+/**
+ * LANES frames worth of one complex point - the real parts of every frame followed by the imaginary parts
+ **/
+template <int LANES>
+struct BatchComplex
+{
+    float r[LANES];
+    float i[LANES];
+};
+
+/**
+ * Real FFTs of LANES frames at once with the frames stored side by side (structure of arrays) - sample n of
+ * frame f is at input[n * LANES + f]. Every operation is a loop over the frames with the same twiddle factor so
+ * the compiler turns them into SIMD instructions with one frame in each lane, there's no shuffling of real and
+ * imaginary parts like there is when the vectors run along a single frame.
+ *
+ * It uses the same plan and twiddles as StaticRealFFT but the compiler is free to vectorise (and fuse) the
+ * arithmetic differently, so it doesn't give exactly the same result. It is as close to kiss_fftr as StaticRealFFT
+ * is - within 2e-7 of the largest output point.
+ **/
+namespace static_fft
+{
+    template <int NC, int M, int FSTRIDE, int LANES>
+    struct BatchStage
+    {
+        static_assert(M % 4 == 0, "Only power of two FFT sizes are supported");
+        static const int SUB = M / 4;
+
+        static inline void run(const BatchComplex<LANES> *in, BatchComplex<LANES> *out)
+        {
+            for (int q = 0; q < 4; q++)
+            {
+                BatchStage<NC, SUB, FSTRIDE * 4, LANES>::run(in + q * FSTRIDE, out + q * SUB);
+            }
+            const kiss_fft_cpx *twiddles = StageTwiddles<NC, SUB, FSTRIDE>::values;
+            for (int k = 0; k < SUB; k++)
+            {
+                const kiss_fft_cpx w1 = twiddles[k];
+                const kiss_fft_cpx w2 = twiddles[k + SUB];
+                const kiss_fft_cpx w3 = twiddles[k + 2 * SUB];
+                BatchComplex<LANES> &a0 = out[k];
+                BatchComplex<LANES> &a1 = out[k + SUB];
+                BatchComplex<LANES> &a2 = out[k + 2 * SUB];
+                BatchComplex<LANES> &a3 = out[k + 3 * SUB];
+                for (int l = 0; l < LANES; l++)
+                {
+                    const float s0r = a1.r[l] * w1.r - a1.i[l] * w1.i;
+                    const float s0i = a1.r[l] * w1.i + a1.i[l] * w1.r;
+                    const float s1r = a2.r[l] * w2.r - a2.i[l] * w2.i;
+                    const float s1i = a2.r[l] * w2.i + a2.i[l] * w2.r;
+                    const float s2r = a3.r[l] * w3.r - a3.i[l] * w3.i;
+                    const float s2i = a3.r[l] * w3.i + a3.i[l] * w3.r;
+                    const float s5r = a0.r[l] - s1r;
+                    const float s5i = a0.i[l] - s1i;
+                    const float f0r = a0.r[l] + s1r;
+                    const float f0i = a0.i[l] + s1i;
+                    const float s3r = s0r + s2r;
+                    const float s3i = s0i + s2i;
+                    const float s4r = s0r - s2r;
+                    const float s4i = s0i - s2i;
+                    a0.r[l] = f0r + s3r;
+                    a0.i[l] = f0i + s3i;
+                    a1.r[l] = s5r + s4i;
+                    a1.i[l] = s5i - s4r;
+                    a2.r[l] = f0r - s3r;
+                    a2.i[l] = f0i - s3i;
+                    a3.r[l] = s5r - s4i;
+                    a3.i[l] = s5i + s4r;
+                }
+            }
+        }
+    };
+    // the input and output never overlap, telling the compiler this lets it vectorise the leaves
+    template <int NC, int FSTRIDE, int LANES>
+    struct BatchStage<NC, 4, FSTRIDE, LANES>
+    {
+        static inline void run(const BatchComplex<LANES> *__restrict in, BatchComplex<LANES> *__restrict out)
+        {
+            const BatchComplex<LANES> &x0 = in[0];
+            const BatchComplex<LANES> &x1 = in[FSTRIDE];
+            const BatchComplex<LANES> &x2 = in[2 * FSTRIDE];
+            const BatchComplex<LANES> &x3 = in[3 * FSTRIDE];
+            for (int l = 0; l < LANES; l++)
+            {
+                const float s5r = x0.r[l] - x2.r[l];
+                const float s5i = x0.i[l] - x2.i[l];
+                const float f0r = x0.r[l] + x2.r[l];
+                const float f0i = x0.i[l] + x2.i[l];
+                const float s3r = x1.r[l] + x3.r[l];
+                const float s3i = x1.i[l] + x3.i[l];
+                const float s4r = x1.r[l] - x3.r[l];
+                const float s4i = x1.i[l] - x3.i[l];
+                out[0].r[l] = f0r + s3r;
+                out[0].i[l] = f0i + s3i;
+                out[1].r[l] = s5r + s4i;
+                out[1].i[l] = s5i - s4r;
+                out[2].r[l] = f0r - s3r;
+                out[2].i[l] = f0i - s3i;
+                out[3].r[l] = s5r - s4i;
+                out[3].i[l] = s5i + s4r;
+            }
+        }
+    };
+    template <int NC, int FSTRIDE, int LANES>
+    struct BatchStage<NC, 2, FSTRIDE, LANES>
+    {
+        static inline void run(const BatchComplex<LANES> *__restrict in, BatchComplex<LANES> *__restrict out)
+        {
+            const BatchComplex<LANES> &x0 = in[0];
+            const BatchComplex<LANES> &x1 = in[FSTRIDE];
+            for (int l = 0; l < LANES; l++)
+            {
+                out[0].r[l] = x0.r[l] + x1.r[l];
+                out[0].i[l] = x0.i[l] + x1.i[l];
+                out[1].r[l] = x0.r[l] - x1.r[l];
+                out[1].i[l] = x0.i[l] - x1.i[l];
+            }
+        }
+    };
+}
+
+template <int N, int LANES>
+class BatchedRealFFT
+{
+private:
+    static const int NC = N / 2;
+
+    // split out output points k and NC - k of the real FFTs from the same points of the complex FFT
+    static inline void split(BatchComplex<LANES> &fk, BatchComplex<LANES> &fnk, const kiss_fft_cpx w)
+    {
+        for (int l = 0; l < LANES; l++)
+        {
+            const float f1r = fk.r[l] + fnk.r[l];
+            const float f1i = fk.i[l] - fnk.i[l];
+            const float f2r = fk.r[l] - fnk.r[l];
+            const float f2i = fk.i[l] + fnk.i[l];
+            const float twr = f2r * w.r - f2i * w.i;
+            const float twi = f2r * w.i + f2i * w.r;
+            fk.r[l] = 0.5f * (f1r + twr);
+            fk.i[l] = 0.5f * (f1i + twi);
+            fnk.r[l] = 0.5f * (f1r - twr);
+            fnk.i[l] = 0.5f * (twi - f1i);
+        }
+    }
+    static inline void split_distinct(BatchComplex<LANES> &__restrict fk, BatchComplex<LANES> &__restrict fnk, const kiss_fft_cpx w)
+    {
+        split(fk, fnk, w);
+    }
+
+public:
+    /**
+     * input has N rows of LANES real samples, output has N/2 + 1 complex points
+     **/
+    static void transform(const float *input, BatchComplex<LANES> *output)
+    {
+        // pairs of rows of the input are the real and imaginary parts of the NC point complex FFT input
+        static_fft::BatchStage<NC, NC, 1, LANES>::run(reinterpret_cast<const BatchComplex<LANES> *>(input), output);
+        // split out the real FFTs in place - the same as StaticRealFFT but across all the lanes
+        const kiss_fft_cpx *super_twiddles = static_fft::SuperTwiddles<NC>::values;
+        for (int l = 0; l < LANES; l++)
+        {
+            const float dcr = output[0].r[l];
+            const float dci = output[0].i[l];
+            output[0].r[l] = dcr + dci;
+            output[0].i[l] = 0;
+            output[NC].r[l] = dcr - dci;
+            output[NC].i[l] = 0;
+        }
+        // the points are different apart from the one in the middle - telling the compiler lets it vectorise them
+        for (int k = 1; k < NC / 2; k++)
+        {
+            split_distinct(output[k], output[NC - k], super_twiddles[k - 1]);
+        }
+        split(output[NC / 2], output[NC / 2], super_twiddles[NC / 2 - 1]);
+    }
+};
+
+/**
+ * Run the batched FFT for nfft if there is one - returns false if there isn't a compile time version of this size
+ **/
+template <int LANES>
+inline bool batched_real_fft(int nfft, const float *input, BatchComplex<LANES> *output)
+{
+    switch (nfft)
+    {
+    case 256:
+        BatchedRealFFT<256, LANES>::transform(input, output);
+        return true;
+    case 512:
+        BatchedRealFFT<512, LANES>::transform(input, output);
+        return true;
+    case 1024:
+        BatchedRealFFT<1024, LANES>::transform(input, output);
+        return true;
+    default:
+        return false;
+    }
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef _cycle_counter_h_
+#define _cycle_counter_h_
+
+#include <stdint.h>
+
+#if defined(__XTENSA__)
+#include <xtensa/hal.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * Read the CPU's cycle counter for profiling - this wraps around so only use it to time short sections
+ * of code. Returns 0 on platforms where we don't know how to read it.
+ **/
+static inline uint32_t get_cycle_count()
+{
+#if defined(__XTENSA__)
+    return xthal_get_ccount();
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+#endif
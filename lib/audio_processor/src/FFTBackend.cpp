@@ -0,0 +1,244 @@
+#include <atomic>
+#include "FFTBackend.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FFT_BACKEND_X86
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FFT_BACKEND_NEON
+#endif
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+// the plain C version of the butterfly from k = start onwards - the SIMD versions use this for any leftovers
+static inline void butterfly4_from(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m, int start)
+{
+    for (int k = start; k < m; k++)
+    {
+        const kiss_fft_cpx a1 = out[k + m];
+        const kiss_fft_cpx a2 = out[k + 2 * m];
+        const kiss_fft_cpx a3 = out[k + 3 * m];
+        const kiss_fft_cpx w1 = twiddles[k];
+        const kiss_fft_cpx w2 = twiddles[k + m];
+        const kiss_fft_cpx w3 = twiddles[k + 2 * m];
+        const kiss_fft_cpx s0 = {a1.r * w1.r - a1.i * w1.i, a1.r * w1.i + a1.i * w1.r};
+        const kiss_fft_cpx s1 = {a2.r * w2.r - a2.i * w2.i, a2.r * w2.i + a2.i * w2.r};
+        const kiss_fft_cpx s2 = {a3.r * w3.r - a3.i * w3.i, a3.r * w3.i + a3.i * w3.r};
+        const kiss_fft_cpx s5 = {out[k].r - s1.r, out[k].i - s1.i};
+        const kiss_fft_cpx f0 = {out[k].r + s1.r, out[k].i + s1.i};
+        const kiss_fft_cpx s3 = {s0.r + s2.r, s0.i + s2.i};
+        const kiss_fft_cpx s4 = {s0.r - s2.r, s0.i - s2.i};
+        out[k].r = f0.r + s3.r;
+        out[k].i = f0.i + s3.i;
+        out[k + m].r = s5.r + s4.i;
+        out[k + m].i = s5.i - s4.r;
+        out[k + 2 * m].r = f0.r - s3.r;
+        out[k + 2 * m].i = f0.i - s3.i;
+        out[k + 3 * m].r = s5.r - s4.i;
+        out[k + 3 * m].i = s5.i + s4.r;
+    }
+}
+
+static void butterfly4_c(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m)
+{
+    butterfly4_from(out, twiddles, m, 0);
+}
+
+static const FFTBackend c_backend = {"C", butterfly4_c};
+
+#ifdef FFT_BACKEND_X86
+// The SSE2 and AVX2 versions work on interleaved complex values, two or four at a time. A complex multiply is
+// a * w.r + swap(a) * w.i with the real lanes of the second product negated, and multiplying by -j is a swap
+// with the imaginary lanes negated.
+__attribute__((target("sse2"))) static inline __m128 complex_multiply_sse2(__m128 a, __m128 w)
+{
+    const __m128 negate_real = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    __m128 w_real = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128 w_imag = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 1, 1));
+    __m128 a_swapped = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_add_ps(_mm_mul_ps(a, w_real), _mm_xor_ps(_mm_mul_ps(a_swapped, w_imag), negate_real));
+}
+
+__attribute__((target("sse2"))) static void butterfly4_sse2(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m)
+{
+    const __m128 negate_imag = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    float *f0 = reinterpret_cast<float *>(out);
+    float *f1 = reinterpret_cast<float *>(out + m);
+    float *f2 = reinterpret_cast<float *>(out + 2 * m);
+    float *f3 = reinterpret_cast<float *>(out + 3 * m);
+    const float *w1 = reinterpret_cast<const float *>(twiddles);
+    const float *w2 = reinterpret_cast<const float *>(twiddles + m);
+    const float *w3 = reinterpret_cast<const float *>(twiddles + 2 * m);
+    int k = 0;
+    for (; k + 2 <= m; k += 2)
+    {
+        __m128 a0 = _mm_loadu_ps(f0 + 2 * k);
+        __m128 s0 = complex_multiply_sse2(_mm_loadu_ps(f1 + 2 * k), _mm_loadu_ps(w1 + 2 * k));
+        __m128 s1 = complex_multiply_sse2(_mm_loadu_ps(f2 + 2 * k), _mm_loadu_ps(w2 + 2 * k));
+        __m128 s2 = complex_multiply_sse2(_mm_loadu_ps(f3 + 2 * k), _mm_loadu_ps(w3 + 2 * k));
+        __m128 s5 = _mm_sub_ps(a0, s1);
+        __m128 sum = _mm_add_ps(a0, s1);
+        __m128 s3 = _mm_add_ps(s0, s2);
+        __m128 s4 = _mm_sub_ps(s0, s2);
+        __m128 s4_rotated = _mm_xor_ps(_mm_shuffle_ps(s4, s4, _MM_SHUFFLE(2, 3, 0, 1)), negate_imag);
+        _mm_storeu_ps(f0 + 2 * k, _mm_add_ps(sum, s3));
+        _mm_storeu_ps(f1 + 2 * k, _mm_add_ps(s5, s4_rotated));
+        _mm_storeu_ps(f2 + 2 * k, _mm_sub_ps(sum, s3));
+        _mm_storeu_ps(f3 + 2 * k, _mm_sub_ps(s5, s4_rotated));
+    }
+    butterfly4_from(out, twiddles, m, k);
+}
+
+__attribute__((target("avx2"))) static inline __m256 complex_multiply_avx2(__m256 a, __m256 w)
+{
+    const __m256 negate_real = _mm256_set_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+    __m256 w_real = _mm256_permute_ps(w, _MM_SHUFFLE(2, 2, 0, 0));
+    __m256 w_imag = _mm256_permute_ps(w, _MM_SHUFFLE(3, 3, 1, 1));
+    __m256 a_swapped = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_add_ps(_mm256_mul_ps(a, w_real), _mm256_xor_ps(_mm256_mul_ps(a_swapped, w_imag), negate_real));
+}
+
+__attribute__((target("avx2"))) static void butterfly4_avx2(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m)
+{
+    const __m256 negate_imag = _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+    float *f0 = reinterpret_cast<float *>(out);
+    float *f1 = reinterpret_cast<float *>(out + m);
+    float *f2 = reinterpret_cast<float *>(out + 2 * m);
+    float *f3 = reinterpret_cast<float *>(out + 3 * m);
+    const float *w1 = reinterpret_cast<const float *>(twiddles);
+    const float *w2 = reinterpret_cast<const float *>(twiddles + m);
+    const float *w3 = reinterpret_cast<const float *>(twiddles + 2 * m);
+    int k = 0;
+    for (; k + 4 <= m; k += 4)
+    {
+        __m256 a0 = _mm256_loadu_ps(f0 + 2 * k);
+        __m256 s0 = complex_multiply_avx2(_mm256_loadu_ps(f1 + 2 * k), _mm256_loadu_ps(w1 + 2 * k));
+        __m256 s1 = complex_multiply_avx2(_mm256_loadu_ps(f2 + 2 * k), _mm256_loadu_ps(w2 + 2 * k));
+        __m256 s2 = complex_multiply_avx2(_mm256_loadu_ps(f3 + 2 * k), _mm256_loadu_ps(w3 + 2 * k));
+        __m256 s5 = _mm256_sub_ps(a0, s1);
+        __m256 sum = _mm256_add_ps(a0, s1);
+        __m256 s3 = _mm256_add_ps(s0, s2);
+        __m256 s4 = _mm256_sub_ps(s0, s2);
+        __m256 s4_rotated = _mm256_xor_ps(_mm256_permute_ps(s4, _MM_SHUFFLE(2, 3, 0, 1)), negate_imag);
+        _mm256_storeu_ps(f0 + 2 * k, _mm256_add_ps(sum, s3));
+        _mm256_storeu_ps(f1 + 2 * k, _mm256_add_ps(s5, s4_rotated));
+        _mm256_storeu_ps(f2 + 2 * k, _mm256_sub_ps(sum, s3));
+        _mm256_storeu_ps(f3 + 2 * k, _mm256_sub_ps(s5, s4_rotated));
+    }
+    // the leftovers are still m apart - they can't be passed to another butterfly as a smaller m
+    butterfly4_from(out, twiddles, m, k);
+}
+
+static const FFTBackend sse2_backend = {"SSE2", butterfly4_sse2};
+static const FFTBackend avx2_backend = {"AVX2", butterfly4_avx2};
+#endif
+
+#ifdef FFT_BACKEND_NEON
+static inline float32x4_t complex_multiply_neon(float32x4_t a, float32x4_t w)
+{
+    const float32x4_t negate_real = {-1.0f, 1.0f, -1.0f, 1.0f};
+    float32x4x2_t w_parts = vtrnq_f32(w, w);
+    return vaddq_f32(vmulq_f32(a, w_parts.val[0]), vmulq_f32(vmulq_f32(vrev64q_f32(a), w_parts.val[1]), negate_real));
+}
+
+static void butterfly4_neon(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m)
+{
+    const float32x4_t negate_imag = {1.0f, -1.0f, 1.0f, -1.0f};
+    float *f0 = reinterpret_cast<float *>(out);
+    float *f1 = reinterpret_cast<float *>(out + m);
+    float *f2 = reinterpret_cast<float *>(out + 2 * m);
+    float *f3 = reinterpret_cast<float *>(out + 3 * m);
+    const float *w1 = reinterpret_cast<const float *>(twiddles);
+    const float *w2 = reinterpret_cast<const float *>(twiddles + m);
+    const float *w3 = reinterpret_cast<const float *>(twiddles + 2 * m);
+    int k = 0;
+    for (; k + 2 <= m; k += 2)
+    {
+        float32x4_t a0 = vld1q_f32(f0 + 2 * k);
+        float32x4_t s0 = complex_multiply_neon(vld1q_f32(f1 + 2 * k), vld1q_f32(w1 + 2 * k));
+        float32x4_t s1 = complex_multiply_neon(vld1q_f32(f2 + 2 * k), vld1q_f32(w2 + 2 * k));
+        float32x4_t s2 = complex_multiply_neon(vld1q_f32(f3 + 2 * k), vld1q_f32(w3 + 2 * k));
+        float32x4_t s5 = vsubq_f32(a0, s1);
+        float32x4_t sum = vaddq_f32(a0, s1);
+        float32x4_t s3 = vaddq_f32(s0, s2);
+        float32x4_t s4 = vsubq_f32(s0, s2);
+        float32x4_t s4_rotated = vmulq_f32(vrev64q_f32(s4), negate_imag);
+        vst1q_f32(f0 + 2 * k, vaddq_f32(sum, s3));
+        vst1q_f32(f1 + 2 * k, vaddq_f32(s5, s4_rotated));
+        vst1q_f32(f2 + 2 * k, vsubq_f32(sum, s3));
+        vst1q_f32(f3 + 2 * k, vsubq_f32(s5, s4_rotated));
+    }
+    butterfly4_from(out, twiddles, m, k);
+}
+
+static const FFTBackend neon_backend = {"NEON", butterfly4_neon};
+#endif
+
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+// Hook for a version of the butterfly that uses the ESP32-S3's PIE vector instructions - these are only available
+// from assembly, so if nothing provides this function we stick with the plain C version.
+extern "C" void fft_butterfly4_esp32s3_pie(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m) __attribute__((weak));
+static const FFTBackend pie_backend = {"ESP32-S3 PIE", fft_butterfly4_esp32s3_pie};
+#endif
+
+int get_supported_fft_backends(const FFTBackend **backends, int max_backends)
+{
+    int count = 0;
+    if (count < max_backends)
+    {
+        backends[count++] = &c_backend;
+    }
+#ifdef FFT_BACKEND_X86
+    if (count < max_backends && __builtin_cpu_supports("sse2"))
+    {
+        backends[count++] = &sse2_backend;
+    }
+    if (count < max_backends && __builtin_cpu_supports("avx2"))
+    {
+        backends[count++] = &avx2_backend;
+    }
+#endif
+#ifdef FFT_BACKEND_NEON
+    if (count < max_backends)
+    {
+        backends[count++] = &neon_backend;
+    }
+#endif
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+    if (count < max_backends && fft_butterfly4_esp32s3_pie)
+    {
+        backends[count++] = &pie_backend;
+    }
+#endif
+    return count;
+}
+
+// the spectrogram workers can ask for the backend at the same time the first time round so it is swapped in atomically -
+// whichever of them gets there first picks it and the others use that one
+static std::atomic<const FFTBackend *> current_backend(NULL);
+
+const FFTBackend *get_fft_backend()
+{
+    const FFTBackend *backend = current_backend.load(std::memory_order_acquire);
+    if (!backend)
+    {
+        // the backends are in order of preference so use the last one
+        const FFTBackend *backends[8];
+        int count = get_supported_fft_backends(backends, 8);
+        backend = backends[count - 1];
+        const FFTBackend *expected = NULL;
+        if (!current_backend.compare_exchange_strong(expected, backend, std::memory_order_acq_rel))
+        {
+            backend = expected;
+        }
+    }
+    return backend;
+}
+
+void set_fft_backend(const FFTBackend *backend)
+{
+    current_backend.store(backend, std::memory_order_release);
+}
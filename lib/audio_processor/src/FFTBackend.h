@@ -0,0 +1,29 @@
+#ifndef _fft_backend_h_
+#define _fft_backend_h_
+
+#include "./kissfft/kiss_fft.h"
+
+/**
+ * Radix 4 decimation in time butterfly - combines the four m point FFTs in out[0, 4m) in place. twiddles
+ * holds w^k, w^2k and w^3k for k in [0, m) as three runs of m values.
+ **/
+typedef void (*butterfly4_fn)(kiss_fft_cpx *out, const kiss_fft_cpx *twiddles, int m);
+
+/**
+ * The FFT kernels for one instruction set
+ **/
+typedef struct
+{
+    const char *name;
+    butterfly4_fn butterfly4;
+} FFTBackend;
+
+// the fastest backend this CPU can run - it is picked from the CPU's features the first time this is called and is safe to
+// call from several tasks at once
+const FFTBackend *get_fft_backend();
+// use a particular backend - for checking the backends against each other
+void set_fft_backend(const FFTBackend *backend);
+// fills in the backends this build has and this CPU can run and returns how many there are - the first is the plain C reference
+int get_supported_fft_backends(const FFTBackend **backends, int max_backends);
+
+#endif
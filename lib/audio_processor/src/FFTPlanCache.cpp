@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <mutex>
+#include "FFTPlanCache.h"
+#include "HammingWindow.h"
+#include "MelFilterbank.h"
+#include "StaticRealFFT.h"
+#include "AudioProcessor.h"
+
+typedef enum
+{
+    FLOAT_FFT_PLAN,
+    FIXED_FFT_PLAN,
+    HAMMING_WINDOW,
+    MEL_FILTERBANK
+} CachedTableType;
+
+typedef struct CachedTable
+{
+    CachedTableType type;
+    int fft_size;
+    // the window size for plans and windows, the number of bands for mel filterbanks
+    int size;
+    // only used for mel filterbanks - the bands depend on the sample rate and the range they cover as well
+    int sample_rate;
+    float low_frequency;
+    float high_frequency;
+    // only used for plans - windows and filterbanks are shared
+    bool in_use;
+    void *table;
+    struct CachedTable *next;
+} CachedTable;
+
+static CachedTable *cached_tables = NULL;
+static std::mutex cache_mutex;
+
+// find an entry in the cache - call with the mutex held
+static CachedTable *find_table(CachedTableType type, int fft_size, int size, bool free_only,
+                               int sample_rate = 0, float low_frequency = 0, float high_frequency = 0)
+{
+    for (CachedTable *entry = cached_tables; entry; entry = entry->next)
+    {
+        if (entry->type == type && entry->fft_size == fft_size && entry->size == size && !(free_only && entry->in_use) &&
+            entry->sample_rate == sample_rate && entry->low_frequency == low_frequency && entry->high_frequency == high_frequency)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// add an entry to the cache - call with the mutex held
+static CachedTable *add_table(CachedTableType type, int fft_size, int size, void *table,
+                              int sample_rate = 0, float low_frequency = 0, float high_frequency = 0)
+{
+    CachedTable *entry = static_cast<CachedTable *>(malloc(sizeof(CachedTable)));
+    entry->type = type;
+    entry->fft_size = fft_size;
+    entry->size = size;
+    entry->sample_rate = sample_rate;
+    entry->low_frequency = low_frequency;
+    entry->high_frequency = high_frequency;
+    entry->in_use = false;
+    entry->table = table;
+    entry->next = cached_tables;
+    cached_tables = entry;
+    return entry;
+}
+
+static FFTPlan *create_fft_plan(int fft_size, int window_size, bool fixed_point)
+{
+    FFTPlan *plan = static_cast<FFTPlan *>(calloc(1, sizeof(FFTPlan)));
+    plan->fft_size = fft_size;
+    plan->window_size = window_size;
+    plan->fixed_point = fixed_point;
+    int energy_size = fft_size / 2 + 1;
+    if (fixed_point)
+    {
+        plan->fixed_input = static_cast<int32_t *>(malloc(sizeof(int32_t) * fft_size));
+        plan->fixed_output = static_cast<kiss_fft_fixed_cpx *>(malloc(sizeof(kiss_fft_fixed_cpx) * energy_size));
+        plan->fixed_cfg = kiss_fftr_fixed_alloc(fft_size, false, 0, 0);
+    }
+    else
+    {
+        plan->input = static_cast<float *>(malloc(sizeof(float) * fft_size));
+        plan->output = static_cast<kiss_fft_cpx *>(malloc(sizeof(kiss_fft_cpx) * energy_size));
+        // the sizes we normally use have a compile time fft so we only need kiss fftr for anything else
+        if (!has_static_real_fft(fft_size))
+        {
+            plan->cfg = kiss_fftr_alloc(fft_size, false, 0, 0);
+        }
+        else
+        {
+            printf("Using the %s FFT backend\n", get_fft_backend()->name);
+#if SPECTROGRAM_BATCH_FRAMES > 0
+            // the zero padding at the end of the windows is never written to so this only needs clearing once - this
+            // is why the plans are per window size as well as per fft size
+            plan->batch_input = static_cast<float *>(calloc(fft_size * SPECTROGRAM_BATCH_FRAMES, sizeof(float)));
+            plan->batch_output = static_cast<float *>(malloc(sizeof(float) * 2 * energy_size * SPECTROGRAM_BATCH_FRAMES));
+#endif
+        }
+    }
+    plan->window_coefficients = static_cast<float *>(malloc(sizeof(float) * window_size));
+    return plan;
+}
+
+FFTPlan *acquire_fft_plan(int fft_size, int window_size, bool fixed_point)
+{
+    CachedTableType type = fixed_point ? FIXED_FFT_PLAN : FLOAT_FFT_PLAN;
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    CachedTable *entry = find_table(type, fft_size, window_size, true);
+    if (!entry)
+    {
+        entry = add_table(type, fft_size, window_size, create_fft_plan(fft_size, window_size, fixed_point));
+    }
+    entry->in_use = true;
+    return static_cast<FFTPlan *>(entry->table);
+}
+
+void release_fft_plan(FFTPlan *plan)
+{
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (CachedTable *entry = cached_tables; entry; entry = entry->next)
+    {
+        if (entry->table == plan)
+        {
+            entry->in_use = false;
+            return;
+        }
+    }
+}
+
+HammingWindow *get_cached_hamming_window(int window_size)
+{
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    CachedTable *entry = find_table(HAMMING_WINDOW, 0, window_size, false);
+    if (!entry)
+    {
+        entry = add_table(HAMMING_WINDOW, 0, window_size, new HammingWindow(window_size));
+    }
+    return static_cast<HammingWindow *>(entry->table);
+}
+
+MelFilterbank *get_cached_mel_filterbank(int fft_size, int number_of_bands, int sample_rate, float low_frequency, float high_frequency)
+{
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    CachedTable *entry = find_table(MEL_FILTERBANK, fft_size, number_of_bands, false, sample_rate, low_frequency, high_frequency);
+    if (!entry)
+    {
+        entry = add_table(MEL_FILTERBANK, fft_size, number_of_bands, new MelFilterbank(fft_size, sample_rate, number_of_bands, low_frequency, high_frequency),
+                          sample_rate, low_frequency, high_frequency);
+    }
+    return static_cast<MelFilterbank *>(entry->table);
+}
@@ -0,0 +1,47 @@
+#ifndef _fft_plan_cache_h_
+#define _fft_plan_cache_h_
+
+#include "./kissfft/tools/kiss_fftr.h"
+#include "kiss_fftr_fixed.h"
+
+class HammingWindow;
+class MelFilterbank;
+
+/**
+ * Everything needed to window and FFT frames of one size - the kiss fftr plan (if the FFT size doesn't have a
+ * compile time version) and the buffers. A processor has exclusive use of a plan between acquiring and releasing it.
+ **/
+struct FFTPlan
+{
+    int fft_size;
+    int window_size;
+    bool fixed_point;
+    // float mode
+    kiss_fftr_cfg cfg;
+    float *input;
+    kiss_fft_cpx *output;
+    float *batch_input;
+    float *batch_output;
+    // fixed point mode
+    kiss_fftr_fixed_cfg fixed_cfg;
+    int32_t *fixed_input;
+    kiss_fft_fixed_cpx *fixed_output;
+    // the window scaled for normalisation - whoever has the plan sets the scale
+    float *window_coefficients;
+};
+
+/**
+ * Process wide cache of FFT plans and window tables keyed on the FFT size, window size and type (like kissfft's kfc).
+ * Once something has been created it stays in the cache so creating an AudioProcessor again doesn't have to
+ * work out any tables or allocate any buffers for them. Safe to use from any task.
+ **/
+// get a plan that no one else is using - a new one is created if there isn't a free one in the cache
+FFTPlan *acquire_fft_plan(int fft_size, int window_size, bool fixed_point);
+// give a plan back to the cache
+void release_fft_plan(FFTPlan *plan);
+// these are read only so everyone shares the same ones - mel filterbanks are only shared by processors with the same
+// sample rate and frequency range
+HammingWindow *get_cached_hamming_window(int window_size);
+MelFilterbank *get_cached_mel_filterbank(int fft_size, int number_of_bands, int sample_rate, float low_frequency, float high_frequency);
+
+#endif
@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "FIRFilter.h"
+#include "CycleCounter.h"
+
+static inline int16_t saturate(float sample)
+{
+    return std::max(-32768L, std::min(32767L, lrintf(sample)));
+}
+
+FIRFilter::FIRFilter(const float *taps, int number_of_taps, FIRFilterMode mode)
+{
+    m_number_of_taps = number_of_taps;
+    m_use_fft = mode == FIR_FILTER_FFT || (mode == FIR_FILTER_AUTO && number_of_taps >= FIR_FFT_MIN_TAPS);
+    m_reversed_taps = NULL;
+    m_history = NULL;
+    m_fastfir = NULL;
+    m_fft_input = NULL;
+    m_fft_output = NULL;
+    if (m_use_fft)
+    {
+        // kissfft's default fft size only leaves half of each fft for new samples - 4 times the number of taps
+        // wastes less of each fft
+        m_nfft = 256;
+        while (m_nfft < 4 * (size_t)number_of_taps)
+        {
+            m_nfft <<= 1;
+        }
+        m_fastfir = kiss_fastfir_real_alloc(taps, number_of_taps, &m_nfft, NULL, NULL);
+        m_block_size = m_nfft - number_of_taps + 1;
+        // start with taps - 1 zeros so the output lines up with the input and the filter starts from silence
+        m_fft_input = static_cast<float *>(calloc(m_nfft + m_block_size, sizeof(float)));
+        m_fft_input_length = number_of_taps - 1;
+        // and a block of zeros on the output to give the fft time to fill up
+        m_fft_output = static_cast<float *>(calloc(3 * m_block_size, sizeof(float)));
+        m_fft_output_length = m_block_size;
+    }
+    else
+    {
+        m_reversed_taps = static_cast<float *>(malloc(sizeof(float) * number_of_taps));
+        for (int i = 0; i < number_of_taps; i++)
+        {
+            m_reversed_taps[i] = taps[number_of_taps - 1 - i];
+        }
+        m_history = static_cast<float *>(calloc(number_of_taps - 1 + FIR_BLOCK_SIZE, sizeof(float)));
+        m_block_size = FIR_BLOCK_SIZE;
+    }
+    m_cycles.store(0);
+    m_blocks.store(0);
+}
+
+FIRFilter::~FIRFilter()
+{
+    free(m_reversed_taps);
+    free(m_history);
+    free(m_fastfir);
+    free(m_fft_input);
+    free(m_fft_output);
+}
+
+void FIRFilter::process(int16_t *samples, int count)
+{
+    processPart(samples, count);
+    endBlock();
+}
+
+void FIRFilter::processPart(int16_t *samples, int count)
+{
+    uint32_t start = get_cycle_count();
+    while (count > 0)
+    {
+        int length = std::min(count, m_block_size);
+        if (m_use_fft)
+        {
+            processFFT(samples, length);
+        }
+        else
+        {
+            processDirect(samples, length);
+        }
+        samples += length;
+        count -= length;
+    }
+    m_cycles.fetch_add(get_cycle_count() - start, std::memory_order_relaxed);
+}
+
+void FIRFilter::endBlock()
+{
+    m_blocks.fetch_add(1, std::memory_order_relaxed);
+}
+
+// each output is the dot product of the taps with the last taps samples - these are contiguous in the history so
+// the inner loop vectorises
+void FIRFilter::processDirect(int16_t *samples, int count)
+{
+    const int lag = m_number_of_taps - 1;
+    float *input = m_history + lag;
+    for (int i = 0; i < count; i++)
+    {
+        input[i] = samples[i];
+    }
+    for (int i = 0; i < count; i++)
+    {
+        const float *window = m_history + i;
+        float sum = 0;
+        for (int tap = 0; tap < m_number_of_taps; tap++)
+        {
+            sum += m_reversed_taps[tap] * window[tap];
+        }
+        samples[i] = saturate(sum);
+    }
+    // keep the last taps - 1 samples for the next block
+    memmove(m_history, m_history + count, sizeof(float) * lag);
+}
+
+// kiss_fastfir only outputs whole blocks so the output is delayed by a block - the samples we return come off the front
+// of the output queue and the new blocks go on the end
+void FIRFilter::processFFT(int16_t *samples, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        m_fft_input[m_fft_input_length + i] = samples[i];
+    }
+    m_fft_output_length += kiss_fastfir_real(m_fastfir, m_fft_input, m_fft_output + m_fft_output_length, count, &m_fft_input_length);
+    for (int i = 0; i < count; i++)
+    {
+        samples[i] = saturate(m_fft_output[i]);
+    }
+    m_fft_output_length -= count;
+    memmove(m_fft_output, m_fft_output + count, sizeof(float) * m_fft_output_length);
+}
+
+int FIRFilter::getDelay()
+{
+    // linear phase filters delay everything by half their length
+    int delay = (m_number_of_taps - 1) / 2;
+    return m_use_fft ? delay + m_block_size : delay;
+}
+
+uint32_t FIRFilter::getAverageBlockCycles()
+{
+    uint32_t blocks = m_blocks.exchange(0, std::memory_order_relaxed);
+    uint32_t cycles = m_cycles.exchange(0, std::memory_order_relaxed);
+    return blocks > 0 ? cycles / blocks : 0;
+}
+
+void FIRFilter::designBandPass(float *taps, int number_of_taps, int sample_rate, float low_frequency, float high_frequency, float pre_emphasis)
+{
+    // the pre-emphasis adds a tap so design the band pass one tap shorter
+    int length = pre_emphasis != 0 ? number_of_taps - 1 : number_of_taps;
+    float low = low_frequency / sample_rate;
+    float high = high_frequency / sample_rate;
+    // the difference of two low pass filters with a hamming window
+    for (int n = 0; n < length; n++)
+    {
+        double m = n - (length - 1) / 2.0;
+        double ideal = m == 0 ? 2 * (high - low) : (sin(2 * M_PI * high * m) - sin(2 * M_PI * low * m)) / (M_PI * m);
+        double window = length > 1 ? 0.54 - 0.46 * cos(2 * M_PI * n / (length - 1)) : 1;
+        taps[n] = ideal * window;
+    }
+    // scale it to a gain of 1 in the middle of the pass band
+    double centre = (low + high) / 2;
+    double real = 0, imag = 0;
+    for (int n = 0; n < length; n++)
+    {
+        real += taps[n] * cos(2 * M_PI * centre * n);
+        imag -= taps[n] * sin(2 * M_PI * centre * n);
+    }
+    float scale = 1.0 / sqrt(real * real + imag * imag);
+    for (int n = 0; n < length; n++)
+    {
+        taps[n] *= scale;
+    }
+    // convolve with the pre-emphasis filter
+    if (pre_emphasis != 0)
+    {
+        taps[length] = -pre_emphasis * taps[length - 1];
+        for (int n = length - 1; n > 0; n--)
+        {
+            taps[n] -= pre_emphasis * taps[n - 1];
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef _fir_filter_h_
+#define _fir_filter_h_
+
+#include <stdint.h>
+#include <atomic>
+#include "kiss_fastfir_real.h"
+
+// filters with at least this many taps are done with FFTs instead of directly
+#ifndef FIR_FFT_MIN_TAPS
+#define FIR_FFT_MIN_TAPS 64
+#endif
+// the most samples the direct form filter works on at once - longer blocks are done in pieces
+#define FIR_BLOCK_SIZE 256
+
+typedef enum
+{
+    // pick whichever is quicker for the number of taps
+    FIR_FILTER_AUTO,
+    FIR_FILTER_DIRECT,
+    FIR_FILTER_FFT
+} FIRFilterMode;
+
+/**
+ * Streaming FIR filter for blocks of 16 bit samples - the samples are filtered in place so it can sit between
+ * the sampler and the ring buffer.
+ *
+ * Short filters are done directly. Long filters are done with kissfft's overlap-save fast FIR which is much
+ * quicker per sample but works on blocks of nfft - taps + 1 samples, so the output is delayed by a block.
+ **/
+class FIRFilter
+{
+private:
+    int m_number_of_taps;
+    bool m_use_fft;
+    // direct form - the taps in reverse order and the last taps - 1 input samples followed by the new samples
+    float *m_reversed_taps;
+    float *m_history;
+    // fft - the input samples that haven't been filtered yet and the output samples waiting to be returned
+    kiss_fastfir_real_cfg m_fastfir;
+    size_t m_nfft;
+    int m_block_size;
+    float *m_fft_input;
+    size_t m_fft_input_length;
+    float *m_fft_output;
+    int m_fft_output_length;
+    // profiling - updated by whoever is filtering and read by whoever wants the stats
+    std::atomic<uint32_t> m_cycles;
+    std::atomic<uint32_t> m_blocks;
+
+    void processDirect(int16_t *samples, int count);
+    void processFFT(int16_t *samples, int count);
+
+public:
+    FIRFilter(const float *taps, int number_of_taps, FIRFilterMode mode = FIR_FILTER_AUTO);
+    ~FIRFilter();
+    // filter a block of samples in place
+    void process(int16_t *samples, int count);
+    // filter part of a block in place for blocks that arrive in pieces - call endBlock once the whole block has
+    // been filtered so the pieces count as one block in the profiling
+    void processPart(int16_t *samples, int count);
+    void endBlock();
+    bool isUsingFFT()
+    {
+        return m_use_fft;
+    }
+    // how many samples the output lags the input by at the middle of the filter's pass band
+    int getDelay();
+    // the average number of cpu cycles it took to filter each block since the last call
+    uint32_t getAverageBlockCycles();
+
+    // windowed sinc band pass filter (Hamming window) with a gain of 1 in the middle of the pass band - if
+    // pre_emphasis is not 0 the taps include a first order pre-emphasis filter (1 - pre_emphasis * z^-1)
+    static void designBandPass(float *taps, int number_of_taps, int sample_rate, float low_frequency, float high_frequency, float pre_emphasis);
+};
+
+#endif
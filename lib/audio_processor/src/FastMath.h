@@ -0,0 +1,34 @@
+#ifndef _fast_math_h_
+#define _fast_math_h_
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Approximate log2 for positive, finite x - the exponent comes straight from the float and a 5th order
+ * polynomial fitted to log2(1 + u) over [0, 1) handles the mantissa. Max error is about 2e-5.
+ * There are no branches or table lookups so loops over arrays of values vectorise.
+ **/
+static inline float fast_log2f(float x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    float exponent = (float)((int32_t)(bits >> 23) - 127);
+    bits = (bits & 0x007fffff) | 0x3f800000;
+    float mantissa;
+    memcpy(&mantissa, &bits, sizeof(mantissa));
+    float u = mantissa - 1.0f;
+    float poly = 0.045268293f;
+    poly = poly * u - 0.19351653f;
+    poly = poly * u + 0.41524556f;
+    poly = poly * u - 0.70886522f;
+    poly = poly * u + 1.4418799f;
+    return exponent + poly * u;
+}
+
+static inline float fast_log10f(float x)
+{
+    return fast_log2f(x) * 0.30102999566f;
+}
+
+#endif
@@ -1,11 +1,13 @@
 #include <stdlib.h>
 #include <math.h>
+#include <algorithm>
 #include "HammingWindow.h"
 
 HammingWindow::HammingWindow(int window_size)
 {
     m_window_size = window_size;
     m_coefficients = static_cast<float *>(malloc(sizeof(float) * m_window_size));
+    m_fixed_coefficients = static_cast<int16_t *>(malloc(sizeof(int16_t) * m_window_size));
     // create the constants for a hamming window
     const float arg = M_PI * 2.0 / window_size;
     for (int i = 0; i < window_size; i++)
@@ -13,12 +15,14 @@ HammingWindow::HammingWindow(int window_size)
         float float_value = 0.5 - (0.5 * cos(arg * (i + 0.5)));
         // Scale it to fixed point and round it.
         m_coefficients[i] = float_value;
+        m_fixed_coefficients[i] = std::min(32767L, lroundf(float_value * 32768.0f));
     }
 }
 
 HammingWindow::~HammingWindow()
 {
     free(m_coefficients);
+    free(m_fixed_coefficients);
 }
 
 void HammingWindow::applyWindow(float *input)
@@ -28,3 +32,12 @@ void HammingWindow::applyWindow(float *input)
         input[i] = input[i] * m_coefficients[i];
     }
 }
+
+
+void HammingWindow::applyWindow(int32_t *input)
+{
+    for (int i = 0; i < m_window_size; i++)
+    {
+        input[i] = ((int64_t)input[i] * m_fixed_coefficients[i]) >> 8;
+    }
+}
\ No newline at end of file
@@ -4,10 +4,18 @@ class HammingWindow
 {
 private:
     float *m_coefficients;
+    // Q15 coefficients for the fixed point frontend
+    int16_t *m_fixed_coefficients;
     int m_window_size;
 
 public:
     HammingWindow(int window_size);
     ~HammingWindow();
     void applyWindow(float *input);
+    const float *getCoefficients()
+    {
+        return m_coefficients;
+    }
+    // input is (sample - mean) in Q8 so it fits in 25 bits - the output is Q31
+    void applyWindow(int32_t *input);
 };
\ No newline at end of file
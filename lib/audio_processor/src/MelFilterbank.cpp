@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include "MelFilterbank.h"
+
+static float hz_to_mel(float frequency)
+{
+    return 2595.0f * log10f(1.0f + frequency / 700.0f);
+}
+
+static float mel_to_hz(float mel)
+{
+    return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+MelFilterbank::MelFilterbank(int fft_size, int sample_rate, int number_of_bands, float low_frequency, float high_frequency)
+{
+    m_number_of_bands = number_of_bands;
+    int number_of_bins = fft_size / 2 + 1;
+    m_starts = static_cast<int *>(malloc(sizeof(int) * number_of_bands));
+    m_lengths = static_cast<int *>(malloc(sizeof(int) * number_of_bands));
+    m_weight_offsets = static_cast<int *>(malloc(sizeof(int) * number_of_bands));
+    // the bins overlap at most two filters plus one weight for any filter that is narrower than a bin
+    int max_weights = 2 * number_of_bins + number_of_bands;
+    m_weights = static_cast<float *>(malloc(sizeof(float) * max_weights));
+    m_fixed_weights = static_cast<uint32_t *>(malloc(sizeof(uint32_t) * max_weights));
+    // the edges of the filters are evenly spaced in mel - filter b goes from edge b to edge b + 2 with its peak at edge b + 1
+    float low_mel = hz_to_mel(low_frequency);
+    float mel_step = (hz_to_mel(high_frequency) - low_mel) / (number_of_bands + 1);
+    float bin_width = (float)sample_rate / fft_size;
+    int weight_count = 0;
+    for (int band = 0; band < number_of_bands; band++)
+    {
+        float left = mel_to_hz(low_mel + band * mel_step);
+        float center = mel_to_hz(low_mel + (band + 1) * mel_step);
+        float right = mel_to_hz(low_mel + (band + 2) * mel_step);
+        int start = -1;
+        int length = 0;
+        m_weight_offsets[band] = weight_count;
+        for (int bin = (int)(left / bin_width); bin < number_of_bins && bin * bin_width < right; bin++)
+        {
+            float frequency = bin * bin_width;
+            float weight = frequency <= center ? (frequency - left) / (center - left) : (right - frequency) / (right - center);
+            if (weight <= 0)
+            {
+                continue;
+            }
+            if (start < 0)
+            {
+                start = bin;
+            }
+            m_weights[weight_count + length] = weight;
+            length++;
+        }
+        // the lowest filters can be narrower than a bin - use the nearest bin so the band isn't always empty
+        if (length == 0)
+        {
+            start = std::min(number_of_bins - 1, (int)lroundf(center / bin_width));
+            m_weights[weight_count] = 1.0f;
+            length = 1;
+        }
+        m_starts[band] = start;
+        m_lengths[band] = length;
+        for (int i = weight_count; i < weight_count + length; i++)
+        {
+            m_fixed_weights[i] = lroundf(m_weights[i] * 65536.0f);
+        }
+        weight_count += length;
+    }
+}
+
+MelFilterbank::~MelFilterbank()
+{
+    free(m_starts);
+    free(m_lengths);
+    free(m_weight_offsets);
+    free(m_weights);
+    free(m_fixed_weights);
+}
@@ -0,0 +1,49 @@
+#ifndef _mel_filterbank_h_
+#define _mel_filterbank_h_
+
+#include <stdint.h>
+
+/**
+ * Triangular filters spaced evenly on the mel scale that turn the power spectrum into mel band energies.
+ *
+ * Each filter only covers a handful of FFT bins so the filter matrix is stored sparsely - for each band the first
+ * bin, the number of bins and the weights for those bins. The filters are HTK style with a peak of 1.
+ **/
+class MelFilterbank
+{
+private:
+    int m_number_of_bands;
+    int *m_starts;
+    int *m_lengths;
+    // the weights of band b start at m_weights + m_weight_offsets[b]
+    int *m_weight_offsets;
+    float *m_weights;
+    // the same weights in Q16 for the fixed point frontend
+    uint32_t *m_fixed_weights;
+
+public:
+    MelFilterbank(int fft_size, int sample_rate, int number_of_bands, float low_frequency, float high_frequency);
+    ~MelFilterbank();
+    int getNumberOfBands()
+    {
+        return m_number_of_bands;
+    }
+    int getStart(int band)
+    {
+        return m_starts[band];
+    }
+    int getLength(int band)
+    {
+        return m_lengths[band];
+    }
+    const float *getWeights(int band)
+    {
+        return m_weights + m_weight_offsets[band];
+    }
+    const uint32_t *getFixedWeights(int band)
+    {
+        return m_fixed_weights + m_weight_offsets[band];
+    }
+};
+
+#endif
@@ -0,0 +1,121 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+#include "NoiseReductionPCAN.h"
+
+// the smoothing coefficients are Q14
+#define NOISE_REDUCTION_BITS 14
+// the noise estimate is kept scaled up by this many bits for precision - micro_features uses 10 but our channel
+// amplitudes can be up to 23 bits so we can only spare 8
+#define NOISE_SMOOTHING_BITS 8
+// how quickly the noise estimates follow the signal - the even and odd channels use different rates (0.025 and 0.06)
+#define EVEN_SMOOTHING 410
+#define ODD_SMOOTHING 983
+// never take away more than 95% of the signal (0.05)
+#define MIN_SIGNAL_REMAINING 819
+// the signal to noise ratio is Q12 and the output is Q6
+#define PCAN_SNR_BITS 12
+#define PCAN_OUTPUT_BITS 6
+// the gain table has 4 entries for each power of two the noise estimate can be in
+#define GAIN_LUT_BITS 32
+#define GAIN_LUT_SIZE (4 * GAIN_LUT_BITS - 3)
+
+static int16_t gain_function(float strength, float offset, int gain_bits, uint32_t noise_estimate)
+{
+    float x = (float)noise_estimate / (1 << NOISE_SMOOTHING_BITS);
+    float gain = (1 << gain_bits) * powf(x + offset, -strength);
+    return gain > INT16_MAX ? INT16_MAX : (int16_t)(gain + 0.5f);
+}
+
+NoiseReductionPCAN::NoiseReductionPCAN(int number_of_channels, float strength, float offset, int gain_bits)
+{
+    m_number_of_channels = number_of_channels;
+    m_estimate = static_cast<uint32_t *>(malloc(sizeof(uint32_t) * number_of_channels));
+    m_snr_shift = gain_bits - PCAN_SNR_BITS;
+    // the gain for 0 and 1 goes straight in the table, for everything else there is a quadratic for each power of
+    // two going through the gain at the start, middle and end of the range. The quadratic for the range starting
+    // at 2^(n-1) is at 4n - 6.
+    m_gain_lut = static_cast<int16_t *>(calloc(GAIN_LUT_SIZE, sizeof(int16_t)));
+    m_gain_lut[0] = gain_function(strength, offset, gain_bits, 0);
+    m_gain_lut[1] = gain_function(strength, offset, gain_bits, 1);
+    for (int interval = 2; interval <= GAIN_LUT_BITS; interval++)
+    {
+        uint32_t x0 = (uint32_t)1 << (interval - 1);
+        uint32_t x1 = x0 + (x0 >> 1);
+        uint32_t x2 = interval == GAIN_LUT_BITS ? x0 + (x0 - 1) : 2 * x0;
+        int16_t y0 = gain_function(strength, offset, gain_bits, x0);
+        int16_t y1 = gain_function(strength, offset, gain_bits, x1);
+        int16_t y2 = gain_function(strength, offset, gain_bits, x2);
+        int32_t diff1 = (int32_t)y1 - y0;
+        int32_t diff2 = (int32_t)y2 - y0;
+        int32_t a1 = 4 * diff1 - diff2;
+        int32_t a2 = diff2 - a1;
+        m_gain_lut[4 * interval - 6] = y0;
+        m_gain_lut[4 * interval - 5] = a1;
+        m_gain_lut[4 * interval - 4] = a2;
+    }
+    reset();
+}
+
+NoiseReductionPCAN::~NoiseReductionPCAN()
+{
+    free(m_estimate);
+    free(m_gain_lut);
+}
+
+void NoiseReductionPCAN::reset()
+{
+    memset(m_estimate, 0, sizeof(uint32_t) * m_number_of_channels);
+}
+
+// look up the gain for a noise estimate - the top bit picks the quadratic and the next 10 bits are where we are
+// along it in Q10
+int16_t NoiseReductionPCAN::get_gain(uint32_t x)
+{
+    if (x <= 2)
+    {
+        return m_gain_lut[x];
+    }
+    int interval = 32 - __builtin_clz(x);
+    const int16_t *lut = m_gain_lut + 4 * interval - 6;
+    int32_t frac = (interval < 11 ? x << (11 - interval) : x >> (interval - 11)) & 0x3ff;
+    int32_t result = (lut[2] * frac) >> 5;
+    result += lut[1] * 32;
+    result *= frac;
+    result = (result + (1 << 14)) >> 15;
+    // the interpolation can undershoot a little where the gain is close to 0
+    return std::max(0, result + lut[0]);
+}
+
+void NoiseReductionPCAN::process(uint32_t *signal, bool update)
+{
+    for (int i = 0; i < m_number_of_channels; i++)
+    {
+        // noise reduction - update the estimate of the noise and take it away from the signal
+        uint32_t smoothing = (i & 1) == 0 ? EVEN_SMOOTHING : ODD_SMOOTHING;
+        uint32_t one_minus_smoothing = (1 << NOISE_REDUCTION_BITS) - smoothing;
+        uint32_t amplitude = std::min(signal[i], UINT32_MAX >> NOISE_SMOOTHING_BITS);
+        uint32_t scaled_up = amplitude << NOISE_SMOOTHING_BITS;
+        uint32_t estimate = ((uint64_t)scaled_up * smoothing + (uint64_t)m_estimate[i] * one_minus_smoothing) >> NOISE_REDUCTION_BITS;
+        if (update)
+        {
+            m_estimate[i] = estimate;
+        }
+        uint32_t floor = ((uint64_t)amplitude * MIN_SIGNAL_REMAINING) >> NOISE_REDUCTION_BITS;
+        uint32_t subtracted = (scaled_up - std::min(estimate, scaled_up)) >> NOISE_SMOOTHING_BITS;
+        amplitude = std::max(subtracted, floor);
+        // PCAN - divide by the noise estimate to the power of the strength to get a Q12 signal to noise ratio
+        uint32_t snr = ((uint64_t)amplitude * get_gain(estimate)) >> m_snr_shift;
+        // and compress it - quadratic below 2 and linear above
+        if (snr < (2 << PCAN_SNR_BITS))
+        {
+            signal[i] = (snr * snr) >> (2 + 2 * PCAN_SNR_BITS - PCAN_OUTPUT_BITS);
+        }
+        else
+        {
+            signal[i] = (snr >> (PCAN_SNR_BITS - PCAN_OUTPUT_BITS)) - (1 << PCAN_OUTPUT_BITS);
+        }
+    }
+}
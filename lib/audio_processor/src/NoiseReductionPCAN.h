@@ -0,0 +1,40 @@
+#ifndef _noise_reduction_pcan_h_
+#define _noise_reduction_pcan_h_
+
+#include <stdint.h>
+
+/**
+ * Noise reduction and per channel energy normalisation (PCAN) of the frontend channels - the same algorithm
+ * as the TensorFlow Lite Micro micro_features frontend.
+ *
+ * Each channel keeps a smoothed estimate of its noise floor which is subtracted from the signal, then the signal
+ * is divided by (roughly) the noise estimate raised to the PCAN strength and compressed. This takes out slowly
+ * changing background noise and evens out the loudness of the channels. Everything is fixed point - the gain
+ * comes from a lookup table with quadratic interpolation between powers of two.
+ *
+ * The noise estimate is updated every time a frame goes through process so each hop should only be processed once
+ * and in order.
+ **/
+class NoiseReductionPCAN
+{
+private:
+    int m_number_of_channels;
+    // the noise estimate of each channel scaled up by NOISE_SMOOTHING_BITS
+    uint32_t *m_estimate;
+    int16_t *m_gain_lut;
+    int m_snr_shift;
+
+    int16_t get_gain(uint32_t noise_estimate);
+
+public:
+    // offset is in the same units as the channel amplitudes
+    NoiseReductionPCAN(int number_of_channels, float strength = 0.95f, float offset = 80.0f, int gain_bits = 21);
+    ~NoiseReductionPCAN();
+    // forget the noise estimates
+    void reset();
+    // signal is the amplitude of each channel and gets replaced with the noise reduced and normalised value - the
+    // noise estimates are left alone if update is false
+    void process(uint32_t *signal, bool update);
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <algorithm>
+#include "SlidingWindowStats.h"
+#include "RingBuffer.h"
+
+MonotonicQueue::MonotonicQueue(int capacity, bool is_max)
+{
+    m_capacity = capacity;
+    m_is_max = is_max;
+    m_hops = static_cast<uint64_t *>(malloc(sizeof(uint64_t) * capacity));
+    m_values = static_cast<int16_t *>(malloc(sizeof(int16_t) * capacity));
+    clear();
+}
+
+MonotonicQueue::~MonotonicQueue()
+{
+    free(m_hops);
+    free(m_values);
+}
+
+void MonotonicQueue::clear()
+{
+    m_head = 0;
+    m_count = 0;
+}
+
+void MonotonicQueue::push(uint64_t hop, int16_t value)
+{
+    // anything at the back that isn't more extreme than the new value can never be the front again
+    while (m_count > 0)
+    {
+        int16_t back = m_values[(m_head + m_count - 1) % m_capacity];
+        if (m_is_max ? back > value : back < value)
+        {
+            break;
+        }
+        m_count--;
+    }
+    int tail = (m_head + m_count) % m_capacity;
+    m_hops[tail] = hop;
+    m_values[tail] = value;
+    m_count++;
+}
+
+void MonotonicQueue::drop_before(uint64_t hop)
+{
+    while (m_count > 0 && m_hops[m_head] < hop)
+    {
+        m_head = (m_head + 1) % m_capacity;
+        m_count--;
+    }
+}
+
+SlidingWindowStats::SlidingWindowStats(int hop_size, int window_hops)
+{
+    m_hop_size = hop_size;
+    m_window_hops = window_hops;
+    m_hop_sums = static_cast<int32_t *>(malloc(sizeof(int32_t) * window_hops));
+    m_max_queue = new MonotonicQueue(window_hops, true);
+    m_min_queue = new MonotonicQueue(window_hops, false);
+    reset();
+}
+
+SlidingWindowStats::~SlidingWindowStats()
+{
+    free(m_hop_sums);
+    delete m_max_queue;
+    delete m_min_queue;
+}
+
+void SlidingWindowStats::reset()
+{
+    m_sum = 0;
+    m_start_hop = 0;
+    m_end_hop = 0;
+    m_tail_sum = 0;
+    m_tail_min = INT16_MAX;
+    m_tail_max = INT16_MIN;
+    m_max_queue->clear();
+    m_min_queue->clear();
+}
+
+// the sum, min and max of count samples starting at start
+void SlidingWindowStats::get_stats(RingBufferAccessor *reader, uint64_t start, int count, int64_t &sum, int16_t &min_sample, int16_t &max_sample)
+{
+    RingBufferSpan spans[2];
+    int span_count = reader->getSpans(start, count, spans);
+    sum = 0;
+    min_sample = INT16_MAX;
+    max_sample = INT16_MIN;
+    for (int span = 0; span < span_count; span++)
+    {
+        const int16_t *samples = spans[span].samples;
+        int length = spans[span].length;
+        // a span is at most the size of the ring buffer so a 32 bit sum cannot overflow
+        int32_t span_sum = 0;
+        for (int i = 0; i < length; i++)
+        {
+            span_sum += samples[i];
+            min_sample = std::min(min_sample, samples[i]);
+            max_sample = std::max(max_sample, samples[i]);
+        }
+        sum += span_sum;
+    }
+}
+
+void SlidingWindowStats::add_hop(RingBufferAccessor *reader, uint64_t hop)
+{
+    int64_t sum;
+    int16_t min_sample, max_sample;
+    get_stats(reader, hop * m_hop_size, m_hop_size, sum, min_sample, max_sample);
+    m_hop_sums[hop % m_window_hops] = (int32_t)sum;
+    m_sum += sum;
+    m_max_queue->push(hop, max_sample);
+    m_min_queue->push(hop, min_sample);
+}
+
+void SlidingWindowStats::update(RingBufferAccessor *reader, uint64_t start_hop)
+{
+    uint64_t end_hop = start_hop + m_window_hops;
+    // only hops that have been completely written can be kept - the samples after them are still changing
+    uint64_t written_end_hop = std::max(start_hop, std::min(end_hop, reader->getWritePosition() / m_hop_size));
+    if (start_hop < m_start_hop || start_hop >= m_end_hop)
+    {
+        // moved backwards or none of the hops we've seen are still in the window - start again
+        reset();
+        m_start_hop = start_hop;
+        m_end_hop = start_hop;
+    }
+    // drop the hops that have slid out of the window
+    for (; m_start_hop < start_hop; m_start_hop++)
+    {
+        m_sum -= m_hop_sums[m_start_hop % m_window_hops];
+    }
+    m_max_queue->drop_before(start_hop);
+    m_min_queue->drop_before(start_hop);
+    // and add the new ones
+    for (; m_end_hop < written_end_hop; m_end_hop++)
+    {
+        add_hop(reader, m_end_hop);
+    }
+    // the rest of the window hasn't been written yet so it gets read again next time
+    m_tail_sum = 0;
+    m_tail_min = INT16_MAX;
+    m_tail_max = INT16_MIN;
+    if (m_end_hop < end_hop)
+    {
+        get_stats(reader, m_end_hop * m_hop_size, (end_hop - m_end_hop) * m_hop_size, m_tail_sum, m_tail_min, m_tail_max);
+    }
+}
+
+void SlidingWindowStats::get_normalisation(float &mean, float &max)
+{
+    mean = (float)(m_sum + m_tail_sum) / (m_window_hops * m_hop_size);
+    int16_t max_sample = m_max_queue->empty() ? m_tail_max : std::max(m_max_queue->front(), m_tail_max);
+    int16_t min_sample = m_min_queue->empty() ? m_tail_min : std::min(m_min_queue->front(), m_tail_min);
+    max = std::max((float)max_sample - mean, mean - (float)min_sample);
+}
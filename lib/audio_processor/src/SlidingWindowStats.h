@@ -0,0 +1,76 @@
+#ifndef _sliding_window_stats_h_
+#define _sliding_window_stats_h_
+
+#include <stdint.h>
+
+class RingBufferAccessor;
+
+/**
+ * Fixed capacity monotonic queue of per hop values - the front is always the extreme value of the hops
+ * that are still in the window
+ **/
+class MonotonicQueue
+{
+private:
+    uint64_t *m_hops;
+    int16_t *m_values;
+    int m_capacity;
+    int m_head;
+    int m_count;
+    bool m_is_max;
+
+public:
+    MonotonicQueue(int capacity, bool is_max);
+    ~MonotonicQueue();
+    void clear();
+    void push(uint64_t hop, int16_t value);
+    // drop any hops that are before the start of the window
+    void drop_before(uint64_t hop);
+    bool empty()
+    {
+        return m_count == 0;
+    }
+    int16_t front()
+    {
+        return m_values[m_head];
+    }
+};
+
+/**
+ * Keeps track of the sum, min and max of a window of samples that slides forward a hop at a time, so
+ * only the samples in new hops need to be looked at to get the mean and the absolute max. Hops that
+ * haven't been completely written yet are read again on every update until they have been.
+ **/
+class SlidingWindowStats
+{
+private:
+    int m_hop_size;
+    int m_window_hops;
+    // the sum of each hop in the window indexed by hop number
+    int32_t *m_hop_sums;
+    int64_t m_sum;
+    MonotonicQueue *m_max_queue;
+    MonotonicQueue *m_min_queue;
+    // the hops that are currently in the window [m_start_hop, m_end_hop)
+    uint64_t m_start_hop;
+    uint64_t m_end_hop;
+    // the stats of the rest of the window after m_end_hop - these hops are still being written
+    int64_t m_tail_sum;
+    int16_t m_tail_min;
+    int16_t m_tail_max;
+
+    void get_stats(RingBufferAccessor *reader, uint64_t start, int count, int64_t &sum, int16_t &min_sample, int16_t &max_sample);
+    void add_hop(RingBufferAccessor *reader, uint64_t hop);
+
+public:
+    SlidingWindowStats(int hop_size, int window_hops);
+    ~SlidingWindowStats();
+    // forget everything - the next update will read the whole window
+    void reset();
+    // move the window so it covers the hops [start_hop, start_hop + window_hops), reading only the hops we haven't seen
+    void update(RingBufferAccessor *reader, uint64_t start_hop);
+    // the mean of the window and the absolute max of the samples taking into account the mean
+    void get_normalisation(float &mean, float &max);
+};
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef _static_real_fft_h_
+#define _static_real_fft_h_
+
+#include "./kissfft/kiss_fft.h"
+#include "FFTBackend.h"
+
+/**
+ * Real FFTs for the sizes we actually use (256, 512 and 1024 points) with everything worked out at compile time.
+ *
+ * The twiddle factors are constexpr tables so they end up in flash instead of being calculated with sin/cos
+ * and allocated on the heap at startup, and the plan is a chain of templates with the strides fixed at compile
+ * time. The radix 4 butterflies come from the FFT backend (see FFTBackend.h) so they can use SIMD.
+ *
+ * It uses the same algorithm as kiss_fftr - an N/2 point complex FFT of the even/odd samples followed by a
+ * pass to split out the real FFT - but it adds things up in a different order so it isn't bit for bit the same.
+ * For windowed audio every point is within 2e-7 of the largest output point - relative to its own size the error
+ * grows as the point gets smaller, up to around 1e-4 for points a thousandth of the largest (see test_batched_real_fft).
+ *
+ * Works with C++11 so constexpr functions are a single return statement.
+ **/
+namespace static_fft
+{
+    // compile time sin and cos - x must be in [-pi, pi] for the taylor series to converge quickly
+    constexpr double taylor(double x, double term, int n)
+    {
+        return n > 40 ? 0.0 : term + taylor(x, -term * x * x / ((n + 1) * (n + 2)), n + 2);
+    }
+    constexpr double const_sin(double x)
+    {
+        return taylor(x, x, 1);
+    }
+    constexpr double const_cos(double x)
+    {
+        return taylor(x, 1.0, 0);
+    }
+    // angle of -2 * pi * i / n wrapped into [-pi, pi]
+    constexpr double twiddle_angle(int i, int n)
+    {
+        return -2.0 * 3.14159265358979323846 * (i > n / 2 ? i - n : i) / n;
+    }
+    // exp(-2 * pi * i * j / n)
+    constexpr kiss_fft_cpx twiddle(int i, int n)
+    {
+        return kiss_fft_cpx{(float)const_cos(twiddle_angle(i, n)), (float)const_sin(twiddle_angle(i, n))};
+    }
+    // exp(-j * pi * ((i + 1) / n + 0.5)) - the twiddles for splitting the real FFT out of the complex one
+    constexpr kiss_fft_cpx super_twiddle(int i, int n)
+    {
+        return twiddle(i + 1 + n / 2, 2 * n);
+    }
+
+    // C++11 doesn't have std::index_sequence - this builds one by doubling to keep the template depth down
+    template <int... I>
+    struct IndexSequence
+    {
+    };
+    template <class A, class B>
+    struct Concat;
+    template <int... I, int... J>
+    struct Concat<IndexSequence<I...>, IndexSequence<J...>>
+    {
+        typedef IndexSequence<I..., (int)(sizeof...(I) + J)...> type;
+    };
+    template <int N>
+    struct MakeIndexSequence
+    {
+        typedef typename Concat<typename MakeIndexSequence<N / 2>::type, typename MakeIndexSequence<N - N / 2>::type>::type type;
+    };
+    template <>
+    struct MakeIndexSequence<0>
+    {
+        typedef IndexSequence<> type;
+    };
+    template <>
+    struct MakeIndexSequence<1>
+    {
+        typedef IndexSequence<0> type;
+    };
+
+    // twiddles for an n point complex FFT
+    template <int N, class Sequence = typename MakeIndexSequence<N>::type>
+    struct Twiddles;
+    template <int N, int... I>
+    struct Twiddles<N, IndexSequence<I...>>
+    {
+        static const kiss_fft_cpx values[N];
+    };
+    template <int N, int... I>
+    const kiss_fft_cpx Twiddles<N, IndexSequence<I...>>::values[N] = {twiddle(I, N)...};
+
+    // twiddles for splitting an n point complex FFT into a 2n point real FFT
+    template <int N, class Sequence = typename MakeIndexSequence<N / 2>::type>
+    struct SuperTwiddles;
+    template <int N, int... I>
+    struct SuperTwiddles<N, IndexSequence<I...>>
+    {
+        static const kiss_fft_cpx values[N / 2];
+    };
+    template <int N, int... I>
+    const kiss_fft_cpx SuperTwiddles<N, IndexSequence<I...>>::values[N / 2] = {super_twiddle(I, N)...};
+
+    static inline kiss_fft_cpx multiply(const kiss_fft_cpx &a, const kiss_fft_cpx &b)
+    {
+        return kiss_fft_cpx{a.r * b.r - a.i * b.i, a.r * b.i + a.i * b.r};
+    }
+
+    // twiddles for one radix 4 stage laid out as three runs of SUB values - w^k, w^2k and w^3k - so that the
+    // butterflies can load them straight into vector registers
+    template <int NC, int SUB, int FSTRIDE, class Sequence = typename MakeIndexSequence<3 * SUB>::type>
+    struct StageTwiddles;
+    template <int NC, int SUB, int FSTRIDE, int... I>
+    struct StageTwiddles<NC, SUB, FSTRIDE, IndexSequence<I...>>
+    {
+        static const kiss_fft_cpx values[3 * SUB];
+    };
+    template <int NC, int SUB, int FSTRIDE, int... I>
+    const kiss_fft_cpx StageTwiddles<NC, SUB, FSTRIDE, IndexSequence<I...>>::values[3 * SUB] = {twiddle((I / SUB + 1) * (I % SUB) * FSTRIDE, NC)...};
+
+    /**
+     * One stage of an NC point decimation in time complex FFT - this does the M point FFT of every FSTRIDE'th
+     * input by doing 4 FFTs of size M/4 and combining them with the backend's radix 4 butterfly
+     **/
+    template <int NC, int M, int FSTRIDE>
+    struct ComplexStage
+    {
+        static_assert(M % 4 == 0, "Only power of two FFT sizes are supported");
+        static const int SUB = M / 4;
+
+        static inline void run(const kiss_fft_cpx *in, kiss_fft_cpx *out, butterfly4_fn butterfly4)
+        {
+            for (int q = 0; q < 4; q++)
+            {
+                ComplexStage<NC, SUB, FSTRIDE * 4>::run(in + q * FSTRIDE, out + q * SUB, butterfly4);
+            }
+            butterfly4(out, StageTwiddles<NC, SUB, FSTRIDE>::values, SUB);
+        }
+    };
+    // the last stages are 4 or 2 point FFTs of the input - all the twiddles are 1 so there are no multiplies
+    template <int NC, int FSTRIDE>
+    struct ComplexStage<NC, 4, FSTRIDE>
+    {
+        static inline void run(const kiss_fft_cpx *in, kiss_fft_cpx *out, butterfly4_fn)
+        {
+            const kiss_fft_cpx x0 = in[0];
+            const kiss_fft_cpx x1 = in[FSTRIDE];
+            const kiss_fft_cpx x2 = in[2 * FSTRIDE];
+            const kiss_fft_cpx x3 = in[3 * FSTRIDE];
+            const kiss_fft_cpx s5 = {x0.r - x2.r, x0.i - x2.i};
+            const kiss_fft_cpx f0 = {x0.r + x2.r, x0.i + x2.i};
+            const kiss_fft_cpx s3 = {x1.r + x3.r, x1.i + x3.i};
+            const kiss_fft_cpx s4 = {x1.r - x3.r, x1.i - x3.i};
+            out[0].r = f0.r + s3.r;
+            out[0].i = f0.i + s3.i;
+            out[1].r = s5.r + s4.i;
+            out[1].i = s5.i - s4.r;
+            out[2].r = f0.r - s3.r;
+            out[2].i = f0.i - s3.i;
+            out[3].r = s5.r - s4.i;
+            out[3].i = s5.i + s4.r;
+        }
+    };
+    template <int NC, int FSTRIDE>
+    struct ComplexStage<NC, 2, FSTRIDE>
+    {
+        static inline void run(const kiss_fft_cpx *in, kiss_fft_cpx *out, butterfly4_fn)
+        {
+            const kiss_fft_cpx x0 = in[0];
+            const kiss_fft_cpx x1 = in[FSTRIDE];
+            out[0].r = x0.r + x1.r;
+            out[0].i = x0.i + x1.i;
+            out[1].r = x0.r - x1.r;
+            out[1].i = x0.i - x1.i;
+        }
+    };
+}
+
+template <int N>
+class StaticRealFFT
+{
+private:
+    static const int NC = N / 2;
+
+public:
+    /**
+     * input has N real samples, output has N/2 + 1 complex points
+     **/
+    static void transform(const float *input, kiss_fft_cpx *output)
+    {
+        // treat the real input as NC complex values and do the complex FFT straight into the output
+        static_fft::ComplexStage<NC, NC, 1>::run(reinterpret_cast<const kiss_fft_cpx *>(input), output, get_fft_backend()->butterfly4);
+        // split out the real FFT - each pair of outputs only depends on the same pair of inputs so this works in place
+        const kiss_fft_cpx *super_twiddles = static_fft::SuperTwiddles<NC>::values;
+        const kiss_fft_cpx dc = output[0];
+        output[0].r = dc.r + dc.i;
+        output[0].i = 0;
+        output[NC].r = dc.r - dc.i;
+        output[NC].i = 0;
+        for (int k = 1; k <= NC / 2; k++)
+        {
+            const kiss_fft_cpx fpk = output[k];
+            const kiss_fft_cpx fpnk = {output[NC - k].r, -output[NC - k].i};
+            const kiss_fft_cpx f1k = {fpk.r + fpnk.r, fpk.i + fpnk.i};
+            const kiss_fft_cpx f2k = {fpk.r - fpnk.r, fpk.i - fpnk.i};
+            const kiss_fft_cpx tw = static_fft::multiply(f2k, super_twiddles[k - 1]);
+            output[k].r = 0.5f * (f1k.r + tw.r);
+            output[k].i = 0.5f * (f1k.i + tw.i);
+            output[NC - k].r = 0.5f * (f1k.r - tw.r);
+            output[NC - k].i = 0.5f * (tw.i - f1k.i);
+        }
+    }
+};
+
+/**
+ * Run the compile time FFT for nfft if there is one - returns false if the caller needs to fall back to kiss_fftr
+ **/
+inline bool static_real_fft(int nfft, const float *input, kiss_fft_cpx *output)
+{
+    switch (nfft)
+    {
+    case 256:
+        StaticRealFFT<256>::transform(input, output);
+        return true;
+    case 512:
+        StaticRealFFT<512>::transform(input, output);
+        return true;
+    case 1024:
+        StaticRealFFT<1024>::transform(input, output);
+        return true;
+    default:
+        return false;
+    }
+}
+
+inline bool has_static_real_fft(int nfft)
+{
+    return nfft == 256 || nfft == 512 || nfft == 1024;
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include <stdlib.h>
+#include <algorithm>
+#include "VoiceActivityDetector.h"
+#include "RingBuffer.h"
+
+// the noise floor drops quickly and rises slowly so speech doesn't get absorbed into it
+#define NOISE_FLOOR_FALL 0.1f
+#define NOISE_FLOOR_RISE 0.002f
+#define DC_OFFSET_RATE 0.05f
+// never let the noise floor get to zero or digital silence would make everything look like speech
+#define MIN_NOISE_FLOOR 1.0f
+
+VoiceActivityDetector::VoiceActivityDetector(int frame_size, float speech_threshold, float release_threshold, float max_zero_crossing_rate, int hangover_frames)
+{
+    m_frame_size = frame_size;
+    m_speech_threshold = speech_threshold;
+    m_release_threshold = release_threshold;
+    m_max_zero_crossing_rate = max_zero_crossing_rate;
+    m_hangover_frames = hangover_frames;
+    m_position = 0;
+    m_started = false;
+    m_noise_floor = -1;
+    m_dc_offset = 0;
+    reset_frame();
+    m_last_sample_positive = false;
+    m_active = false;
+    m_quiet_frames = 0;
+}
+
+void VoiceActivityDetector::process_frame()
+{
+    // energy of the frame around its own mean
+    float mean = (float)m_frame_sum / m_frame_length;
+    float energy = (float)m_frame_sum_squares / m_frame_length - mean * mean;
+    float zero_crossing_rate = (float)m_frame_zero_crossings / m_frame_length;
+    m_dc_offset += (mean - m_dc_offset) * DC_OFFSET_RATE;
+    if (m_noise_floor < 0)
+    {
+        // first frame - assume we are starting off in the quiet
+        m_noise_floor = std::max(energy, MIN_NOISE_FLOOR);
+    }
+    bool speech = energy > m_noise_floor * m_speech_threshold && zero_crossing_rate < m_max_zero_crossing_rate;
+    if (speech)
+    {
+        m_active = true;
+        m_quiet_frames = 0;
+    }
+    else if (energy < m_noise_floor * m_release_threshold)
+    {
+        // only count down the hangover once we're properly back to the noise floor
+        m_quiet_frames++;
+        if (m_quiet_frames > m_hangover_frames)
+        {
+            m_active = false;
+        }
+    }
+    // track the noise floor
+    float rate = energy < m_noise_floor ? NOISE_FLOOR_FALL : NOISE_FLOOR_RISE;
+    m_noise_floor = std::max(m_noise_floor + (energy - m_noise_floor) * rate, MIN_NOISE_FLOOR);
+    // and start on the next frame
+    reset_frame();
+}
+
+void VoiceActivityDetector::reset_frame()
+{
+    m_frame_length = 0;
+    m_frame_sum = 0;
+    m_frame_sum_squares = 0;
+    m_frame_zero_crossings = 0;
+}
+
+bool VoiceActivityDetector::process(RingBufferAccessor *reader)
+{
+    uint64_t write_position = reader->getWritePosition();
+    // the first time through (or if we've not been called for a while) only look at the last hangover period
+    uint64_t earliest = write_position - std::min<uint64_t>(write_position, (uint64_t)m_hangover_frames * m_frame_size);
+    // and skip anything that's been overwritten
+    earliest += reader->getOverwritten(earliest);
+    if (!m_started || m_position < earliest)
+    {
+        m_position = earliest;
+        reset_frame();
+        m_started = true;
+    }
+    RingBufferSpan spans[2];
+    int span_count = reader->getSpans(m_position, write_position - m_position, spans);
+    int dc_offset = (int)m_dc_offset;
+    for (int span = 0; span < span_count; span++)
+    {
+        const int16_t *samples = spans[span].samples;
+        int length = spans[span].length;
+        int i = 0;
+        while (i < length)
+        {
+            // work through the samples a frame at a time
+            int count = std::min(length - i, m_frame_size - m_frame_length);
+            int32_t sum = 0;
+            int64_t sum_squares = 0;
+            int zero_crossings = 0;
+            bool last_positive = m_last_sample_positive;
+            for (int j = i; j < i + count; j++)
+            {
+                int32_t sample = samples[j];
+                sum += sample;
+                sum_squares += sample * sample;
+                bool positive = sample > dc_offset;
+                zero_crossings += positive != last_positive;
+                last_positive = positive;
+            }
+            m_last_sample_positive = last_positive;
+            m_frame_sum += sum;
+            m_frame_sum_squares += sum_squares;
+            m_frame_zero_crossings += zero_crossings;
+            m_frame_length += count;
+            i += count;
+            if (m_frame_length == m_frame_size)
+            {
+                process_frame();
+                dc_offset = (int)m_dc_offset;
+            }
+        }
+    }
+    m_position = write_position;
+    return m_active;
+}
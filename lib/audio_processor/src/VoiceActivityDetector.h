@@ -0,0 +1,60 @@
+#ifndef _voice_activity_detector_h_
+#define _voice_activity_detector_h_
+
+#include <stdint.h>
+
+class RingBufferAccessor;
+
+/**
+ * Cheap streaming voice activity detection so we can skip the spectrogram and the neural network when
+ * there's nothing worth listening to.
+ *
+ * Each frame of samples is checked against a tracked noise floor - a frame is speech like if its energy is
+ * well above the floor and its zero crossing rate isn't as high as broadband noise. We switch on as soon
+ * as we see a speech like frame and stay on until the energy has been close to the noise floor for the
+ * hangover period. The hangover should be at least as long as the window fed to the network so that a
+ * wake word is seen at every position in the window before we stop listening.
+ **/
+class VoiceActivityDetector
+{
+private:
+    int m_frame_size;
+    float m_speech_threshold;
+    float m_release_threshold;
+    float m_max_zero_crossing_rate;
+    int m_hangover_frames;
+    // the next sample to process
+    uint64_t m_position;
+    bool m_started;
+    // running estimates of the noise floor energy and the dc offset
+    float m_noise_floor;
+    float m_dc_offset;
+    // state of the frame we are currently accumulating
+    int m_frame_length;
+    int64_t m_frame_sum;
+    int64_t m_frame_sum_squares;
+    int m_frame_zero_crossings;
+    bool m_last_sample_positive;
+    // hysteresis
+    bool m_active;
+    int m_quiet_frames;
+
+    void reset_frame();
+    void process_frame();
+
+public:
+    VoiceActivityDetector(int frame_size, float speech_threshold, float release_threshold, float max_zero_crossing_rate, int hangover_frames);
+    // run the detector over all the samples that have arrived since the last call - returns true if speech is active
+    bool process(RingBufferAccessor *reader);
+    bool is_active()
+    {
+        return m_active;
+    }
+    // the energy of the background noise per sample - negative until the first frame
+    float get_noise_floor()
+    {
+        return m_noise_floor;
+    }
+};
+
+#endif
@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <algorithm>
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(int number_of_workers)
+{
+    m_number_of_workers = std::max(1, std::min(number_of_workers, MAX_WORKERS));
+    m_job = NULL;
+    m_context = NULL;
+#ifdef ESP_PLATFORM
+    m_finished = xSemaphoreCreateCounting(MAX_WORKERS, 0);
+    m_run_mutex = xSemaphoreCreateMutex();
+    // the task creating the pool is the detector task that runs the jobs as worker 0 - the other workers are pinned to
+    // the cores after it so with 2 workers on the ESP32 the spectrogram is computed on both cores at once rather than the
+    // scheduler putting a worker on the core that is busy with worker 0
+    int run_core = xPortGetCoreID();
+    for (int worker = 1; worker < m_number_of_workers; worker++)
+    {
+        m_worker_params[worker].pool = this;
+        m_worker_params[worker].worker = worker;
+        // they run at the same priority as the task that created them as that's the task they are doing work for
+        xTaskCreatePinnedToCore(workerTask, "Spectrogram Worker", 4096, &m_worker_params[worker], uxTaskPriorityGet(NULL), &m_tasks[worker],
+                                (run_core + worker) % portNUM_PROCESSORS);
+    }
+#else
+    m_generation = 0;
+    m_running = 0;
+    m_stopping = false;
+    for (int worker = 1; worker < m_number_of_workers; worker++)
+    {
+        m_threads[worker] = std::thread(&WorkerPool::workerThread, this, worker);
+    }
+#endif
+    printf("Created a pool of %d workers\n", m_number_of_workers);
+}
+
+WorkerPool::~WorkerPool()
+{
+#ifdef ESP_PLATFORM
+    for (int worker = 1; worker < m_number_of_workers; worker++)
+    {
+        vTaskDelete(m_tasks[worker]);
+    }
+    vSemaphoreDelete(m_finished);
+    vSemaphoreDelete(m_run_mutex);
+#else
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_job_started.notify_all();
+    for (int worker = 1; worker < m_number_of_workers; worker++)
+    {
+        m_threads[worker].join();
+    }
+#endif
+}
+
+#ifdef ESP_PLATFORM
+void WorkerPool::workerTask(void *param)
+{
+    WorkerParams *params = static_cast<WorkerParams *>(param);
+    WorkerPool *pool = params->pool;
+    while (true)
+    {
+        // wait to be told there's a job to do
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        pool->m_job(pool->m_context, params->worker);
+        xSemaphoreGive(pool->m_finished);
+    }
+}
+
+void WorkerPool::run(worker_job_fn job, void *context)
+{
+    if (m_number_of_workers == 1)
+    {
+        job(context, 0);
+        return;
+    }
+    xSemaphoreTake(m_run_mutex, portMAX_DELAY);
+    m_job = job;
+    m_context = context;
+    for (int worker = 1; worker < m_number_of_workers; worker++)
+    {
+        xTaskNotifyGive(m_tasks[worker]);
+    }
+    job(context, 0);
+    // wait for everyone else to finish
+    for (int worker = 1; worker < m_number_of_workers; worker++)
+    {
+        xSemaphoreTake(m_finished, portMAX_DELAY);
+    }
+    xSemaphoreGive(m_run_mutex);
+}
+#else
+void WorkerPool::workerThread(int worker)
+{
+    unsigned int generation = 0;
+    while (true)
+    {
+        worker_job_fn job;
+        void *context;
+        {
+            // wait to be told there's a job to do
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_job_started.wait(lock, [&]
+                               { return m_stopping || m_generation != generation; });
+            if (m_stopping)
+            {
+                return;
+            }
+            generation = m_generation;
+            job = m_job;
+            context = m_context;
+        }
+        job(context, worker);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running--;
+        }
+        m_job_finished.notify_one();
+    }
+}
+
+void WorkerPool::run(worker_job_fn job, void *context)
+{
+    if (m_number_of_workers == 1)
+    {
+        job(context, 0);
+        return;
+    }
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = job;
+        m_context = context;
+        m_running = m_number_of_workers - 1;
+        m_generation++;
+    }
+    m_job_started.notify_all();
+    job(context, 0);
+    // wait for everyone else to finish
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_job_finished.wait(lock, [&]
+                        { return m_running == 0; });
+}
+#endif
+
+WorkerPool *get_worker_pool(int number_of_workers)
+{
+    static WorkerPool *pools[MAX_WORKERS + 1] = {NULL};
+#ifdef ESP_PLATFORM
+    static SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+    xSemaphoreTake(mutex, portMAX_DELAY);
+#else
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    number_of_workers = std::max(1, std::min(number_of_workers, MAX_WORKERS));
+    if (!pools[number_of_workers])
+    {
+        pools[number_of_workers] = new WorkerPool(number_of_workers);
+    }
+    WorkerPool *pool = pools[number_of_workers];
+#ifdef ESP_PLATFORM
+    xSemaphoreGive(mutex);
+#endif
+    return pool;
+}
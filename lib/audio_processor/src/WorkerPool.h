@@ -0,0 +1,77 @@
+#ifndef _worker_pool_h_
+#define _worker_pool_h_
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#else
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+// the most workers a pool can have
+#define MAX_WORKERS 8
+
+typedef void (*worker_job_fn)(void *context, int worker);
+
+/**
+ * A small pool of workers that all run the same job and then wait for the next one - the caller of run is
+ * worker 0 so a pool of N workers has N - 1 tasks (FreeRTOS tasks on the ESP32 and std::threads everywhere
+ * else). Each job tells its worker which part of the work to do from the worker number so the only
+ * synchronisation is starting the workers and waiting for all of them to finish.
+ **/
+class WorkerPool
+{
+private:
+    int m_number_of_workers;
+    // the job that is running
+    worker_job_fn m_job;
+    void *m_context;
+#ifdef ESP_PLATFORM
+    TaskHandle_t m_tasks[MAX_WORKERS];
+    // given by each worker when it has finished the job
+    SemaphoreHandle_t m_finished;
+    // only one job can run at a time
+    SemaphoreHandle_t m_run_mutex;
+    static void workerTask(void *param);
+#else
+    std::thread m_threads[MAX_WORKERS];
+    std::mutex m_mutex;
+    std::condition_variable m_job_started;
+    std::condition_variable m_job_finished;
+    std::mutex m_run_mutex;
+    // incremented for each job so the workers can tell when there's a new one
+    unsigned int m_generation;
+    int m_running;
+    bool m_stopping;
+    void workerThread(int worker);
+#endif
+    struct WorkerParams
+    {
+        WorkerPool *pool;
+        int worker;
+    } m_worker_params[MAX_WORKERS];
+
+    WorkerPool(const WorkerPool &);
+    WorkerPool &operator=(const WorkerPool &);
+
+public:
+    WorkerPool(int number_of_workers);
+    ~WorkerPool();
+    int getNumberOfWorkers()
+    {
+        return m_number_of_workers;
+    }
+    // run job on every worker and wait for them all to finish
+    void run(worker_job_fn job, void *context);
+};
+
+/**
+ * The workers are kept for the life of the app so we don't create tasks every time the wake word detection starts -
+ * this returns the pool with this many workers, creating it the first time.
+ **/
+WorkerPool *get_worker_pool(int number_of_workers);
+
+#endif
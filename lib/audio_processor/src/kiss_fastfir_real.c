@@ -0,0 +1,16 @@
+// Builds kissfft's fast FIR filter (overlap-save filtering using kiss_fftr) for real samples - everything it exports
+// is renamed so it doesn't clash with the complex version in kissfft/tools. See kiss_fastfir_real.h for the interface.
+#include <string.h>
+
+#define REAL_FASTFIR
+#define kiss_fastfir_state kiss_fastfir_real_state
+#define kiss_fastfir_alloc kiss_fastfir_real_alloc
+#define kiss_fastfir kiss_fastfir_real
+// kiss_fastfir moves the samples it hasn't used yet to the front of the input with memcpy and they can overlap
+#define memcpy memmove
+
+// verbose is only used by the command line tool which isn't built
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#include "kissfft/tools/kiss_fastfir.c"
+#pragma GCC diagnostic pop
@@ -0,0 +1,31 @@
+#ifndef KISS_FASTFIR_REAL_H
+#define KISS_FASTFIR_REAL_H
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * kissfft's fast FIR filter built for real samples - the filtering is done with overlap-save, nfft samples
+     * at a time with an nfft point real fft.
+     *
+     * The output lags the input by the number of taps - 1, pad the start of the input with that many zeros to
+     * get the same output as a direct form filter.
+     **/
+    typedef struct kiss_fastfir_real_state *kiss_fastfir_real_cfg;
+
+    // if nfft points to 0 a size is picked and written back to it
+    kiss_fastfir_real_cfg kiss_fastfir_real_alloc(const float *imp_resp, size_t n_imp_resp, size_t *nfft, void *mem, size_t *lenmem);
+    // filters the offset samples at the front of inbuf followed by n_new new samples - returns the number of samples
+    // written to outbuf (always a multiple of nfft - n_imp_resp + 1) and moves the samples that haven't been used
+    // yet to the front of inbuf, setting offset to how many there are
+    size_t kiss_fastfir_real(kiss_fastfir_real_cfg cfg, float *inbuf, float *outbuf, size_t n_new, size_t *offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,17 @@
+// Builds a second copy of kissfft with 32 bit fixed point samples - everything it exports is renamed
+// so that it can live alongside the float build. See kiss_fftr_fixed.h for the interface.
+#define FIXED_POINT 32
+
+#define kiss_fft_state kiss_fft_fixed_state
+#define kiss_fft_alloc kiss_fft_fixed_alloc
+#define kiss_fft_stride kiss_fft_fixed_stride
+#define kiss_fft kiss_fft_fixed
+#define kiss_fft_cleanup kiss_fft_fixed_cleanup
+#define kiss_fft_next_fast_size kiss_fft_fixed_next_fast_size
+#define kiss_fftr_state kiss_fftr_fixed_state
+#define kiss_fftr_alloc kiss_fftr_fixed_alloc
+#define kiss_fftr kiss_fftr_fixed
+#define kiss_fftri kiss_fftri_fixed
+
+#include "kissfft/kiss_fft.c"
+#include "kissfft/tools/kiss_fftr.c"
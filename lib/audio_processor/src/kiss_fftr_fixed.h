@@ -0,0 +1,33 @@
+#ifndef KISS_FFTR_FIXED_H
+#define KISS_FFTR_FIXED_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * A 32 bit fixed point build of kissfft's real fft that can be used alongside the float one.
+     *
+     * The input is Q31 and each stage of the fft scales its output down to avoid overflow, so the output is
+     * the fft of the input divided by nfft.
+     **/
+    typedef struct
+    {
+        int32_t r;
+        int32_t i;
+    } kiss_fft_fixed_cpx;
+
+    typedef struct kiss_fftr_fixed_state *kiss_fftr_fixed_cfg;
+
+    kiss_fftr_fixed_cfg kiss_fftr_fixed_alloc(int nfft, int inverse_fft, void *mem, size_t *lenmem);
+    void kiss_fftr_fixed(kiss_fftr_fixed_cfg cfg, const int32_t *timedata, kiss_fft_fixed_cpx *freqdata);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
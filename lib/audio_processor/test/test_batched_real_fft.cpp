@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "HostTest.h"
+#include "StaticRealFFT.h"
+#include "BatchedRealFFT.h"
+#include "kissfft/tools/kiss_fftr.h"
+
+// the spectrogram batches 8 frames on the host
+#define LANES 8
+
+// points smaller than this are mostly rounding error from the big ones - only the bigger ones are checked point by point
+#define MIN_POINT_MAGNITUDE 1000
+
+/**
+ * How far an FFT is from a reference - as a fraction of the largest magnitude in the reference and as a fraction
+ * of each point's own magnitude. The FFTs add up in a different order to kiss_fftr so the small points pick up
+ * rounding error from the big ones.
+ **/
+struct FFTError
+{
+    double max_difference;
+    double max_magnitude;
+    double max_point_error;
+
+    FFTError()
+    {
+        max_difference = 0;
+        max_magnitude = 0;
+        max_point_error = 0;
+    }
+    void add(float r, float i, const kiss_fft_cpx &reference)
+    {
+        double magnitude = hypot((double)reference.r, (double)reference.i);
+        double difference = hypot((double)r - reference.r, (double)i - reference.i);
+        max_difference = std::max(max_difference, difference);
+        max_magnitude = std::max(max_magnitude, magnitude);
+        if (magnitude > MIN_POINT_MAGNITUDE)
+        {
+            max_point_error = std::max(max_point_error, difference / magnitude);
+        }
+    }
+    double relative()
+    {
+        return max_difference / max_magnitude;
+    }
+};
+
+/**
+ * Batched and single frame real FFTs of windowed speech like audio against kiss_fftr
+ **/
+static void test_against_kiss_fftr(int nfft, double peak_tolerance, double point_tolerance)
+{
+    kiss_fftr_cfg cfg = kiss_fftr_alloc(nfft, 0, NULL, NULL);
+    std::vector<float> frames(LANES * nfft);
+    std::vector<float> batch_input(LANES * nfft);
+    std::vector<BatchComplex<LANES>> batch_output(nfft / 2 + 1);
+    std::vector<kiss_fft_cpx> static_output(nfft / 2 + 1);
+    std::vector<kiss_fft_cpx> reference(nfft / 2 + 1);
+    uint32_t state = 31;
+    FFTError static_error;
+    FFTError batched_error;
+    FFTError batched_static_error;
+    for (int run = 0; run < 10; run++)
+    {
+        // every frame is different so a lane getting another lane's data would show up
+        for (int f = 0; f < LANES; f++)
+        {
+            for (int n = 0; n < nfft; n++)
+            {
+                double t = run * 1000 + f * 97 + n;
+                double window = 0.54 - 0.46 * cos(2 * M_PI * n / (nfft - 1));
+                double sample = 3000 * sin(t * 0.05 * (f + 1)) + 1500 * sin(t * 0.21) + (int)(host_random(state) % 401) - 200;
+                frames[f * nfft + n] = (float)(window * sample);
+                batch_input[n * LANES + f] = frames[f * nfft + n];
+            }
+        }
+        CHECK(batched_real_fft<LANES>(nfft, batch_input.data(), batch_output.data()));
+        for (int f = 0; f < LANES; f++)
+        {
+            kiss_fftr(cfg, &frames[f * nfft], reference.data());
+            CHECK(static_real_fft(nfft, &frames[f * nfft], static_output.data()));
+            for (int k = 0; k <= nfft / 2; k++)
+            {
+                static_error.add(static_output[k].r, static_output[k].i, reference[k]);
+                batched_error.add(batch_output[k].r[f], batch_output[k].i[f], reference[k]);
+                batched_static_error.add(batch_output[k].r[f], batch_output[k].i[f], static_output[k]);
+            }
+        }
+    }
+    printf("%d points: static_real_fft is within %.2g of the peak of kiss_fftr and %.2g of any point over %d, "
+           "batched_real_fft<%d> within %.2g and %.2g (%.2g and %.2g of static_real_fft)\n",
+           nfft, static_error.relative(), static_error.max_point_error, MIN_POINT_MAGNITUDE, LANES, batched_error.relative(),
+           batched_error.max_point_error, batched_static_error.relative(), batched_static_error.max_point_error);
+    CHECK(static_error.relative() < peak_tolerance);
+    CHECK(batched_error.relative() < peak_tolerance);
+    CHECK(batched_static_error.relative() < peak_tolerance);
+    CHECK(static_error.max_point_error < point_tolerance);
+    CHECK(batched_error.max_point_error < point_tolerance);
+    free(cfg);
+}
+
+int main()
+{
+    // measured on the host at 1024 points: 1.5e-7 of the peak and 4.8e-5 of a point against kiss_fftr
+    test_against_kiss_fftr(256, 1e-6, 2e-4);
+    test_against_kiss_fftr(512, 1e-6, 2e-4);
+    test_against_kiss_fftr(1024, 1e-6, 2e-4);
+    return host_test_result("test_batched_real_fft");
+}
@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "HostTest.h"
+#include "FFTBackend.h"
+#include "StaticRealFFT.h"
+#include "kissfft/tools/kiss_fftr.h"
+
+#define MAX_BACKENDS 8
+
+// audio sized samples - the spectrogram's FFT input is windowed 16 bit audio
+static void random_samples(float *samples, int count, uint32_t &state)
+{
+    for (int i = 0; i < count; i++)
+    {
+        samples[i] = (float)((int)(host_random(state) % 65536) - 32768);
+    }
+}
+
+// the largest difference between two sets of complex points as a fraction of the largest magnitude in the reference
+static double relative_error(const kiss_fft_cpx *output, const kiss_fft_cpx *reference, int count)
+{
+    double max_difference = 0;
+    double max_magnitude = 0;
+    for (int i = 0; i < count; i++)
+    {
+        max_difference = std::max(max_difference, (double)fabsf(output[i].r - reference[i].r));
+        max_difference = std::max(max_difference, (double)fabsf(output[i].i - reference[i].i));
+        max_magnitude = std::max(max_magnitude, hypot((double)reference[i].r, (double)reference[i].i));
+    }
+    return max_difference / max_magnitude;
+}
+
+/**
+ * Every backend this CPU can run through the compile time real FFT against kiss_fftr
+ **/
+static void test_real_fft(const FFTBackend *backend, int nfft, double tolerance)
+{
+    kiss_fftr_cfg cfg = kiss_fftr_alloc(nfft, 0, NULL, NULL);
+    std::vector<float> input(nfft);
+    std::vector<kiss_fft_cpx> output(nfft / 2 + 1);
+    std::vector<kiss_fft_cpx> reference(nfft / 2 + 1);
+    uint32_t state = 17;
+    double max_error = 0;
+    set_fft_backend(backend);
+    for (int run = 0; run < 20; run++)
+    {
+        random_samples(input.data(), nfft, state);
+        kiss_fftr(cfg, input.data(), reference.data());
+        CHECK(static_real_fft(nfft, input.data(), output.data()));
+        max_error = std::max(max_error, relative_error(output.data(), reference.data(), nfft / 2 + 1));
+    }
+    printf("%s backend, %d points: differs from kiss_fftr by at most %.2g of the peak\n", backend->name, nfft, max_error);
+    CHECK(max_error < tolerance);
+    free(cfg);
+}
+
+/**
+ * The radix 4 butterfly on its own for sizes the SIMD versions can't do entirely in vectors - the real FFT sizes
+ * only ever have powers of two so the leftovers aren't exercised by them
+ **/
+static void test_butterfly_leftovers(const FFTBackend *backend, const FFTBackend *reference_backend, int m)
+{
+    std::vector<kiss_fft_cpx> data(4 * m);
+    std::vector<kiss_fft_cpx> twiddles(3 * m);
+    uint32_t state = 23;
+    random_samples(reinterpret_cast<float *>(data.data()), 8 * m, state);
+    for (int k = 0; k < 3 * m; k++)
+    {
+        double angle = -2 * M_PI * (k / m + 1) * (k % m) / (4 * m);
+        twiddles[k].r = cos(angle);
+        twiddles[k].i = sin(angle);
+    }
+    std::vector<kiss_fft_cpx> reference = data;
+    reference_backend->butterfly4(reference.data(), twiddles.data(), m);
+    backend->butterfly4(data.data(), twiddles.data(), m);
+    double error = relative_error(data.data(), reference.data(), 4 * m);
+    printf("%s backend, radix 4 butterfly with m = %d: differs from the C version by %.2g of the peak\n", backend->name, m, error);
+    CHECK(error < 1e-6);
+}
+
+int main()
+{
+    const FFTBackend *backends[MAX_BACKENDS];
+    int backend_count = get_supported_fft_backends(backends, MAX_BACKENDS);
+    CHECK(backend_count >= 1);
+    const FFTBackend *best = get_fft_backend();
+    for (int b = 0; b < backend_count; b++)
+    {
+        const int sizes[] = {256, 512, 1024};
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            test_real_fft(backends[b], sizes[s], 1e-6);
+        }
+        const int odd_sizes[] = {1, 3, 5, 6, 7, 9, 13};
+        for (size_t s = 0; s < sizeof(odd_sizes) / sizeof(odd_sizes[0]); s++)
+        {
+            test_butterfly_leftovers(backends[b], backends[0], odd_sizes[s]);
+        }
+    }
+    set_fft_backend(best);
+    return host_test_result("test_fft_backend");
+}
@@ -0,0 +1,60 @@
+#include <stdlib.h>
+#include "HostTest.h"
+#include "FFTPlanCache.h"
+#include "MelFilterbank.h"
+
+static bool same_bands(MelFilterbank *a, MelFilterbank *b)
+{
+    if (a->getNumberOfBands() != b->getNumberOfBands())
+    {
+        return false;
+    }
+    for (int band = 0; band < a->getNumberOfBands(); band++)
+    {
+        if (a->getStart(band) != b->getStart(band) || a->getLength(band) != b->getLength(band))
+        {
+            return false;
+        }
+        for (int i = 0; i < a->getLength(band); i++)
+        {
+            if (a->getWeights(band)[i] != b->getWeights(band)[i])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// filterbanks are only shared when everything they are made from is the same
+static void test_mel_filterbanks()
+{
+    MelFilterbank *filterbank = get_cached_mel_filterbank(512, 40, 16000, 20, 7600);
+    CHECK(get_cached_mel_filterbank(512, 40, 16000, 20, 7600) == filterbank);
+
+    struct
+    {
+        int sample_rate;
+        float low_frequency;
+        float high_frequency;
+    } others[] = {{8000, 20, 3800}, {16000, 125, 7600}, {16000, 20, 4000}};
+    for (size_t i = 0; i < sizeof(others) / sizeof(others[0]); i++)
+    {
+        MelFilterbank *other = get_cached_mel_filterbank(512, 40, others[i].sample_rate, others[i].low_frequency, others[i].high_frequency);
+        CHECK(other != filterbank);
+        // and it has to be the one those parameters make, not whichever was asked for first
+        MelFilterbank expected(512, others[i].sample_rate, 40, others[i].low_frequency, others[i].high_frequency);
+        CHECK(same_bands(other, &expected));
+        CHECK(!same_bands(other, filterbank));
+        CHECK(get_cached_mel_filterbank(512, 40, others[i].sample_rate, others[i].low_frequency, others[i].high_frequency) == other);
+    }
+    // the first one is still there
+    MelFilterbank expected(512, 16000, 40, 20, 7600);
+    CHECK(same_bands(get_cached_mel_filterbank(512, 40, 16000, 20, 7600), &expected));
+}
+
+int main()
+{
+    test_mel_filterbanks();
+    return host_test_result("test_fft_plan_cache");
+}
@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "HostTest.h"
+#include "FIRFilter.h"
+
+#define SAMPLE_RATE 16000
+#define TEST_SAMPLES 20000
+
+// speech like audio over noise - loud enough that the rounding to 16 bits is small next to it
+static std::vector<int16_t> make_audio()
+{
+    std::vector<int16_t> audio(TEST_SAMPLES);
+    uint32_t state = 5;
+    for (int i = 0; i < TEST_SAMPLES; i++)
+    {
+        double envelope = 0.5 + 0.5 * sin(i * 0.001);
+        audio[i] = (int16_t)(envelope * (6000 * sin(i * 0.05) + 3000 * sin(i * 0.31)) + (int)(host_random(state) % 2001) - 1000);
+    }
+    return audio;
+}
+
+// the direct form output in double precision before it's rounded - y[n] = sum taps[k] * x[n - k]
+static std::vector<double> convolve(const std::vector<int16_t> &audio, const std::vector<float> &taps)
+{
+    std::vector<double> output(audio.size());
+    for (size_t n = 0; n < audio.size(); n++)
+    {
+        double sum = 0;
+        for (size_t k = 0; k < taps.size() && k <= n; k++)
+        {
+            sum += (double)taps[k] * audio[n - k];
+        }
+        output[n] = sum;
+    }
+    return output;
+}
+
+/**
+ * Filter the audio in odd sized blocks and compare it with the double precision convolution - the FFT version lags
+ * the direct one by a block so the reference is shifted by however much more getDelay says it is delayed by
+ **/
+static void test_against_convolution(int number_of_taps, FIRFilterMode mode)
+{
+    std::vector<float> taps(number_of_taps);
+    FIRFilter::designBandPass(taps.data(), number_of_taps, SAMPLE_RATE, 100, 4000, 0.97f);
+    std::vector<int16_t> audio = make_audio();
+    std::vector<double> reference = convolve(audio, taps);
+    FIRFilter *filter = new FIRFilter(taps.data(), number_of_taps, mode);
+    CHECK(filter->isUsingFFT() == (mode == FIR_FILTER_FFT));
+    std::vector<int16_t> output = audio;
+    const int block_sizes[] = {1, 7, 160, 333, 2, 1023, 59};
+    int position = 0;
+    for (int b = 0; position < TEST_SAMPLES; b++)
+    {
+        int count = std::min(block_sizes[b % 7], TEST_SAMPLES - position);
+        filter->process(&output[position], count);
+        position += count;
+    }
+    int lag = filter->getDelay() - (number_of_taps - 1) / 2;
+    double max_difference = 0;
+    for (int n = 0; n < TEST_SAMPLES; n++)
+    {
+        double expected = n >= lag ? reference[n - lag] : 0;
+        expected = std::max(-32768.0, std::min(32767.0, expected));
+        max_difference = std::max(max_difference, fabs(output[n] - expected));
+    }
+    printf("%d taps %s: within %.2f of the double precision convolution with a lag of %d\n", number_of_taps,
+           mode == FIR_FILTER_FFT ? "with FFTs" : "direct", max_difference, lag);
+    // the output is rounded to the nearest whole sample so half a sample of that is expected
+    CHECK(max_difference < 1);
+    delete filter;
+}
+
+/**
+ * A symmetric filter's impulse response peaks in the middle of the filter - that's where getDelay says the output is
+ **/
+static void test_delay(int number_of_taps, FIRFilterMode mode)
+{
+    std::vector<float> taps(number_of_taps);
+    FIRFilter::designBandPass(taps.data(), number_of_taps, SAMPLE_RATE, 100, 4000, 0);
+    FIRFilter *filter = new FIRFilter(taps.data(), number_of_taps, mode);
+    std::vector<int16_t> samples(4096, 0);
+    const int impulse = 100;
+    samples[impulse] = 30000;
+    for (size_t position = 0; position < samples.size(); position += 333)
+    {
+        filter->process(&samples[position], std::min<int>(333, samples.size() - position));
+    }
+    int peak = 0;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        if (abs(samples[i]) > abs(samples[peak]))
+        {
+            peak = i;
+        }
+    }
+    CHECK(peak - impulse == filter->getDelay());
+    delete filter;
+}
+
+int main()
+{
+    const int tap_counts[] = {15, 31, 63, 64, 127, 255, 511};
+    for (size_t t = 0; t < sizeof(tap_counts) / sizeof(tap_counts[0]); t++)
+    {
+        test_against_convolution(tap_counts[t], FIR_FILTER_DIRECT);
+        test_against_convolution(tap_counts[t], FIR_FILTER_FFT);
+    }
+    const int odd_tap_counts[] = {15, 63, 255, 511};
+    for (size_t t = 0; t < sizeof(odd_tap_counts) / sizeof(odd_tap_counts[0]); t++)
+    {
+        test_delay(odd_tap_counts[t], FIR_FILTER_DIRECT);
+        test_delay(odd_tap_counts[t], FIR_FILTER_FFT);
+    }
+    return host_test_result("test_fir_filter");
+}
@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "SlidingWindowStats.h"
+
+#define HOP_SIZE 160
+
+// speech like audio - a tone that comes and goes with some noise and a DC offset that drifts so the mean changes
+static int16_t sample_at(uint64_t sequence, uint32_t &state)
+{
+    double envelope = 0.5 + 0.5 * sin(sequence * 0.0007);
+    double tone = 6000 * envelope * sin(sequence * 0.09);
+    int noise = (int)(host_random(state) % 801) - 400;
+    int offset = (int)(300 * sin(sequence * 0.0001));
+    return (int16_t)(tone + noise + offset);
+}
+
+static void write_samples(AudioRingBuffer *ring_buffer, uint64_t &sequence, uint32_t &state, int count)
+{
+    ring_buffer->beginWrite(count);
+    for (int i = 0; i < count; i++)
+    {
+        ring_buffer->writeSample(sample_at(sequence++, state));
+    }
+    ring_buffer->endWrite();
+}
+
+// the two pass version - the mean of the window and then the biggest distance of any sample from it
+static void reference_normalisation(RingBufferAccessor *reader, uint64_t start, int length, float &mean, float &max)
+{
+    RingBufferSpan spans[2];
+    int span_count = reader->getSpans(start, length, spans);
+    double sum = 0;
+    for (int span = 0; span < span_count; span++)
+    {
+        for (int i = 0; i < spans[span].length; i++)
+        {
+            sum += spans[span].samples[i];
+        }
+    }
+    mean = (float)(sum / length);
+    max = 0;
+    for (int span = 0; span < span_count; span++)
+    {
+        for (int i = 0; i < spans[span].length; i++)
+        {
+            max = std::max(max, fabsf(spans[span].samples[i] - mean));
+        }
+    }
+}
+
+static bool check_window(SlidingWindowStats &stats, RingBufferAccessor *reader, uint64_t start_hop, int window_hops)
+{
+    stats.update(reader, start_hop);
+    float mean, max, expected_mean, expected_max;
+    stats.get_normalisation(mean, max);
+    reference_normalisation(reader, start_hop * HOP_SIZE, window_hops * HOP_SIZE, expected_mean, expected_max);
+    bool matches = fabsf(mean - expected_mean) < 1e-3f && fabsf(max - expected_max) < 1e-2f;
+    if (!matches)
+    {
+        printf("Window of %d hops at hop %llu: mean %f max %f, expected mean %f max %f\n", window_hops,
+               (unsigned long long)start_hop, mean, max, expected_mean, expected_max);
+    }
+    return matches;
+}
+
+/**
+ * Slide the window along behind the writer like AudioProcessor does - a hop at a time, sometimes skipping hops when the
+ * detector falls behind, and jumping back to the start of the audio so the stats have to start again
+ **/
+static void test_sliding(int window_hops)
+{
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    RingBufferAccessor reader(ring_buffer);
+    SlidingWindowStats stats(HOP_SIZE, window_hops);
+    uint64_t sequence = 0;
+    uint32_t state = 1234;
+    write_samples(ring_buffer, sequence, state, window_hops * HOP_SIZE);
+    bool matches = true;
+    for (int step = 0; step < 300; step++)
+    {
+        // mostly a hop at a time but now and again several
+        int hops = step % 37 == 0 ? 5 : 1;
+        write_samples(ring_buffer, sequence, state, hops * HOP_SIZE);
+        uint64_t start_hop = sequence / HOP_SIZE - window_hops;
+        matches &= check_window(stats, &reader, start_hop, window_hops);
+        if (step % 100 == 99)
+        {
+            // moving backwards has to read the whole window again
+            matches &= check_window(stats, &reader, start_hop - 3, window_hops);
+        }
+    }
+    CHECK(matches);
+    delete ring_buffer;
+}
+
+/**
+ * When the detector starts the window runs past the samples that have been written - the hops that are still being
+ * written have to be read again each time rather than kept
+ **/
+static void test_shorter_than_window(int window_hops)
+{
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    RingBufferAccessor reader(ring_buffer);
+    SlidingWindowStats stats(HOP_SIZE, window_hops);
+    uint64_t sequence = 0;
+    uint32_t state = 4321;
+    bool matches = true;
+    // writes that don't line up with the hops so the last hop is often only partly written
+    while (sequence < (uint64_t)(window_hops + 20) * HOP_SIZE)
+    {
+        write_samples(ring_buffer, sequence, state, 70);
+        uint64_t written_hops = sequence / HOP_SIZE;
+        uint64_t start_hop = written_hops > (uint64_t)window_hops ? written_hops - window_hops : 0;
+        matches &= check_window(stats, &reader, start_hop, window_hops);
+    }
+    CHECK(matches);
+    delete ring_buffer;
+}
+
+int main()
+{
+    test_sliding(1);
+    test_sliding(100);
+    test_shorter_than_window(1);
+    test_shorter_than_window(100);
+    return host_test_result("test_sliding_window_stats");
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "AudioProcessor.h"
+
+// the wake word detector's settings
+#define AUDIO_LENGTH 16000
+#define WINDOW_SIZE 320
+#define STEP_SIZE 160
+#define POOLING_SIZE 6
+
+// speech like audio over noise with a DC offset that drifts by up to drift per second - a cheap mic's offset moves as it
+// warms up
+static void write_audio(AudioRingBuffer *ring_buffer, uint64_t &sequence, uint32_t &state, int count, float drift)
+{
+    ring_buffer->beginWrite(count);
+    for (int i = 0; i < count; i++, sequence++)
+    {
+        double envelope = 0.5 + 0.5 * sin(sequence * 0.0005);
+        double word = envelope * (3000 * sin(sequence * 0.05) + 1500 * sin(sequence * 0.21 + sin(sequence * 0.002)));
+        double offset = drift * sin(sequence * (2 * M_PI / (4 * AUDIO_LENGTH))) * (4 / (2 * M_PI));
+        ring_buffer->writeSample((int16_t)(word + offset + (int)(host_random(state) % 401) - 200));
+    }
+    ring_buffer->endWrite();
+}
+
+/**
+ * The streaming spectrogram caches each row with the mean of the window it was first computed in taken out and corrects
+ * it for the mean of the current window when it's output, the batch one takes the mean of the whole window out every
+ * time. Without the correction a drifting DC offset moves the lowest bins of the cached rows away from the batch ones
+ * by up to 1.9 (in log10 energy) at 100 per second. This runs both over the same audio a hop at a time and checks how
+ * close they are.
+ **/
+static void compare_streaming_and_batch(float drift, float tolerance, bool fixed_point, int mel_bands)
+{
+    AudioProcessor *streaming = new AudioProcessor(AUDIO_LENGTH, WINDOW_SIZE, STEP_SIZE, POOLING_SIZE, true, fixed_point, mel_bands);
+    AudioProcessor *batch = new AudioProcessor(AUDIO_LENGTH, WINDOW_SIZE, STEP_SIZE, POOLING_SIZE, false, fixed_point, mel_bands);
+    int size = batch->get_spectrogram_size();
+    int row_size = batch->get_row_size();
+    std::vector<float> streaming_output(size);
+    std::vector<float> batch_output(size);
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    RingBufferAccessor reader(ring_buffer);
+    uint64_t sequence = 0;
+    uint32_t state = 11;
+    write_audio(ring_buffer, sequence, state, AUDIO_LENGTH, drift);
+    float max_difference = 0;
+    float max_low_bin_difference = 0;
+    for (int hop = 0; hop < 1000; hop++)
+    {
+        reader.setPosition(sequence - AUDIO_LENGTH);
+        streaming->get_spectrogram(&reader, streaming_output.data());
+        reader.setPosition(sequence - AUDIO_LENGTH);
+        batch->get_spectrogram(&reader, batch_output.data());
+        for (int i = 0; i < size; i++)
+        {
+            float difference = fabsf(streaming_output[i] - batch_output[i]);
+            // the DC offset mostly gets into the lowest pooled bin and a little into the one above it
+            if (i % row_size < 2)
+            {
+                max_low_bin_difference = std::max(max_low_bin_difference, difference);
+            }
+            else
+            {
+                max_difference = std::max(max_difference, difference);
+            }
+        }
+        write_audio(ring_buffer, sequence, state, STEP_SIZE, drift);
+    }
+    printf("%s%s with the DC drifting %.0f per second: the log10 energies differ by at most %.4f (%.4f in the lowest two bins)\n",
+           fixed_point ? "Fixed point" : "Float", mel_bands ? " mel" : "", drift, max_difference, max_low_bin_difference);
+    CHECK(max_difference < tolerance);
+    CHECK(max_low_bin_difference < tolerance);
+    delete ring_buffer;
+    delete streaming;
+    delete batch;
+}
+
+int main()
+{
+    const float drifts[] = {0, 100, 1000};
+    for (size_t i = 0; i < sizeof(drifts) / sizeof(drifts[0]); i++)
+    {
+        compare_streaming_and_batch(drifts[i], 0.002f, false, 0);
+        compare_streaming_and_batch(drifts[i], 0.002f, true, 0);
+        compare_streaming_and_batch(drifts[i], 0.002f, false, 40);
+    }
+    return host_test_result("test_streaming_spectrogram");
+}
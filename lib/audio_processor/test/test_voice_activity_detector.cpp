@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <math.h>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "VoiceActivityDetector.h"
+
+// the wake word detector's settings
+#define STEP_SIZE 160
+#define SPEECH_THRESHOLD 8.0f
+#define RELEASE_THRESHOLD 4.0f
+#define MAX_ZERO_CROSSING_RATE 0.45f
+#define HANGOVER_FRAMES 100
+
+enum Sound
+{
+    // white noise at +-50 - far too many zero crossings to be speech
+    QUIET,
+    // a 500Hz tone
+    TONE,
+    // low pass filtered noise about 30dB louder than the quiet - few enough zero crossings that it could be speech
+    RUMBLE,
+    // the rumble with a loud 500Hz tone over it
+    TONE_OVER_RUMBLE
+};
+
+/**
+ * Writes a hop of audio and runs the detector over it like DetectWakeWordState does each time it's woken up
+ **/
+class Feeder
+{
+private:
+    AudioRingBuffer *m_ring_buffer;
+    RingBufferAccessor *m_reader;
+    uint64_t m_sequence;
+    uint32_t m_state;
+    float m_rumble;
+
+public:
+    VoiceActivityDetector detector;
+
+    Feeder() : detector(STEP_SIZE, SPEECH_THRESHOLD, RELEASE_THRESHOLD, MAX_ZERO_CROSSING_RATE, HANGOVER_FRAMES)
+    {
+        m_ring_buffer = new AudioRingBuffer();
+        m_reader = new RingBufferAccessor(m_ring_buffer);
+        m_sequence = 0;
+        m_state = 7;
+        m_rumble = 0;
+    }
+    ~Feeder()
+    {
+        delete m_reader;
+        delete m_ring_buffer;
+    }
+    bool hop(Sound sound)
+    {
+        m_ring_buffer->beginWrite(STEP_SIZE);
+        for (int i = 0; i < STEP_SIZE; i++, m_sequence++)
+        {
+            int noise = (int)(host_random(m_state) % 101) - 50;
+            float sample = noise;
+            if (sound == TONE)
+            {
+                sample += 3000 * sin(m_sequence * (2 * M_PI * 500 / 16000));
+            }
+            else if (sound == RUMBLE || sound == TONE_OVER_RUMBLE)
+            {
+                m_rumble = 0.9f * m_rumble + 20 * ((int)(host_random(m_state) % 201) - 100);
+                sample = m_rumble + (sound == TONE_OVER_RUMBLE ? 20000 * sin(m_sequence * (2 * M_PI * 500 / 16000)) : 0);
+            }
+            m_ring_buffer->writeSample((int16_t)std::max(-32768.0f, std::min(32767.0f, sample)));
+        }
+        m_ring_buffer->endWrite();
+        return detector.process(m_reader);
+    }
+    // feeds hops of a sound and returns the number of hops it took for the detector to be active (or not) - or -1 if
+    // it didn't get there
+    int until(Sound sound, bool active, int max_hops)
+    {
+        for (int i = 1; i <= max_hops; i++)
+        {
+            if (hop(sound) == active)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+};
+
+// speech switches the detector on straight away and it stays on for the hangover once the speech has stopped
+static void test_onset_and_release()
+{
+    Feeder feeder;
+    // a couple of seconds of quiet to settle
+    CHECK(feeder.until(QUIET, true, 200) == -1);
+    CHECK(!feeder.detector.is_active());
+    // the first frame of the tone is enough
+    CHECK(feeder.hop(TONE));
+    for (int i = 0; i < 49; i++)
+    {
+        CHECK(feeder.hop(TONE));
+    }
+    // back to quiet - on for the hangover and then off
+    int release = feeder.until(QUIET, false, 300);
+    printf("Onset in 1 hop, released %d hops after the speech stopped (hangover %d)\n", release, HANGOVER_FRAMES);
+    CHECK(release == HANGOVER_FRAMES + 1);
+    // and a short blip comes through too
+    CHECK(feeder.until(QUIET, true, 100) == -1);
+    CHECK(feeder.hop(TONE));
+}
+
+// a step up to louder background noise looks like speech at first but the noise floor follows it up so the detector
+// lets go, and speech over the new noise still gets through
+static void test_noise_floor_adaptation()
+{
+    Feeder feeder;
+    CHECK(feeder.until(QUIET, true, 200) == -1);
+    float quiet_floor = feeder.detector.get_noise_floor();
+    CHECK(feeder.hop(RUMBLE));
+    int release = feeder.until(RUMBLE, false, 1000);
+    CHECK(release > HANGOVER_FRAMES);
+    // give it a while longer to settle and see where the noise floor ended up
+    for (int i = 0; i < 1500; i++)
+    {
+        CHECK(!feeder.hop(RUMBLE));
+    }
+    float rumble_floor = feeder.detector.get_noise_floor();
+    printf("Noise floor went from %.0f to %.0f after the noise got louder - let go after %d hops\n", quiet_floor, rumble_floor, release);
+    CHECK(rumble_floor > quiet_floor * 100);
+    // the rumble's energy per sample is 20^2 * var(uniform -100..100) / (1 - 0.9^2)
+    float rumble_energy = 400 * (100 * 102 / 3.0f) / (1 - 0.81f);
+    CHECK(rumble_floor > rumble_energy / 2 && rumble_floor < rumble_energy * 2);
+    // the tone that was speech in the quiet is lost in the rumble now but a louder one still counts
+    CHECK(!feeder.hop(TONE));
+    CHECK(feeder.hop(TONE_OVER_RUMBLE));
+}
+
+int main()
+{
+    test_onset_and_release();
+    test_noise_floor_adaptation();
+    return host_test_result("test_voice_activity_detector");
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <math.h>
+#include <thread>
+#include <vector>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "AudioProcessor.h"
+#include "WorkerPool.h"
+
+// the wake word detector's settings
+#define AUDIO_LENGTH 16000
+#define WINDOW_SIZE 320
+#define STEP_SIZE 160
+#define POOLING_SIZE 6
+
+static void fill_ring_buffer(AudioRingBuffer *ring_buffer)
+{
+    uint32_t state = 99;
+    ring_buffer->beginWrite(AUDIO_LENGTH);
+    for (int i = 0; i < AUDIO_LENGTH; i++)
+    {
+        double tone = 5000 * sin(i * 0.07) + 2000 * sin(i * 0.31);
+        ring_buffer->writeSample((int16_t)(tone + (int)(host_random(state) % 601) - 300));
+    }
+    ring_buffer->endWrite();
+}
+
+// every worker runs the job once and gets its own number
+static void count_job(void *context, int worker)
+{
+    static_cast<int *>(context)[worker]++;
+}
+
+static void test_run()
+{
+    const int counts[] = {1, 2, 4};
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        WorkerPool *pool = get_worker_pool(counts[c]);
+        CHECK(get_worker_pool(counts[c]) == pool);
+        int runs[MAX_WORKERS] = {0};
+        for (int i = 0; i < 100; i++)
+        {
+            pool->run(count_job, runs);
+        }
+        for (int worker = 0; worker < MAX_WORKERS; worker++)
+        {
+            CHECK(runs[worker] == (worker < counts[c] ? 100 : 0));
+        }
+    }
+}
+
+/**
+ * The whole second of audio - what the detector computes after a cold start and the case the workers are there for.
+ * The spectrogram has to be the same however many workers compute it and this prints how much quicker it gets.
+ **/
+static void benchmark_workers()
+{
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    fill_ring_buffer(ring_buffer);
+    RingBufferAccessor reader(ring_buffer);
+    std::vector<float> expected;
+    double one_worker_time = 0;
+    const int counts[] = {1, 2, 4};
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        AudioProcessor *processor = new AudioProcessor(AUDIO_LENGTH, WINDOW_SIZE, STEP_SIZE, POOLING_SIZE, false, false, 0, false, counts[c]);
+        std::vector<float> spectrogram(processor->get_spectrogram_size());
+        int runs = 0;
+        int64_t start = host_time_us();
+        int64_t elapsed = 0;
+        do
+        {
+            reader.setPosition(0);
+            processor->get_spectrogram(&reader, spectrogram.data());
+            runs++;
+            elapsed = host_time_us() - start;
+        } while (elapsed < 300000);
+        if (c == 0)
+        {
+            expected = spectrogram;
+            one_worker_time = (double)elapsed / runs;
+        }
+        CHECK(spectrogram == expected);
+        double time = (double)elapsed / runs;
+        printf("%d worker%s: %.0fus for a whole spectrogram (%.2fx) on %u host cores\n", counts[c], counts[c] == 1 ? "" : "s",
+               time, one_worker_time / time, std::thread::hardware_concurrency());
+        delete processor;
+    }
+    delete ring_buffer;
+}
+
+int main()
+{
+    test_run();
+    benchmark_workers();
+    return host_test_result("test_worker_pool");
+}
@@ -2,34 +2,173 @@
 #include "model.h"
 #include "tensorflow/lite/micro/all_ops_resolver.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/simple_memory_allocator.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
 
-// approximate working size of our model
-const int kArenaSize = 25000;
+// the arena used to size a model that doesn't have an arena size yet - it only needs to be big enough for the largest
+// model we would run
+#ifndef TENSOR_ARENA_SIZING_SIZE
+#define TENSOR_ARENA_SIZING_SIZE (48 * 1024)
+#endif
+// tflite lines up the start of the arena and the allocations from the end of it to 16 bytes
+#define TENSOR_ARENA_ALIGNMENT 16
 
-NeuralNetwork::NeuralNetwork()
+// the tail allocations line up with the end of the arena so it has to be aligned at both ends for the sizes to be exact
+static int aligned_arena_size(int arena_size)
 {
-    m_error_reporter = new tflite::MicroErrorReporter();
+    return (arena_size + TENSOR_ARENA_ALIGNMENT - 1) & ~(TENSOR_ARENA_ALIGNMENT - 1);
+}
+
+// where the arena starts in a block from malloc that's TENSOR_ARENA_ALIGNMENT - 1 bytes bigger than it
+static uint8_t *align_arena(uint8_t *block)
+{
+    return (uint8_t *)(((uintptr_t)block + TENSOR_ARENA_ALIGNMENT - 1) & ~(uintptr_t)(TENSOR_ARENA_ALIGNMENT - 1));
+}
+
+/**
+ * Builds the model in the arena and keeps track of how much of the tail of the arena goes to the tensors and how much
+ * to the ops, the same way tflite's RecordingMicroAllocator does. That one keeps itself and its records in the arena
+ * so a model needs more arena with it than without - this one lives on the heap and takes up the space in the arena
+ * that a plain interpreter's allocator would, so the arena is used exactly the same way and the sizes stay exact.
+ **/
+class ArenaUsageAllocator : public tflite::MicroAllocator
+{
+private:
+    tflite::SimpleMemoryAllocator *m_memory_allocator;
+    size_t m_tensor_bytes;
+    size_t m_op_bytes;
 
-    m_tensor_arena = (uint8_t *)malloc(kArenaSize);
-    if (!m_tensor_arena)
+    ArenaUsageAllocator(tflite::SimpleMemoryAllocator *memory_allocator, tflite::ErrorReporter *error_reporter)
+        : tflite::MicroAllocator(memory_allocator, error_reporter)
     {
-        TF_LITE_REPORT_ERROR(m_error_reporter, "Could not allocate arena");
-        return;
+        m_memory_allocator = memory_allocator;
+        m_tensor_bytes = 0;
+        m_op_bytes = 0;
+    }
+
+protected:
+    TfLiteStatus AllocateNodeAndRegistrations(const tflite::Model *model, tflite::NodeAndRegistration **node_and_registrations) override
+    {
+        size_t start = getTailUsedBytes();
+        TfLiteStatus status = tflite::MicroAllocator::AllocateNodeAndRegistrations(model, node_and_registrations);
+        m_op_bytes += getTailUsedBytes() - start;
+        return status;
+    }
+    TfLiteStatus PrepareNodeAndRegistrationDataFromFlatbuffer(const tflite::Model *model, const tflite::MicroOpResolver &op_resolver,
+                                                              tflite::NodeAndRegistration *node_and_registrations) override
+    {
+        size_t start = getTailUsedBytes();
+        TfLiteStatus status = tflite::MicroAllocator::PrepareNodeAndRegistrationDataFromFlatbuffer(model, op_resolver, node_and_registrations);
+        m_op_bytes += getTailUsedBytes() - start;
+        return status;
+    }
+    TfLiteStatus AllocateTfLiteEvalTensors(const tflite::Model *model, TfLiteEvalTensor **eval_tensors) override
+    {
+        size_t start = getTailUsedBytes();
+        TfLiteStatus status = tflite::MicroAllocator::AllocateTfLiteEvalTensors(model, eval_tensors);
+        m_tensor_bytes += getTailUsedBytes() - start;
+        return status;
+    }
+    TfLiteStatus AllocateVariables(const tflite::SubGraph *subgraph, TfLiteEvalTensor *eval_tensors) override
+    {
+        size_t start = getTailUsedBytes();
+        TfLiteStatus status = tflite::MicroAllocator::AllocateVariables(subgraph, eval_tensors);
+        m_tensor_bytes += getTailUsedBytes() - start;
+        return status;
+    }
+    TfLiteTensor *AllocatePersistentTfLiteTensorInternal(const tflite::Model *model, TfLiteEvalTensor *eval_tensors, int tensor_index) override
+    {
+        size_t start = getTailUsedBytes();
+        TfLiteTensor *tensor = tflite::MicroAllocator::AllocatePersistentTfLiteTensorInternal(model, eval_tensors, tensor_index);
+        m_tensor_bytes += getTailUsedBytes() - start;
+        return tensor;
+    }
+    // the quantization parameters of the persistent tensors go in the tail as well
+    TfLiteStatus PopulateTfLiteTensorFromFlatbuffer(const tflite::Model *model, const tflite::SubGraph *subgraph, TfLiteTensor *tensor,
+                                                    int tensor_index, bool allocate_temp) override
+    {
+        size_t start = getTailUsedBytes();
+        TfLiteStatus status = tflite::MicroAllocator::PopulateTfLiteTensorFromFlatbuffer(model, subgraph, tensor, tensor_index, allocate_temp);
+        m_tensor_bytes += getTailUsedBytes() - start;
+        return status;
+    }
+
+public:
+    static ArenaUsageAllocator *create(uint8_t *arena, size_t arena_size, tflite::ErrorReporter *error_reporter)
+    {
+        tflite::SimpleMemoryAllocator *memory_allocator = tflite::SimpleMemoryAllocator::Create(error_reporter, arena, arena_size);
+        // this is where a plain interpreter's allocator would go
+        memory_allocator->AllocateFromTail(sizeof(tflite::MicroAllocator), alignof(tflite::MicroAllocator));
+        return new ArenaUsageAllocator(memory_allocator, error_reporter);
+    }
+    ~ArenaUsageAllocator() override
+    {
+    }
+    // the tensors and scratch buffers that are only needed while the model runs
+    size_t getHeadUsedBytes()
+    {
+        return m_memory_allocator->GetHeadUsedBytes();
+    }
+    // everything that has to persist between runs
+    size_t getTailUsedBytes()
+    {
+        return m_memory_allocator->GetTailUsedBytes();
     }
+    // how much of the tail the tensors (and their quantization parameters and variable buffers) take up
+    size_t getTensorBytes()
+    {
+        return m_tensor_bytes;
+    }
+    // how much of the tail the ops' nodes, registrations and parameters take up
+    size_t getOpBytes()
+    {
+        return m_op_bytes;
+    }
+};
+
+// getting the input and output tensors allocates them from the arena as well so they count towards the size
+static bool allocate_tensors(tflite::MicroInterpreter *interpreter)
+{
+    return interpreter->AllocateTensors() == kTfLiteOk && interpreter->input(0) && interpreter->output(0);
+}
+
+NeuralNetwork::NeuralNetwork(const unsigned char *model_data, int arena_size, uint8_t *arena)
+{
+    if (!model_data)
+    {
+        model_data = converted_model_tflite;
+        arena_size = converted_model_tflite_arena_size;
+    }
+    m_error_reporter = new tflite::MicroErrorReporter();
+    m_tensor_arena = NULL;
+    m_interpreter = NULL;
+    m_allocator = NULL;
+    m_resolver = NULL;
+    input = NULL;
+    output = NULL;
+    m_arena_size = 0;
+    m_streaming = false;
+
     TF_LITE_REPORT_ERROR(m_error_reporter, "Loading model");
 
-    m_model = tflite::GetModel(converted_model_tflite);
+    m_model = tflite::GetModel(model_data);
     if (m_model->version() != TFLITE_SCHEMA_VERSION)
     {
         TF_LITE_REPORT_ERROR(m_error_reporter, "Model provided is schema version %d not equal to supported version %d.",
                              m_model->version(), TFLITE_SCHEMA_VERSION);
         return;
     }
+    // a model with variable tensors keeps state between runs so it takes the spectrogram a row at a time
+    const flatbuffers::Vector<flatbuffers::Offset<tflite::Tensor>> *tensors = m_model->subgraphs()->Get(0)->tensors();
+    for (unsigned int i = 0; i < tensors->size(); i++)
+    {
+        m_streaming |= tensors->Get(i)->is_variable();
+    }
     // This pulls in the operators implementations we need
-    m_resolver = new tflite::MicroMutableOpResolver<10>();
+    m_resolver = new tflite::MicroMutableOpResolver<11>();
     m_resolver->AddConv2D();
     m_resolver->AddMaxPool2D();
     m_resolver->AddFullyConnected();
@@ -37,44 +176,209 @@ NeuralNetwork::NeuralNetwork()
     m_resolver->AddAdd();
     m_resolver->AddLogistic();
     m_resolver->AddReshape();
+    // only float models need these - an int8 model takes and gives quantized values directly
     m_resolver->AddQuantize();
     m_resolver->AddDequantize();
+    // streaming models keep their memory of earlier rows in SVDF layers - the CIRCULAR_BUFFER custom op isn't added as it's
+    // hard wired to the music detection model it was written for
+    m_resolver->AddSvdf();
 
-    // Build an interpreter to run the model with.
-    m_interpreter = new tflite::MicroInterpreter(
-        m_model, *m_resolver, m_tensor_arena, kArenaSize, m_error_reporter);
-
-    // Allocate memory from the tensor_arena for the model's tensors.
-    TfLiteStatus allocate_status = m_interpreter->AllocateTensors();
-    if (allocate_status != kTfLiteOk)
+    // Build an interpreter to run the model with in an arena that's exactly the size the model needs. If we don't know
+    // what that is yet (or the model has changed and it's too small) then size it in a big arena first.
+    int used_bytes = arena_size;
+    if (arena_size <= 0 || !createInterpreter(arena_size, arena))
     {
-        TF_LITE_REPORT_ERROR(m_error_reporter, "AllocateTensors() failed");
-        return;
+        if (arena_size > 0)
+        {
+            TF_LITE_REPORT_ERROR(m_error_reporter, "An arena of %d bytes is too small for this model - sizing it", arena_size);
+        }
+        // the arena we were given is only arena_size bytes so the model gets one of its own
+        used_bytes = sizeArena();
+        if (used_bytes <= 0 || !createInterpreter(used_bytes, NULL))
+        {
+            TF_LITE_REPORT_ERROR(m_error_reporter, "AllocateTensors() failed");
+            return;
+        }
+    }
+    used_bytes = m_interpreter->arena_used_bytes();
+    if (used_bytes != arena_size)
+    {
+        TF_LITE_REPORT_ERROR(m_error_reporter, "Set the arena size for this model to %d to use exactly what it needs", used_bytes);
     }
+    m_arena_size = used_bytes;
+    // the tail holds the allocators themselves and the kernels' own persistent data as well as the tensors and ops
+    TF_LITE_REPORT_ERROR(m_error_reporter, "Using %d bytes of arena - %d for tensors and scratch buffers, %d persistent (%d for tensors, %d for ops)",
+                         used_bytes, m_allocator->getHeadUsedBytes(), m_allocator->getTailUsedBytes(), m_allocator->getTensorBytes(),
+                         m_allocator->getOpBytes());
+}
 
-    size_t used_bytes = m_interpreter->arena_used_bytes();
-    TF_LITE_REPORT_ERROR(m_error_reporter, "Used bytes %d\n", used_bytes);
+// Works out how many bytes of arena the model needs by building it in a big arena - returns 0 if it doesn't fit. This is
+// only done when the model's arena size is missing or wrong.
+int NeuralNetwork::sizeArena()
+{
+    uint8_t *block = (uint8_t *)malloc(TENSOR_ARENA_SIZING_SIZE + TENSOR_ARENA_ALIGNMENT - 1);
+    if (!block)
+    {
+        TF_LITE_REPORT_ERROR(m_error_reporter, "Could not allocate arena");
+        return 0;
+    }
+    tflite::MicroInterpreter *interpreter = new tflite::MicroInterpreter(m_model, *m_resolver, align_arena(block), TENSOR_ARENA_SIZING_SIZE,
+                                                                         m_error_reporter);
+    int used_bytes = allocate_tensors(interpreter) ? interpreter->arena_used_bytes() : 0;
+    delete interpreter;
+    free(block);
+    return used_bytes;
+}
 
-    // Obtain pointers to the model's input and output tensors.
+// allocates the arena if we weren't given one and builds the interpreter in it - returns false and cleans up if the arena is too small
+bool NeuralNetwork::createInterpreter(int arena_size, uint8_t *arena)
+{
+    arena_size = aligned_arena_size(arena_size);
+    uint8_t *aligned_arena = arena;
+    if (!aligned_arena)
+    {
+        m_tensor_arena = (uint8_t *)malloc(arena_size + TENSOR_ARENA_ALIGNMENT - 1);
+        if (!m_tensor_arena)
+        {
+            TF_LITE_REPORT_ERROR(m_error_reporter, "Could not allocate arena");
+            return false;
+        }
+        aligned_arena = align_arena(m_tensor_arena);
+    }
+    m_allocator = ArenaUsageAllocator::create(aligned_arena, arena_size, m_error_reporter);
+    m_interpreter = new tflite::MicroInterpreter(m_model, *m_resolver, m_allocator, m_error_reporter);
+    input = NULL;
+    output = NULL;
+    if (!allocate_tensors(m_interpreter))
+    {
+        destroyInterpreter();
+        return false;
+    }
     input = m_interpreter->input(0);
     output = m_interpreter->output(0);
+    return true;
 }
 
-NeuralNetwork::~NeuralNetwork()
+// the interpreter has to go before the allocator it was built with
+void NeuralNetwork::destroyInterpreter()
 {
     delete m_interpreter;
-    delete m_resolver;
+    m_interpreter = NULL;
+    delete m_allocator;
+    m_allocator = NULL;
     free(m_tensor_arena);
+    m_tensor_arena = NULL;
+    input = NULL;
+    output = NULL;
+}
+
+NeuralNetwork::~NeuralNetwork()
+{
+    destroyInterpreter();
+    delete m_resolver;
     delete m_error_reporter;
 }
 
+void NeuralNetwork::suspend()
+{
+    destroyInterpreter();
+}
+
+bool NeuralNetwork::resume(uint8_t *arena)
+{
+    if (m_interpreter)
+    {
+        return true;
+    }
+    // we already know exactly how big the arena needs to be so this is just the allocation and the kernel setup
+    return m_arena_size > 0 && createInterpreter(m_arena_size, arena);
+}
+
+int NeuralNetwork::getArenaSize()
+{
+    return aligned_arena_size(m_arena_size);
+}
+
+bool NeuralNetwork::isLoaded()
+{
+    return m_interpreter != NULL;
+}
+
+bool NeuralNetwork::isQuantized()
+{
+    return input && input->type == kTfLiteInt8;
+}
+
 float *NeuralNetwork::getInputBuffer()
 {
-    return input->data.f;
+    return input && input->type == kTfLiteFloat32 ? input->data.f : NULL;
+}
+
+int8_t *NeuralNetwork::getInputBufferInt8()
+{
+    return input && input->type == kTfLiteInt8 ? input->data.int8 : NULL;
+}
+
+float NeuralNetwork::getInputScale()
+{
+    return input ? input->params.scale : 0;
+}
+
+int NeuralNetwork::getInputZeroPoint()
+{
+    return input ? input->params.zero_point : 0;
+}
+
+int NeuralNetwork::getInputSize()
+{
+    if (!input)
+    {
+        return 0;
+    }
+    return input->type == kTfLiteInt8 ? input->bytes : input->bytes / sizeof(float);
+}
+
+bool NeuralNetwork::isStreaming()
+{
+    return m_streaming;
+}
+
+void NeuralNetwork::resetState()
+{
+    if (m_interpreter)
+    {
+        m_interpreter->ResetVariableTensors();
+    }
 }
 
 float NeuralNetwork::predict()
 {
-    m_interpreter->Invoke();
-    return output->data.f[0];
+    if (!m_interpreter || m_interpreter->Invoke() != kTfLiteOk)
+    {
+        return 0;
+    }
+    return getOutput(0);
+}
+
+int NeuralNetwork::getOutputSize()
+{
+    if (!output)
+    {
+        return 0;
+    }
+    return output->type == kTfLiteInt8 ? output->bytes : output->bytes / sizeof(float);
+}
+
+float NeuralNetwork::getOutput(int index)
+{
+    if (!output)
+    {
+        return 0;
+    }
+    // only the decision needs a real number - dequantize just the output values we're asked for
+    if (output->type == kTfLiteInt8)
+    {
+        return (output->data.int8[index] - output->params.zero_point) * output->params.scale;
+    }
+    return output->data.f[index];
 }
@@ -2,6 +2,7 @@
 #define __NeuralNetwork__
 
 #include <stdint.h>
+#include <stddef.h>
 
 namespace tflite
 {
@@ -13,23 +14,76 @@ namespace tflite
 } // namespace tflite
 
 struct TfLiteTensor;
+class ArenaUsageAllocator;
 
 class NeuralNetwork
 {
 private:
-    tflite::MicroMutableOpResolver<10> *m_resolver;
+    tflite::MicroMutableOpResolver<11> *m_resolver;
     tflite::ErrorReporter *m_error_reporter;
     const tflite::Model *m_model;
     tflite::MicroInterpreter *m_interpreter;
+    // builds the model in the arena and keeps track of what the arena is used for
+    ArenaUsageAllocator *m_allocator;
     TfLiteTensor *input;
     TfLiteTensor *output;
+    // only set if we allocated the arena ourselves rather than being given one
     uint8_t *m_tensor_arena;
+    // the exact arena size the model needs - worked out when it was loaded
+    int m_arena_size;
+    // the model keeps state in variable tensors from one run to the next
+    bool m_streaming;
+
+    bool createInterpreter(int arena_size, uint8_t *arena);
+    void destroyInterpreter();
+    int sizeArena();
 
 public:
-    NeuralNetwork();
+    /**
+     * model_data is a tflite flatbuffer - either a float model or a fully int8 quantized one (int8 input and output).
+     * arena_size is the exact number of bytes of tensor arena the model needs (the _arena_size next to the model) - if it's 0
+     * or too small the model is sized in a big arena instead and the size to use is printed out.
+     * arena is somewhere to build the model instead of allocating an arena for it - it must be lined up to 16 bytes and hold
+     * arena_size bytes rounded up to 16. It's only used if it's big enough.
+     * Check isLoaded afterwards - if the model couldn't be loaded there's nothing to run and the accessors below return NULL or 0.
+     **/
+    NeuralNetwork(const unsigned char *model_data = NULL, int arena_size = 0, uint8_t *arena = NULL);
     ~NeuralNetwork();
+    /**
+     * Free the tensor arena (if it was ours) and the interpreter but keep the model, op resolver and arena size so that resume can get
+     * going again quickly. Nothing else can be called until resume has been.
+     **/
+    void suspend();
+    // re-allocate the arena (or use the one given) and the interpreter - returns false if there isn't enough memory for the arena
+    bool resume(uint8_t *arena = NULL);
+    // the number of bytes of arena the model takes - an arena given to resume must be this big
+    int getArenaSize();
+    // false if the model couldn't be loaded or it is suspended (or couldn't be resumed) - there's no input or output until it is
+    bool isLoaded();
+    // true if the model takes int8 features - use getInputBufferInt8 and the input quantization instead of getInputBuffer
+    bool isQuantized();
+    // NULL if the model isn't a float model
     float *getInputBuffer();
+    // NULL if the model isn't an int8 model
+    int8_t *getInputBufferInt8();
+    // the features are quantized as round(value / scale) + zero point
+    float getInputScale();
+    int getInputZeroPoint();
+    // the number of values in the input buffer - this is a single row of the spectrogram for a streaming model
+    int getInputSize();
+    /**
+     * A streaming model takes one new row of the spectrogram each time it runs and remembers what it needs of the earlier
+     * rows in its state (its variable tensors, e.g. the memory of an SVDF layer) instead of seeing the whole window every time
+     **/
+    bool isStreaming();
+    // forget the rows a streaming model has seen - the state is also reset when the model is loaded or resumed
+    void resetState();
+    // the score as a float - int8 outputs are dequantized here
     float predict();
+    // the number of scores the model gives - a multi-class model gives one for each class
+    int getOutputSize();
+    // one of the scores from the last predict
+    float getOutput(int index);
 };
 
 #endif
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <stdint.h>
+
 unsigned char converted_model_tflite[] = {
   0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
   0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
@@ -3618,3 +3620,9 @@ unsigned char converted_model_tflite[] = {
   0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72
 };
 unsigned int converted_model_tflite_len = 43400;
+// the tensor arena structures hold pointers so the size depends on the pointer size - the 32 bit figure is the ESP32's
+#if UINTPTR_MAX == 0xFFFFFFFF
+unsigned int converted_model_tflite_arena_size = 22720;
+#else
+unsigned int converted_model_tflite_arena_size = 23520;
+#endif
@@ -3,5 +3,11 @@
 
 extern unsigned char converted_model_tflite[];
 extern unsigned int converted_model_tflite_len;
+// the exact number of bytes of tensor arena each model needs - NeuralNetwork prints these out if they are wrong
+extern unsigned int converted_model_tflite_arena_size;
+// the same model with float input quantize and output dequantize taken out - it takes int8 features and gives an int8 score
+extern unsigned char converted_model_int8_tflite[];
+extern unsigned int converted_model_int8_tflite_len;
+extern unsigned int converted_model_int8_tflite_arena_size;
 
 #endif
\ No newline at end of file
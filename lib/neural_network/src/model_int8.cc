@@ -0,0 +1,3599 @@
+#include <stdint.h>
+
+unsigned char converted_model_int8_tflite[] = {
+  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x12, 0x00,
+  0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x80, 0xa7, 0x00, 0x00, 0x74, 0x9a, 0x00, 0x00, 0x5c, 0x9a, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d,
+  0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
+  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x00, 0x17, 0x00, 0x00, 0x00, 0xe4, 0x99, 0x00, 0x00,
+  0xd0, 0x99, 0x00, 0x00, 0xb4, 0x99, 0x00, 0x00, 0x90, 0x99, 0x00, 0x00,
+  0x4c, 0x99, 0x00, 0x00, 0x98, 0x98, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00,
+  0x60, 0x02, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00,
+  0x64, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xa6, 0x66, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x32, 0x2e, 0x31, 0x33, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x67, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
+  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x5a, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x58, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x5a, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x5a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x67, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x3a, 0x58, 0x91, 0x5f,
+  0x67, 0x81, 0x47, 0x59, 0x8c, 0x0f, 0xac, 0xe7, 0x4e, 0x0c, 0x38, 0x7f,
+  0x73, 0x72, 0xe5, 0xd4, 0xbb, 0xd0, 0xa4, 0xb2, 0xb3, 0x81, 0xc0, 0x22,
+  0x22, 0x72, 0x0d, 0x10, 0x7f, 0xf6, 0x03, 0x7c, 0x06, 0x68, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x37, 0x0f, 0x00, 0x00,
+  0xea, 0x24, 0x00, 0x00, 0x5c, 0x11, 0x00, 0x00, 0xd6, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x68, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x66, 0xfb, 0x94, 0x51, 0xe1, 0xc6, 0x05, 0x1a,
+  0xf8, 0xe9, 0xca, 0x00, 0x2e, 0xcf, 0xb6, 0x1b, 0xf6, 0xe5, 0xaf, 0x4f,
+  0x5c, 0x00, 0x4e, 0xde, 0x2c, 0xe4, 0xa2, 0x14, 0x28, 0x04, 0x81, 0x43,
+  0x50, 0x31, 0x6d, 0x06, 0x9c, 0xce, 0x35, 0x83, 0xbf, 0x17, 0x01, 0xb9,
+  0xce, 0xff, 0x4f, 0xd4, 0x34, 0x3d, 0xff, 0xa8, 0x8c, 0x19, 0xf3, 0x11,
+  0x31, 0x01, 0xad, 0x2a, 0x6a, 0x7f, 0xf2, 0xa7, 0x95, 0x10, 0xf9, 0x22,
+  0x55, 0x0d, 0x97, 0x0f, 0x64, 0x25, 0xf9, 0xc5, 0xdd, 0xd7, 0xf3, 0xca,
+  0xc1, 0xef, 0x0e, 0xff, 0xea, 0x32, 0xfe, 0xe8, 0xf1, 0xf1, 0xde, 0x17,
+  0xe2, 0xf8, 0x09, 0xfd, 0x81, 0x3d, 0x01, 0x2e, 0x22, 0x1f, 0xdf, 0x3b,
+  0x10, 0xf2, 0x32, 0xc7, 0xca, 0xbf, 0x1d, 0xce, 0xd2, 0x3d, 0x04, 0xc2,
+  0xd2, 0x08, 0xe5, 0x81, 0xb9, 0xd3, 0x40, 0xc3, 0x92, 0x60, 0x3b, 0xfa,
+  0xe4, 0x02, 0xb5, 0xe5, 0xe5, 0x41, 0xf7, 0xf3, 0xcf, 0x7c, 0x02, 0x0f,
+  0x44, 0xf3, 0x9a, 0x11, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x68, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0xdc, 0xff, 0xff,
+  0x2e, 0x0c, 0x00, 0x00, 0x3d, 0xff, 0xff, 0xff, 0x6b, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe6, 0x68, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf6, 0xe2, 0xe4, 0xf6, 0x0b, 0xf6, 0xf2, 0xfb,
+  0xfd, 0xe1, 0x05, 0xe2, 0x00, 0xf3, 0xee, 0xec, 0xff, 0xe9, 0x01, 0xed,
+  0xfe, 0xe9, 0xf1, 0xe5, 0x01, 0x02, 0xfe, 0x0e, 0x00, 0x04, 0x0a, 0xfd,
+  0x00, 0xfc, 0x02, 0xff, 0x00, 0x09, 0x08, 0x00, 0xf4, 0xf7, 0x03, 0x23,
+  0xfc, 0x09, 0x02, 0xff, 0x00, 0xde, 0x28, 0xe7, 0x00, 0xfb, 0x03, 0xef,
+  0x00, 0xee, 0x07, 0xff, 0xfd, 0xfd, 0xff, 0xf0, 0x00, 0x09, 0x06, 0x0f,
+  0x00, 0x1f, 0x06, 0x07, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x08, 0xfe, 0xf9,
+  0xf7, 0xe0, 0xe1, 0xf6, 0xfc, 0x08, 0x09, 0xfc, 0x08, 0xd5, 0x45, 0xea,
+  0x04, 0xe7, 0x0d, 0xe1, 0xf5, 0xe6, 0xf7, 0xf7, 0xfc, 0x00, 0x03, 0xf4,
+  0xfc, 0xfc, 0xf9, 0xfb, 0x00, 0xf1, 0x04, 0x04, 0x00, 0xf1, 0x03, 0xf7,
+  0x00, 0xf3, 0x03, 0xf8, 0x03, 0x10, 0x18, 0x29, 0x08, 0x0a, 0xfc, 0xf4,
+  0x0f, 0xf5, 0x33, 0xc9, 0x04, 0xf3, 0x20, 0xfd, 0xf3, 0xf0, 0x0d, 0x0c,
+  0xfc, 0x05, 0xff, 0xff, 0x00, 0xe3, 0xf7, 0xfb, 0x00, 0xf8, 0xfe, 0x01,
+  0x00, 0xf3, 0x11, 0x01, 0x00, 0xff, 0xf3, 0x0a, 0x30, 0x21, 0x10, 0x32,
+  0x13, 0x15, 0x10, 0x07, 0x1f, 0x20, 0x1d, 0xf3, 0x10, 0x1c, 0x3a, 0xf4,
+  0xf3, 0xe9, 0x02, 0xfa, 0xfd, 0xf0, 0x05, 0xee, 0x00, 0xf1, 0xe6, 0xf5,
+  0x00, 0xee, 0xfa, 0xf8, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x06, 0xf6, 0xfe,
+  0x34, 0x00, 0x06, 0xfa, 0x01, 0x19, 0x09, 0x01, 0x01, 0xfa, 0x00, 0xff,
+  0x12, 0xfc, 0x21, 0xfc, 0xf4, 0x04, 0x0d, 0x06, 0xf9, 0xf9, 0xfd, 0xe4,
+  0xfb, 0xe3, 0xf2, 0xe4, 0x00, 0x04, 0xf9, 0x05, 0x00, 0x0a, 0x15, 0x09,
+  0x00, 0x08, 0x00, 0x0b, 0x2d, 0xed, 0x05, 0xf7, 0xfa, 0xfd, 0xf5, 0xfe,
+  0xea, 0xf3, 0xe9, 0xf4, 0x02, 0xe5, 0x1d, 0xeb, 0xff, 0x09, 0xfb, 0xf2,
+  0x06, 0xd8, 0xfe, 0xe9, 0xf6, 0xee, 0xea, 0x03, 0x01, 0x0e, 0xfe, 0x0e,
+  0x00, 0x0b, 0x03, 0x07, 0x02, 0x01, 0x09, 0x02, 0x06, 0xca, 0xfc, 0xeb,
+  0xd1, 0xf4, 0x11, 0x07, 0xc2, 0xe6, 0xd7, 0xfb, 0xf9, 0xcf, 0x11, 0xeb,
+  0xeb, 0x15, 0xff, 0xf2, 0x00, 0xef, 0x03, 0xf0, 0xee, 0xfc, 0xf3, 0xf4,
+  0xf9, 0x1f, 0xf5, 0x11, 0x01, 0x14, 0x10, 0x05, 0x00, 0x15, 0x0d, 0x0a,
+  0xc1, 0xb0, 0xf0, 0xdf, 0xa9, 0x0c, 0xfb, 0x1f, 0xbf, 0x06, 0xde, 0x1d,
+  0xe3, 0xf4, 0xfd, 0xfb, 0xe2, 0x2b, 0x11, 0xfb, 0x05, 0x04, 0xfe, 0x08,
+  0xf0, 0x11, 0x00, 0x0d, 0xf3, 0x1b, 0xf6, 0x10, 0x00, 0x10, 0x06, 0x05,
+  0x00, 0xfa, 0x05, 0x00, 0xa6, 0xc1, 0x05, 0xe1, 0x91, 0xd4, 0xea, 0xf3,
+  0xe8, 0xdf, 0xe1, 0x11, 0xe6, 0x04, 0x12, 0xf9, 0xeb, 0x26, 0xfc, 0xfa,
+  0xfc, 0x1a, 0x18, 0x1b, 0xf9, 0x17, 0xf5, 0x14, 0xff, 0x18, 0x03, 0x19,
+  0x08, 0x15, 0x06, 0x04, 0x03, 0x07, 0x01, 0x02, 0xb1, 0xd3, 0xfd, 0xf9,
+  0xb4, 0xe8, 0x09, 0x20, 0xf5, 0xe0, 0xe9, 0x19, 0xf5, 0xf3, 0xf0, 0x02,
+  0xf3, 0xf9, 0xfb, 0x14, 0x00, 0x19, 0x1b, 0x18, 0xf3, 0x1f, 0xfa, 0x1b,
+  0xfe, 0x18, 0xfb, 0x22, 0x01, 0x20, 0x0d, 0x03, 0x01, 0xfe, 0x02, 0x04,
+  0xb8, 0x20, 0x2b, 0x44, 0xde, 0xe9, 0x09, 0x4c, 0xeb, 0xfb, 0x14, 0x2b,
+  0xf1, 0x0d, 0xe2, 0x11, 0x01, 0x1a, 0x03, 0x18, 0xff, 0x17, 0x06, 0x10,
+  0xf2, 0x29, 0xf9, 0x15, 0x03, 0x24, 0x12, 0x2b, 0x03, 0x1d, 0x0e, 0x04,
+  0x02, 0x09, 0x0b, 0x04, 0xd9, 0x35, 0x38, 0x65, 0xf8, 0x28, 0x13, 0x4c,
+  0x12, 0xfe, 0x1f, 0x18, 0xf6, 0x1c, 0x02, 0x23, 0xfe, 0x06, 0xf6, 0x04,
+  0x06, 0x0a, 0xfe, 0xff, 0xf4, 0x10, 0xf9, 0x00, 0x03, 0x25, 0x07, 0x27,
+  0x01, 0x18, 0x03, 0x02, 0x03, 0x01, 0x13, 0x03, 0xff, 0x47, 0x30, 0x5a,
+  0x0d, 0x26, 0xfd, 0x35, 0xfb, 0x09, 0x1b, 0x23, 0x0f, 0x34, 0x1f, 0x00,
+  0x04, 0xfe, 0xff, 0xf3, 0xfc, 0x07, 0xfb, 0xfb, 0xed, 0xff, 0xf1, 0xf7,
+  0x01, 0x14, 0x07, 0x08, 0x00, 0x14, 0x0a, 0x07, 0x00, 0x08, 0x00, 0x05,
+  0x18, 0x14, 0x3d, 0x4c, 0x0b, 0x39, 0xe8, 0x3b, 0xe5, 0x0f, 0x10, 0x0f,
+  0x05, 0x2a, 0x27, 0xf6, 0x06, 0x16, 0xfb, 0xde, 0xf6, 0x10, 0x03, 0x15,
+  0xf0, 0xe4, 0xf5, 0xfc, 0x05, 0xfc, 0xf6, 0xfe, 0x00, 0x01, 0x09, 0x05,
+  0x07, 0x07, 0x12, 0x08, 0x04, 0x0f, 0x23, 0x31, 0xf9, 0x1f, 0xf3, 0x31,
+  0xf1, 0xef, 0xe5, 0x07, 0x15, 0x2f, 0x2e, 0x04, 0x01, 0xff, 0x1d, 0xf8,
+  0xf7, 0x1b, 0x08, 0x09, 0xec, 0xfc, 0xf2, 0x02, 0x01, 0x00, 0xff, 0xf4,
+  0x01, 0xf0, 0x05, 0xf9, 0x05, 0xed, 0xfe, 0xfe, 0x0e, 0x00, 0x16, 0x13,
+  0x00, 0xf9, 0xfa, 0x1b, 0xed, 0xf3, 0xcc, 0xed, 0x07, 0x02, 0x10, 0xf8,
+  0x01, 0xea, 0x0c, 0xff, 0xed, 0x08, 0x0a, 0x0a, 0xeb, 0xfa, 0x09, 0xfe,
+  0xff, 0xef, 0xf0, 0xfb, 0x00, 0xf3, 0x00, 0xf5, 0x03, 0xf3, 0x0b, 0xf9,
+  0x05, 0xeb, 0xed, 0xed, 0x0b, 0xcf, 0x0f, 0xfa, 0xf1, 0x06, 0xc5, 0xe7,
+  0x0f, 0xf1, 0x0d, 0x0a, 0x12, 0xf9, 0x06, 0x03, 0xfe, 0x0a, 0x1d, 0x0b,
+  0x04, 0x04, 0xf9, 0x07, 0x00, 0xee, 0xff, 0x0c, 0x01, 0xf9, 0xf4, 0xf4,
+  0x00, 0xfa, 0x05, 0xfb, 0xf2, 0xf3, 0xe2, 0xf2, 0x12, 0xe6, 0x13, 0xfc,
+  0xd9, 0xd7, 0xe1, 0xfd, 0x0d, 0xea, 0xed, 0x11, 0x07, 0xf0, 0xf2, 0x03,
+  0x04, 0x0b, 0x08, 0x14, 0x02, 0xfd, 0x14, 0xfd, 0x04, 0xef, 0xfa, 0x0f,
+  0x01, 0xf8, 0xfa, 0xf9, 0x00, 0x06, 0xf8, 0x13, 0x13, 0x04, 0xe9, 0xf4,
+  0x20, 0xc4, 0x0c, 0xf6, 0xfb, 0xbf, 0xde, 0x01, 0xfd, 0xf0, 0xdd, 0x22,
+  0xf4, 0xea, 0xe2, 0xf2, 0x02, 0xf9, 0xf2, 0x1c, 0xfd, 0x07, 0x18, 0x02,
+  0x02, 0xf8, 0x04, 0x0f, 0x00, 0xfd, 0x01, 0xf4, 0x01, 0xfc, 0xfc, 0x00,
+  0x12, 0x01, 0xdc, 0xea, 0x23, 0xe7, 0xf7, 0xf2, 0xfe, 0xc4, 0xe5, 0xfb,
+  0xd6, 0xe0, 0xcb, 0x0f, 0xec, 0xea, 0xf6, 0xf1, 0x05, 0xff, 0xf6, 0x00,
+  0xfd, 0x02, 0x03, 0xff, 0x02, 0x1d, 0xf5, 0x03, 0x00, 0x14, 0x02, 0xf4,
+  0x00, 0x08, 0x07, 0x02, 0xf3, 0x0b, 0xd2, 0xeb, 0x07, 0xfb, 0x16, 0x04,
+  0xe5, 0xe8, 0x04, 0xf0, 0xed, 0xcb, 0xd1, 0x07, 0xf0, 0xeb, 0xef, 0xf1,
+  0x00, 0xdf, 0xe4, 0xf6, 0xff, 0xfc, 0x01, 0x0f, 0x00, 0x18, 0x00, 0x0f,
+  0x00, 0x10, 0xff, 0x06, 0x00, 0x06, 0xf5, 0x05, 0xfb, 0xed, 0xf7, 0xe8,
+  0xfa, 0xf0, 0x27, 0x03, 0xda, 0xf3, 0xf3, 0xfe, 0xf8, 0xdf, 0xde, 0x0c,
+  0xfa, 0x06, 0xf7, 0x0a, 0xfb, 0xfc, 0xf9, 0x03, 0xfe, 0x14, 0xfe, 0x15,
+  0x01, 0x17, 0x08, 0x11, 0x01, 0x0f, 0x02, 0x0e, 0x00, 0x09, 0xff, 0x05,
+  0xd6, 0xf7, 0xf3, 0xec, 0xe1, 0xfa, 0xf6, 0x0a, 0xe9, 0xef, 0x04, 0xfc,
+  0xf6, 0xf8, 0xde, 0x06, 0xfd, 0x0d, 0xf0, 0x0d, 0xfe, 0x08, 0xfb, 0xf9,
+  0x00, 0x1a, 0xfc, 0x1b, 0x00, 0x1c, 0x00, 0x1a, 0x00, 0x04, 0x04, 0x00,
+  0x00, 0x03, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf5, 0xfa, 0x10, 0x33, 0x0d, 0x31, 0xee, 0x09,
+  0x12, 0x09, 0x21, 0xfa, 0x04, 0x0f, 0x11, 0x1d, 0xff, 0x19, 0x03, 0x01,
+  0x05, 0x01, 0x08, 0xf6, 0x05, 0xfc, 0x05, 0xfe, 0x01, 0xec, 0x07, 0xf0,
+  0xf7, 0xef, 0xe2, 0xf0, 0xf2, 0x0e, 0xf0, 0x0d, 0x09, 0x07, 0xf9, 0x0c,
+  0x0e, 0x17, 0xfe, 0x0c, 0x06, 0x1c, 0x17, 0x08, 0x0f, 0x2b, 0x2d, 0x17,
+  0x0a, 0x11, 0x17, 0xf8, 0x07, 0xee, 0xfe, 0xeb, 0x05, 0xfc, 0x04, 0x05,
+  0x01, 0x06, 0x08, 0x00, 0x00, 0x06, 0x01, 0xfc, 0x00, 0x08, 0xf4, 0xfb,
+  0x0f, 0x14, 0xfd, 0x08, 0x05, 0x2d, 0x01, 0x12, 0x07, 0x1a, 0x0b, 0x08,
+  0x1c, 0x15, 0x27, 0x0d, 0x04, 0x08, 0x17, 0xfc, 0xfe, 0xe8, 0x19, 0xec,
+  0xf8, 0xfc, 0xfc, 0xea, 0x02, 0xf1, 0x05, 0xfc, 0x00, 0xf9, 0x0a, 0xff,
+  0x00, 0x0a, 0xfe, 0x02, 0xf7, 0xfe, 0x19, 0xf2, 0xfd, 0x18, 0x06, 0xf0,
+  0xea, 0x1c, 0xd8, 0xfe, 0x13, 0x12, 0x17, 0x0c, 0x12, 0xff, 0x0b, 0xf0,
+  0x04, 0xef, 0x09, 0x00, 0x04, 0xf7, 0x07, 0xfd, 0x01, 0xfb, 0x10, 0x10,
+  0x00, 0x09, 0x10, 0x14, 0x00, 0x10, 0xf8, 0x14, 0xf6, 0xe6, 0xef, 0xf5,
+  0xf4, 0x05, 0xf3, 0x08, 0xdc, 0xfc, 0xce, 0xfa, 0x18, 0xea, 0x0a, 0xf0,
+  0x16, 0x07, 0x01, 0xf8, 0x02, 0xea, 0x09, 0xea, 0x05, 0xed, 0xfc, 0xf8,
+  0x01, 0xfa, 0xfe, 0xfe, 0x00, 0x01, 0x06, 0x01, 0x00, 0x0d, 0x03, 0xff,
+  0xcd, 0xe6, 0xdd, 0xec, 0xda, 0xed, 0xfa, 0xf7, 0xd6, 0xde, 0xd5, 0xf0,
+  0x03, 0xf1, 0xf2, 0xf5, 0x0a, 0xfb, 0xf5, 0xf0, 0x0d, 0xee, 0x06, 0xe6,
+  0x01, 0xf3, 0xfd, 0xf5, 0x01, 0xfe, 0x03, 0x08, 0x00, 0x04, 0x05, 0x07,
+  0x00, 0x14, 0xf2, 0x0a, 0xa7, 0xf6, 0xfe, 0x04, 0xc6, 0xef, 0x02, 0xf8,
+  0xcc, 0xc3, 0xdd, 0xe2, 0x07, 0xd3, 0xcf, 0xeb, 0xff, 0x02, 0xe0, 0xff,
+  0x0c, 0xe5, 0x0a, 0xf5, 0xff, 0x06, 0x06, 0x19, 0x02, 0x0a, 0x08, 0x13,
+  0x01, 0x17, 0x0c, 0x08, 0x03, 0x18, 0x00, 0x03, 0xcb, 0x02, 0x0a, 0x0f,
+  0xe5, 0xe8, 0xdc, 0xe5, 0xdf, 0xd5, 0xfd, 0xfe, 0xf5, 0xdb, 0xeb, 0xf3,
+  0x05, 0x0a, 0xf7, 0xf4, 0x06, 0x04, 0xfa, 0xfb, 0x04, 0x0b, 0x04, 0x0d,
+  0x04, 0x12, 0x05, 0x07, 0x01, 0x13, 0x17, 0x06, 0x01, 0x0f, 0xfd, 0x02,
+  0xdc, 0xe2, 0x08, 0x02, 0xf2, 0xef, 0xd4, 0xd6, 0xdd, 0xc4, 0xf6, 0xfc,
+  0xfe, 0xe9, 0xf0, 0xe5, 0xfa, 0xdf, 0xe7, 0xe8, 0x05, 0xff, 0xf5, 0xf1,
+  0x07, 0x03, 0xfb, 0xff, 0x03, 0xfd, 0x06, 0x0c, 0x02, 0x01, 0x0b, 0x02,
+  0x01, 0xfb, 0x09, 0xf6, 0xe2, 0xfa, 0x13, 0x32, 0xed, 0xfe, 0xf1, 0x0b,
+  0xde, 0xea, 0x05, 0xfb, 0x05, 0xf0, 0xea, 0xfc, 0xf8, 0xf8, 0x07, 0xfc,
+  0xf5, 0x07, 0xe9, 0xf0, 0xff, 0xfe, 0xed, 0x07, 0x08, 0x03, 0x00, 0x0f,
+  0x09, 0xfe, 0xf4, 0xf2, 0x03, 0xf7, 0x05, 0xfd, 0xdd, 0x15, 0x03, 0x25,
+  0xf2, 0x1a, 0xff, 0x08, 0xf1, 0xe1, 0x36, 0x0e, 0xfb, 0xf4, 0x07, 0x15,
+  0xed, 0xfc, 0x07, 0xf9, 0x07, 0x04, 0xf3, 0x08, 0xf6, 0xf7, 0xfe, 0xf8,
+  0x02, 0x07, 0xfb, 0x15, 0x02, 0x17, 0xfb, 0x02, 0x04, 0x07, 0x06, 0x06,
+  0x01, 0xef, 0x0a, 0x1e, 0x06, 0x4c, 0x04, 0x1c, 0x08, 0xf1, 0x4a, 0xe0,
+  0x17, 0x15, 0x2b, 0x0b, 0xfc, 0xf3, 0xfa, 0xe4, 0x09, 0x06, 0xe1, 0xf7,
+  0xf5, 0xfd, 0x01, 0xee, 0x03, 0x04, 0x03, 0x08, 0x01, 0x03, 0xfa, 0xf7,
+  0x00, 0x17, 0x0f, 0x06, 0x23, 0xf9, 0x1f, 0xfd, 0x03, 0x3d, 0xf2, 0x36,
+  0x19, 0x00, 0x19, 0xf6, 0x11, 0x0b, 0x39, 0x1a, 0x03, 0xf4, 0xfc, 0xe0,
+  0x13, 0xec, 0xeb, 0xfc, 0xff, 0xf0, 0x00, 0x02, 0x03, 0x0a, 0xfb, 0xfd,
+  0x01, 0x00, 0xfd, 0xf6, 0x00, 0x09, 0x0f, 0x05, 0x40, 0x0c, 0x0f, 0x07,
+  0xfc, 0x4d, 0xdf, 0x29, 0x0a, 0x23, 0xff, 0x1c, 0x1c, 0x00, 0x37, 0x09,
+  0x06, 0xfe, 0xfd, 0xec, 0x04, 0x02, 0xf0, 0xf9, 0x08, 0xea, 0xf7, 0xf6,
+  0x02, 0xfc, 0xee, 0xf3, 0x01, 0x07, 0x0a, 0x03, 0x00, 0x0c, 0xeb, 0x0a,
+  0x22, 0xd1, 0x05, 0xef, 0xf4, 0x16, 0xf5, 0x0e, 0xe5, 0x19, 0xec, 0x1a,
+  0x1c, 0xf5, 0x38, 0xf7, 0x0b, 0x17, 0x10, 0xe9, 0x05, 0x15, 0x12, 0x0c,
+  0x04, 0xfc, 0x03, 0xfa, 0x02, 0x0b, 0xf4, 0xfb, 0x01, 0x20, 0xfe, 0x09,
+  0x06, 0x23, 0x09, 0x0b, 0x06, 0xd1, 0xe6, 0xee, 0xd2, 0xef, 0xda, 0x0a,
+  0xe3, 0x15, 0xe5, 0x33, 0x2c, 0x05, 0x24, 0xf3, 0x08, 0x11, 0x15, 0xea,
+  0x07, 0x19, 0x0f, 0xf7, 0x0a, 0x02, 0x0c, 0x05, 0x02, 0x23, 0x04, 0x07,
+  0x01, 0x22, 0x06, 0x0d, 0x05, 0x0e, 0x02, 0x05, 0xf8, 0xae, 0xf7, 0xd6,
+  0xcf, 0x01, 0xd4, 0x01, 0xbb, 0x08, 0xc9, 0x25, 0x22, 0x07, 0x09, 0x10,
+  0x11, 0x1d, 0x0b, 0x00, 0x08, 0x1f, 0x1a, 0xf8, 0x0c, 0x0b, 0xfe, 0x0a,
+  0x03, 0x21, 0xfb, 0x03, 0x01, 0x1d, 0xfc, 0x11, 0x04, 0x19, 0xfe, 0x03,
+  0xbd, 0xcd, 0xef, 0xfc, 0x9f, 0x03, 0xfc, 0x12, 0xca, 0x05, 0xee, 0x17,
+  0x07, 0xe8, 0xee, 0x12, 0x09, 0x0d, 0xf3, 0xfd, 0x06, 0x00, 0x0e, 0xfe,
+  0x09, 0x13, 0x05, 0x0e, 0x0b, 0x20, 0xfd, 0x08, 0x03, 0x1a, 0xfb, 0x09,
+  0x00, 0x16, 0x05, 0x06, 0xab, 0xdb, 0x1a, 0x13, 0xb6, 0x0b, 0x00, 0x14,
+  0xd6, 0xef, 0xf9, 0xfa, 0x00, 0xfc, 0xd7, 0x1f, 0x01, 0x0f, 0xef, 0x1d,
+  0xf9, 0xf5, 0x01, 0x06, 0xfc, 0x1b, 0x05, 0x1e, 0xf8, 0x2b, 0xff, 0x0a,
+  0x03, 0x24, 0xfb, 0x0a, 0x02, 0x17, 0x05, 0x0c, 0xaf, 0x21, 0x1c, 0x34,
+  0xfe, 0xf6, 0x06, 0x0e, 0xd7, 0xf9, 0xf0, 0xeb, 0xea, 0x0f, 0xec, 0x2b,
+  0x04, 0x1e, 0xfa, 0x24, 0x05, 0x0a, 0xff, 0x06, 0xf2, 0x0c, 0xfb, 0x0f,
+  0x05, 0x08, 0xfc, 0x06, 0x02, 0x1b, 0xff, 0x05, 0x03, 0x09, 0xf8, 0x03,
+  0xbe, 0x35, 0x4b, 0x4e, 0xfd, 0x23, 0x0a, 0x19, 0xe6, 0x14, 0x00, 0xf2,
+  0xf8, 0x15, 0xe6, 0x12, 0x13, 0x1c, 0x04, 0x1c, 0x05, 0x09, 0xfb, 0x1b,
+  0xef, 0x18, 0xf1, 0x0e, 0x04, 0x28, 0xf7, 0x0c, 0x01, 0x0b, 0xfc, 0x07,
+  0x01, 0x18, 0x08, 0x00, 0xd6, 0x4d, 0x35, 0x44, 0x15, 0x28, 0x15, 0x07,
+  0xec, 0x26, 0x21, 0x03, 0xfd, 0x1d, 0x17, 0xfe, 0x09, 0x1d, 0xfd, 0x27,
+  0xfd, 0x11, 0x0e, 0x0d, 0xf9, 0x14, 0xfe, 0x11, 0x02, 0x0b, 0xfd, 0xf9,
+  0x00, 0xfe, 0xf7, 0x01, 0x01, 0x0f, 0xee, 0xfd, 0xe5, 0x15, 0xf0, 0x06,
+  0xfd, 0x0a, 0xe8, 0x14, 0xe8, 0x0c, 0x28, 0xe9, 0x06, 0x13, 0x0d, 0xf7,
+  0x0d, 0x1c, 0x0e, 0x12, 0xfb, 0x16, 0xf9, 0x13, 0x05, 0x1a, 0xfc, 0x0d,
+  0x01, 0x09, 0xf9, 0x01, 0xf2, 0x02, 0xfa, 0xf7, 0x01, 0x05, 0xf4, 0xfa,
+  0xd3, 0x2b, 0xf3, 0x0b, 0x01, 0x01, 0xdb, 0x17, 0xee, 0x07, 0xf9, 0xef,
+  0x04, 0xf0, 0x04, 0xe2, 0x08, 0x19, 0x14, 0xf6, 0xfc, 0x08, 0x05, 0xf3,
+  0x06, 0x03, 0x02, 0x02, 0x01, 0xf1, 0x04, 0x01, 0x00, 0xfd, 0xfb, 0xfd,
+  0x00, 0xf7, 0x04, 0xfa, 0xe8, 0x1a, 0xf4, 0xfd, 0xee, 0x02, 0xf3, 0x11,
+  0xfb, 0x00, 0x07, 0x07, 0x00, 0x18, 0x04, 0x06, 0x09, 0x05, 0x1b, 0x03,
+  0xff, 0x0c, 0x07, 0x04, 0xff, 0x15, 0x02, 0x07, 0x00, 0x1a, 0xf9, 0x0c,
+  0x08, 0x0d, 0x14, 0x01, 0x16, 0x08, 0x13, 0xfe, 0xe3, 0x00, 0x0b, 0xf2,
+  0xee, 0xf6, 0xe4, 0xfd, 0xfc, 0xf4, 0x03, 0x03, 0x00, 0xf9, 0x02, 0xfb,
+  0xff, 0xf5, 0xfb, 0x00, 0xff, 0xfb, 0xfb, 0xfe, 0xff, 0xf9, 0xfe, 0x01,
+  0x00, 0xf8, 0xff, 0xf9, 0x00, 0xfc, 0x01, 0xfe, 0x00, 0xfe, 0x08, 0x00,
+  0xe3, 0x13, 0x0e, 0x05, 0xe9, 0xf7, 0xf8, 0xff, 0xfa, 0xf8, 0xf4, 0x06,
+  0xff, 0xed, 0x07, 0xf6, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xfe, 0x04,
+  0xff, 0xfd, 0x04, 0xfb, 0x00, 0xfa, 0x00, 0xfc, 0x00, 0xf9, 0xfe, 0xfb,
+  0x00, 0xf6, 0x02, 0xfa, 0xdf, 0x01, 0x04, 0x15, 0xdd, 0xff, 0x03, 0x18,
+  0xfd, 0xef, 0xee, 0x0f, 0xff, 0xff, 0x04, 0x02, 0xff, 0xfc, 0x01, 0x07,
+  0xff, 0xff, 0x01, 0xfb, 0xff, 0x03, 0x07, 0xfb, 0x00, 0xfb, 0x01, 0xf4,
+  0x00, 0xf5, 0xfc, 0xf5, 0x00, 0xf9, 0xff, 0xf5, 0xce, 0x03, 0xfd, 0xec,
+  0xf0, 0xf7, 0xd7, 0x09, 0xf6, 0x01, 0xf5, 0x00, 0xfa, 0x1b, 0xfe, 0x01,
+  0xff, 0x0b, 0x07, 0xf5, 0xff, 0x06, 0xfd, 0xfc, 0xff, 0xfe, 0xff, 0xff,
+  0x00, 0xfa, 0x04, 0x00, 0xff, 0xfc, 0x00, 0xfd, 0x00, 0xf8, 0x00, 0xfd,
+  0xed, 0xe4, 0x1b, 0xf5, 0xdd, 0xfd, 0xdb, 0xe7, 0xf9, 0xe8, 0x00, 0x00,
+  0xfb, 0xf6, 0xfc, 0xf8, 0xfe, 0xf1, 0x14, 0xf6, 0xff, 0xf3, 0xfe, 0xfe,
+  0xff, 0xe7, 0xf7, 0xe7, 0x00, 0xee, 0xf5, 0xf6, 0x00, 0xe9, 0xfb, 0xfe,
+  0x00, 0xeb, 0x06, 0xec, 0x10, 0xe9, 0x04, 0xd8, 0xe4, 0x18, 0xd9, 0xea,
+  0xff, 0xef, 0xe8, 0xfe, 0xfb, 0xee, 0xfc, 0xf3, 0xff, 0xe4, 0x01, 0x01,
+  0xff, 0xed, 0xfc, 0xfc, 0xff, 0xee, 0x00, 0xf3, 0x00, 0xf1, 0xf6, 0xff,
+  0xfe, 0xef, 0xf6, 0xf3, 0x00, 0xff, 0x0b, 0xfc, 0x08, 0xde, 0x02, 0xea,
+  0xf4, 0x03, 0x2d, 0x08, 0xea, 0x16, 0xc7, 0xe9, 0xfb, 0xd4, 0xfa, 0xed,
+  0xf6, 0xf7, 0x0a, 0x09, 0xff, 0x05, 0x05, 0x0a, 0xff, 0xf7, 0xfd, 0x01,
+  0x00, 0x02, 0xfb, 0x00, 0x00, 0x04, 0x03, 0x08, 0x00, 0x02, 0xff, 0xff,
+  0xef, 0xdf, 0xf4, 0xe5, 0x02, 0xf1, 0x5e, 0xea, 0xe5, 0x0a, 0xe9, 0xe6,
+  0xfa, 0xf1, 0xf4, 0x21, 0x02, 0x02, 0x08, 0x2a, 0xff, 0x18, 0x0c, 0xf9,
+  0xff, 0xf7, 0xf3, 0xf0, 0x00, 0x02, 0x06, 0x0b, 0x00, 0x01, 0x02, 0xee,
+  0x00, 0x03, 0x00, 0xf8, 0xf8, 0xf0, 0xd7, 0xd6, 0x0a, 0xd6, 0x45, 0xfd,
+  0x0b, 0x06, 0x1c, 0xe5, 0xde, 0x15, 0xee, 0x21, 0x18, 0xff, 0xf2, 0x0c,
+  0x0c, 0xf0, 0x02, 0xe4, 0xfe, 0x05, 0x0a, 0x02, 0xff, 0x09, 0xee, 0x04,
+  0xfc, 0xfc, 0xf4, 0xff, 0x00, 0xf0, 0xf4, 0xf6, 0xf8, 0x2d, 0xe8, 0xf2,
+  0x07, 0xe4, 0x15, 0x14, 0x16, 0xf5, 0x21, 0xf4, 0xfa, 0xf6, 0xec, 0x06,
+  0x13, 0xe3, 0xef, 0x15, 0xf9, 0xdb, 0xfa, 0xf7, 0x0c, 0xf3, 0x0d, 0x05,
+  0xff, 0xf5, 0xf5, 0x0f, 0x00, 0xee, 0x07, 0x0b, 0xff, 0xff, 0xf4, 0xfb,
+  0xf5, 0x47, 0xee, 0xe7, 0x23, 0xf0, 0xee, 0xf2, 0x35, 0xf4, 0x1b, 0xe4,
+  0xe2, 0xf2, 0xf8, 0xfc, 0xfe, 0xd8, 0xe0, 0xeb, 0xf4, 0xe3, 0xfb, 0xec,
+  0x0c, 0xf2, 0x05, 0x03, 0xf1, 0xf7, 0xfa, 0x0e, 0xf8, 0xf9, 0xf9, 0x01,
+  0x00, 0xf5, 0x0e, 0xfc, 0xf3, 0x2e, 0x07, 0xf2, 0x11, 0xdd, 0xdb, 0xf7,
+  0x2b, 0xdb, 0x04, 0xf6, 0xe3, 0xc7, 0xfa, 0xf6, 0xec, 0xdc, 0xe1, 0xe9,
+  0xf3, 0xf3, 0xea, 0xf7, 0xf2, 0xfa, 0xf7, 0x04, 0xf0, 0xf8, 0xfe, 0x0e,
+  0x00, 0xfd, 0xfa, 0xfe, 0x00, 0xfd, 0x03, 0xff, 0xd3, 0x11, 0x25, 0x04,
+  0xff, 0xf9, 0xc0, 0xed, 0xe6, 0x0c, 0x14, 0x05, 0xdc, 0xfe, 0xf6, 0xfd,
+  0xe6, 0xfb, 0xf8, 0x02, 0xf1, 0xf7, 0xfd, 0x00, 0xf4, 0x09, 0xf4, 0xf9,
+  0xf0, 0x0b, 0x06, 0x0c, 0x00, 0xf9, 0x00, 0xfe, 0x00, 0x01, 0x07, 0xfc,
+  0xdc, 0xf2, 0x26, 0x17, 0xc2, 0x1e, 0xd9, 0xea, 0xf5, 0x0e, 0x06, 0xf2,
+  0xde, 0x19, 0xfd, 0xee, 0xfa, 0x04, 0x0c, 0x05, 0xff, 0x07, 0xfb, 0xf9,
+  0x02, 0x08, 0xfa, 0x05, 0xf0, 0xfe, 0x03, 0xf7, 0xff, 0xf0, 0xff, 0xfc,
+  0x00, 0xe8, 0x09, 0xfe, 0xfa, 0xe1, 0x27, 0x06, 0xcf, 0x2b, 0xd1, 0xe7,
+  0xdf, 0xf1, 0xe9, 0x0b, 0xfd, 0xfc, 0x19, 0xef, 0x00, 0x00, 0x00, 0xfb,
+  0x04, 0x07, 0x00, 0x09, 0x00, 0x06, 0x01, 0xfd, 0xff, 0xee, 0xff, 0xfd,
+  0x00, 0xf8, 0x07, 0x06, 0x00, 0xf7, 0x04, 0xfc, 0x06, 0xcc, 0x0b, 0xdc,
+  0xe5, 0x0f, 0x0d, 0xf4, 0xee, 0x04, 0xd5, 0xfa, 0xfa, 0x01, 0x17, 0xf2,
+  0x04, 0xe9, 0x09, 0xe5, 0xfd, 0xff, 0x04, 0xff, 0xfe, 0xf5, 0xff, 0xf4,
+  0xff, 0xf4, 0xff, 0xf6, 0x00, 0xf7, 0x05, 0xfd, 0x00, 0xf2, 0x04, 0xfd,
+  0x1d, 0xc7, 0xff, 0xda, 0xda, 0x13, 0x19, 0xf0, 0xf8, 0xfb, 0xeb, 0xde,
+  0xfe, 0xfd, 0x0f, 0xe3, 0x09, 0xfc, 0xf4, 0xf8, 0xfe, 0xe6, 0xfd, 0xe6,
+  0xfa, 0xf1, 0xff, 0xf6, 0xfa, 0xef, 0xf1, 0xfd, 0x00, 0xf6, 0xf9, 0x03,
+  0x00, 0xf4, 0xfd, 0xfa, 0x19, 0xda, 0x0a, 0xd4, 0xed, 0x05, 0x1e, 0xe1,
+  0x05, 0x13, 0xf0, 0x01, 0xe9, 0x0a, 0xfd, 0xf3, 0xf7, 0x02, 0x00, 0x00,
+  0xfe, 0xff, 0x0c, 0x03, 0xf8, 0xf7, 0xfc, 0x09, 0xfc, 0xed, 0x03, 0xf8,
+  0x00, 0xea, 0xf9, 0xfb, 0x00, 0xf8, 0x06, 0xf8, 0x07, 0xf4, 0xfc, 0xc1,
+  0xfa, 0x04, 0x02, 0xf4, 0x08, 0x00, 0x0f, 0xfd, 0xfa, 0xe7, 0x0b, 0xf5,
+  0xfd, 0xf4, 0xf9, 0xfb, 0x09, 0x0c, 0x01, 0x03, 0x05, 0xff, 0x0b, 0x04,
+  0xfd, 0x01, 0x07, 0xf4, 0x00, 0xf6, 0xfe, 0xff, 0x00, 0xfe, 0x06, 0xfe,
+  0xff, 0x04, 0xe9, 0xc9, 0x16, 0x0a, 0x12, 0xfd, 0x21, 0xf4, 0xf6, 0xef,
+  0xf6, 0xe3, 0x03, 0xfa, 0xf0, 0xfb, 0x09, 0xff, 0x07, 0x02, 0xf9, 0x06,
+  0x14, 0xfe, 0x0b, 0x00, 0xfe, 0xf3, 0xf7, 0xf5, 0x00, 0xf6, 0x07, 0x04,
+  0x00, 0xfd, 0xfd, 0x02, 0xee, 0xfc, 0xce, 0xec, 0x1e, 0x07, 0x12, 0xf2,
+  0x18, 0xf8, 0x0d, 0xef, 0xfa, 0xe4, 0xec, 0x00, 0xf2, 0xfd, 0xea, 0xfa,
+  0x07, 0xe8, 0xfc, 0xf9, 0x10, 0xfc, 0xfd, 0xf8, 0x00, 0xf5, 0x0c, 0xf2,
+  0x00, 0xfd, 0x05, 0xfd, 0x00, 0x01, 0x0c, 0x08, 0x01, 0x11, 0x16, 0xe3,
+  0x1e, 0xfd, 0x1b, 0xeb, 0x1a, 0xfb, 0x05, 0x00, 0xf9, 0x01, 0xf9, 0xff,
+  0x05, 0xfe, 0xea, 0xfc, 0x0d, 0xee, 0x09, 0xf8, 0xff, 0xf9, 0xfc, 0xf2,
+  0x00, 0xf7, 0x05, 0xf1, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x01, 0x0b, 0x06,
+  0x10, 0x27, 0x46, 0x15, 0x17, 0x2e, 0x32, 0x06, 0x15, 0x24, 0x2d, 0x12,
+  0xf3, 0x24, 0x0c, 0x28, 0x00, 0x04, 0xf5, 0x24, 0x08, 0x00, 0xf5, 0x0a,
+  0xfe, 0xfa, 0xfd, 0xf3, 0x00, 0xfd, 0x02, 0xfa, 0x00, 0xfd, 0x05, 0x06,
+  0x00, 0xff, 0xfb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x22, 0x3b, 0x0f, 0x14, 0x12, 0x1f,
+  0x24, 0x03, 0x41, 0x1c, 0x02, 0x38, 0x23, 0x17, 0x04, 0x19, 0xff, 0x06,
+  0x08, 0x2d, 0x19, 0x18, 0x0e, 0x2d, 0x19, 0x24, 0x05, 0x20, 0x1c, 0x04,
+  0xfa, 0x16, 0xf1, 0x10, 0xf5, 0x2e, 0x06, 0x19, 0x00, 0x2f, 0xf7, 0x17,
+  0x14, 0xf9, 0x05, 0x25, 0xfb, 0xe1, 0xe5, 0xf9, 0x16, 0x11, 0x08, 0x19,
+  0x07, 0x13, 0x09, 0xfc, 0x0d, 0x04, 0x0d, 0xfa, 0x10, 0x11, 0xff, 0x26,
+  0x06, 0x29, 0x0e, 0x14, 0x03, 0x07, 0x09, 0xfd, 0x02, 0x04, 0xfb, 0xfe,
+  0xf3, 0x27, 0xfe, 0x31, 0x0e, 0xf4, 0x0c, 0x27, 0xd6, 0xe6, 0xe6, 0xf9,
+  0x02, 0x0e, 0xf8, 0x17, 0x0f, 0x09, 0xe7, 0xf4, 0x03, 0x0e, 0x15, 0xf5,
+  0x00, 0x0f, 0xf7, 0x0e, 0x06, 0x25, 0x18, 0x18, 0x03, 0x0c, 0x11, 0x01,
+  0x02, 0x17, 0x0a, 0x10, 0xfc, 0x14, 0xe8, 0x3d, 0x16, 0xf3, 0x06, 0x1e,
+  0xe0, 0xde, 0xeb, 0xf9, 0x0b, 0xf9, 0xf4, 0x08, 0xf5, 0xfb, 0xdf, 0xdc,
+  0xed, 0xfc, 0xdf, 0x09, 0x06, 0xf7, 0xf9, 0x16, 0x06, 0x1a, 0x0c, 0x24,
+  0x01, 0xfc, 0x10, 0x13, 0x02, 0x20, 0xfa, 0x15, 0x05, 0x20, 0x0c, 0x3c,
+  0x13, 0xec, 0x0d, 0x1e, 0x00, 0xf9, 0x13, 0x12, 0x05, 0x0f, 0x17, 0x00,
+  0xf4, 0x12, 0xde, 0x26, 0xff, 0x02, 0x07, 0xf8, 0xf5, 0xed, 0xfc, 0x13,
+  0x03, 0xf3, 0xfd, 0x03, 0x04, 0xfb, 0x03, 0x05, 0x03, 0x0e, 0xfb, 0x0c,
+  0x10, 0x3f, 0xed, 0x13, 0x3f, 0x0b, 0x15, 0x2d, 0x15, 0x01, 0x1e, 0x03,
+  0x08, 0x21, 0x0f, 0x0c, 0xf7, 0x1f, 0x00, 0xfd, 0x00, 0x22, 0xec, 0xfe,
+  0xfc, 0x02, 0xfd, 0x0b, 0x03, 0x0c, 0xfc, 0xed, 0x02, 0x01, 0x09, 0xf8,
+  0x03, 0x0c, 0xf2, 0x05, 0x46, 0x1c, 0xc1, 0x0a, 0x51, 0xe5, 0xf1, 0xfe,
+  0x1c, 0xed, 0x03, 0xfa, 0x12, 0xff, 0xfd, 0x10, 0x12, 0xfa, 0x05, 0x0b,
+  0x01, 0x0a, 0xeb, 0x02, 0xfd, 0xe4, 0xff, 0x09, 0x00, 0xf2, 0x05, 0xea,
+  0x04, 0xed, 0xf6, 0xfc, 0x06, 0xfa, 0xf8, 0xf7, 0x47, 0xea, 0xc4, 0xd6,
+  0x36, 0xe4, 0x12, 0xf3, 0x17, 0x00, 0xfe, 0x0a, 0x25, 0xf6, 0xfe, 0x1a,
+  0xfc, 0x0e, 0x07, 0x04, 0xf7, 0x17, 0xf3, 0xff, 0x02, 0x04, 0x05, 0x10,
+  0x09, 0xfe, 0x01, 0xf2, 0x04, 0x0e, 0xfd, 0x15, 0x04, 0x10, 0xee, 0xfe,
+  0x31, 0xde, 0xa5, 0x95, 0x20, 0xb4, 0xfe, 0xdb, 0x0d, 0x02, 0xf3, 0xe7,
+  0x12, 0xe7, 0xe4, 0x19, 0x11, 0xea, 0x0d, 0xe0, 0x0b, 0xfa, 0xf6, 0x09,
+  0x07, 0xfd, 0xf9, 0x11, 0x07, 0xfa, 0x0a, 0xec, 0x04, 0x25, 0x02, 0x03,
+  0xfd, 0xfb, 0xe9, 0xfe, 0x27, 0xd4, 0x81, 0x86, 0x11, 0x9b, 0xeb, 0xf7,
+  0x03, 0xd0, 0xf0, 0xe9, 0x03, 0xd9, 0xdf, 0x12, 0x17, 0xf9, 0xd7, 0x0b,
+  0x0b, 0xfd, 0x03, 0x01, 0x0d, 0xeb, 0xf9, 0x0a, 0x09, 0x0d, 0xfc, 0xe9,
+  0x04, 0xfb, 0xf6, 0xf7, 0x02, 0xfa, 0xf3, 0x02, 0x19, 0xe4, 0x99, 0xa8,
+  0xee, 0xaf, 0x18, 0x04, 0x05, 0xca, 0xfa, 0x06, 0x06, 0xe0, 0xbd, 0x27,
+  0xfa, 0xec, 0xfc, 0x16, 0x08, 0xda, 0xf6, 0xff, 0xff, 0xfa, 0x09, 0x1a,
+  0x07, 0xf9, 0x01, 0xf1, 0x03, 0x0c, 0xfd, 0xfe, 0x00, 0x07, 0xfd, 0xfa,
+  0x00, 0xce, 0xbb, 0xbd, 0xf8, 0xca, 0x0d, 0x01, 0xfd, 0xe4, 0x17, 0x08,
+  0x00, 0xf0, 0xb7, 0x22, 0xf8, 0x0b, 0xfb, 0x11, 0xfc, 0x18, 0xfe, 0x0f,
+  0xfa, 0x29, 0x04, 0x14, 0x06, 0x24, 0x23, 0x15, 0x04, 0x1d, 0xfb, 0xfb,
+  0x03, 0x0a, 0x00, 0xfc, 0xf3, 0xdf, 0xa2, 0xb5, 0xd7, 0xcd, 0xf6, 0x0c,
+  0x16, 0xd0, 0x14, 0xe3, 0xf8, 0x06, 0xda, 0x13, 0xf7, 0x0e, 0x01, 0x18,
+  0x00, 0x12, 0x09, 0x15, 0x05, 0x37, 0x04, 0x1f, 0x05, 0x30, 0x02, 0x18,
+  0x04, 0x18, 0x02, 0x0d, 0x04, 0x0a, 0x0d, 0x06, 0xe3, 0xe4, 0xc9, 0xde,
+  0xd1, 0xf8, 0xe5, 0x27, 0x16, 0xd4, 0x2f, 0x01, 0xef, 0xf2, 0xd6, 0x1f,
+  0xff, 0xf0, 0xed, 0x12, 0xff, 0x06, 0xf1, 0x0d, 0xfa, 0x2b, 0x0e, 0x24,
+  0x05, 0x28, 0x0d, 0x25, 0x04, 0x1f, 0x14, 0x0a, 0x04, 0x0c, 0x13, 0x05,
+  0xd7, 0xec, 0xe5, 0xe7, 0xb7, 0x00, 0x08, 0x1e, 0x12, 0xe5, 0x29, 0x05,
+  0xf5, 0x06, 0x00, 0x05, 0xf7, 0x23, 0x0c, 0x21, 0xfc, 0x0a, 0x0a, 0x10,
+  0xf2, 0x28, 0x07, 0x16, 0x05, 0x38, 0x06, 0x15, 0x04, 0x26, 0xfc, 0x13,
+  0x03, 0x1c, 0x06, 0x07, 0xec, 0xe9, 0xf7, 0xee, 0xd7, 0xe6, 0xe9, 0xff,
+  0x15, 0xd9, 0x10, 0xf8, 0xfe, 0xe5, 0x0b, 0xcd, 0x05, 0x02, 0xeb, 0x09,
+  0x04, 0x14, 0x18, 0x20, 0xf5, 0x25, 0xf5, 0x0b, 0x06, 0x2d, 0x13, 0x17,
+  0x04, 0x1d, 0xfa, 0x14, 0x02, 0x16, 0x0f, 0x07, 0xfb, 0xd1, 0xe8, 0xf6,
+  0xd4, 0x09, 0xf3, 0x13, 0x19, 0xd2, 0xf9, 0xfa, 0x0d, 0xdd, 0x08, 0xf6,
+  0xfd, 0xff, 0x03, 0x07, 0xfd, 0x1d, 0x1a, 0x03, 0x00, 0x0e, 0xf0, 0x0d,
+  0x06, 0x22, 0x03, 0x17, 0x04, 0x17, 0x02, 0x11, 0x02, 0x18, 0x07, 0x04,
+  0xfc, 0xe5, 0x1e, 0x08, 0xe9, 0xe5, 0xe6, 0xfe, 0x06, 0xb8, 0x0d, 0xf3,
+  0x00, 0xe5, 0xfc, 0xfc, 0xfe, 0xfa, 0xfe, 0xfe, 0xf9, 0x1c, 0x04, 0x0a,
+  0xfb, 0x05, 0xf5, 0xf8, 0x13, 0x1e, 0x19, 0x0d, 0x02, 0x13, 0x0a, 0x03,
+  0x02, 0x0b, 0x05, 0xfe, 0xf0, 0x12, 0x1b, 0x36, 0xf5, 0x04, 0xe1, 0x2e,
+  0x0b, 0xeb, 0x0e, 0x15, 0x09, 0x04, 0x1b, 0xee, 0x04, 0x05, 0xee, 0x0c,
+  0x01, 0x07, 0xfe, 0xf7, 0x01, 0x0f, 0x01, 0xfa, 0x07, 0x19, 0x08, 0x12,
+  0x04, 0x21, 0x09, 0x10, 0x01, 0x10, 0x00, 0x03, 0x02, 0x34, 0x25, 0x43,
+  0x16, 0x14, 0xef, 0x15, 0x05, 0x04, 0x11, 0x16, 0x10, 0xff, 0x0a, 0xfb,
+  0x00, 0x14, 0x06, 0x04, 0x01, 0xd2, 0xe9, 0xe7, 0x06, 0xf6, 0xf0, 0xed,
+  0x06, 0xe9, 0x0d, 0xfd, 0x01, 0x09, 0xfe, 0xf8, 0x02, 0x03, 0x04, 0xf9,
+  0x04, 0x12, 0x58, 0x54, 0x0f, 0x24, 0xf6, 0x0d, 0x0b, 0x29, 0x2c, 0x18,
+  0x11, 0x2b, 0x16, 0xfb, 0x0a, 0x11, 0xf2, 0x01, 0x0a, 0xe2, 0x07, 0x06,
+  0x01, 0x10, 0xf5, 0xfe, 0x03, 0x11, 0x0b, 0x07, 0x02, 0x1d, 0xfd, 0x06,
+  0x03, 0x0d, 0x05, 0x00, 0x32, 0x1b, 0x26, 0x14, 0x09, 0x28, 0xfc, 0x03,
+  0x1e, 0x0b, 0x1c, 0x1d, 0x1f, 0x12, 0x3f, 0xeb, 0x0f, 0x02, 0x08, 0xf7,
+  0x07, 0x06, 0x02, 0x00, 0x03, 0x07, 0x05, 0x06, 0x04, 0x05, 0xfd, 0xfb,
+  0x02, 0x0c, 0x00, 0x01, 0x04, 0x14, 0xf7, 0xf7, 0x2a, 0xfc, 0xf9, 0x0a,
+  0x0a, 0x3a, 0xef, 0x14, 0x0f, 0xef, 0x19, 0xfa, 0x21, 0x2d, 0x2f, 0x02,
+  0x0d, 0x21, 0x1c, 0xfc, 0x05, 0x2a, 0x08, 0x20, 0x09, 0x11, 0x19, 0x0b,
+  0x03, 0x14, 0xfe, 0x11, 0x03, 0x08, 0x0b, 0xf4, 0x01, 0x0b, 0xef, 0xf8,
+  0x2f, 0x04, 0xed, 0xf8, 0x15, 0x03, 0xd2, 0x0b, 0x01, 0xef, 0x02, 0xff,
+  0x17, 0x03, 0xf8, 0xf4, 0x0e, 0x0c, 0x23, 0xe7, 0x0a, 0x1f, 0x0a, 0x00,
+  0x0a, 0x29, 0x13, 0x0a, 0x03, 0x06, 0x12, 0x06, 0x03, 0x10, 0xff, 0xff,
+  0x03, 0x04, 0x0d, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x0a, 0xfc, 0x1e, 0xfc, 0xe5, 0xf7, 0x1c,
+  0x01, 0xdf, 0x14, 0x0a, 0xfb, 0x18, 0x00, 0x13, 0xff, 0x13, 0x0d, 0x07,
+  0x01, 0x03, 0x00, 0xf8, 0x01, 0x0c, 0x0e, 0x12, 0x00, 0x0c, 0x0b, 0xff,
+  0xfa, 0xf2, 0xfb, 0x0e, 0xfd, 0x14, 0x0b, 0x0e, 0xf6, 0x2b, 0x1d, 0x47,
+  0x0b, 0x23, 0x1f, 0x2f, 0xff, 0x17, 0x11, 0x1d, 0x08, 0x2d, 0xff, 0x1c,
+  0x00, 0x17, 0x0d, 0x06, 0x04, 0xfd, 0xfd, 0xf0, 0x01, 0x07, 0x05, 0x17,
+  0x00, 0x24, 0x08, 0x18, 0x00, 0x07, 0xff, 0x05, 0x00, 0x02, 0xfe, 0xfe,
+  0x13, 0x3b, 0x1b, 0x34, 0x18, 0x20, 0x16, 0x13, 0x06, 0x12, 0x1a, 0xff,
+  0x09, 0x19, 0x05, 0xfd, 0x09, 0x0c, 0x05, 0xff, 0xfd, 0x0b, 0x18, 0xf2,
+  0xf6, 0x04, 0xf4, 0x09, 0x02, 0x0f, 0x0b, 0x10, 0x00, 0x05, 0x12, 0x09,
+  0x00, 0x12, 0x00, 0xfc, 0x3a, 0x43, 0x3d, 0x4a, 0x3d, 0x4b, 0x13, 0x0f,
+  0x03, 0x17, 0x0a, 0x01, 0x04, 0x12, 0x0f, 0x12, 0xf2, 0x0f, 0x09, 0x01,
+  0xef, 0x1a, 0xf5, 0x13, 0x00, 0xfa, 0xfb, 0x10, 0x01, 0x05, 0x0f, 0x17,
+  0x00, 0xfe, 0x01, 0x0e, 0x00, 0x1d, 0xef, 0x1c, 0x58, 0xf4, 0x02, 0x08,
+  0x2a, 0x3f, 0xf4, 0xf7, 0x09, 0x1b, 0x02, 0x0d, 0x0b, 0x24, 0x27, 0xed,
+  0xfd, 0x17, 0xfd, 0x1f, 0xfe, 0x14, 0x16, 0x04, 0xed, 0xf3, 0xfb, 0x18,
+  0x00, 0xfd, 0xf7, 0xf4, 0x00, 0xfc, 0xfe, 0xf5, 0x00, 0x07, 0xf7, 0x00,
+  0x40, 0xb2, 0xc5, 0xbf, 0x10, 0xe9, 0xf0, 0xf6, 0xf9, 0x05, 0xeb, 0x08,
+  0x13, 0xf9, 0x16, 0xee, 0x06, 0xf4, 0xff, 0xfc, 0xfc, 0x10, 0x09, 0xf7,
+  0xf8, 0xf8, 0xfc, 0x0c, 0x01, 0x0b, 0x02, 0x05, 0x00, 0x05, 0x08, 0xf9,
+  0x00, 0x06, 0xf9, 0x08, 0xf9, 0xb3, 0xae, 0xbd, 0xf4, 0xce, 0x05, 0xf5,
+  0xfb, 0x01, 0xda, 0xfa, 0x0a, 0xef, 0xdb, 0xf4, 0x0e, 0xfe, 0xff, 0x0a,
+  0xff, 0xfb, 0x1b, 0x01, 0xf8, 0xf9, 0x01, 0x0e, 0xfd, 0x06, 0x05, 0x0c,
+  0x01, 0xff, 0xfe, 0xfd, 0x02, 0xf3, 0xf6, 0xf6, 0xe5, 0xdb, 0xbf, 0xc1,
+  0xe2, 0xc9, 0x1f, 0x04, 0xfd, 0xd1, 0xd9, 0xf8, 0x18, 0xc9, 0xf1, 0xfe,
+  0xfd, 0xf9, 0xed, 0x02, 0xf4, 0xfa, 0x0d, 0xf7, 0xf9, 0x0c, 0x0d, 0x0c,
+  0x02, 0x0f, 0xfc, 0xff, 0x01, 0xf9, 0x07, 0xfc, 0x00, 0xfb, 0xf1, 0xf2,
+  0xc5, 0x07, 0xd2, 0xde, 0x00, 0xdc, 0x36, 0x0a, 0xf6, 0xdb, 0xe5, 0xfc,
+  0x07, 0xe5, 0xbf, 0x17, 0xf6, 0xe5, 0xee, 0x16, 0x04, 0xfe, 0xff, 0x22,
+  0x02, 0x08, 0x0a, 0x09, 0x02, 0x06, 0x08, 0xf6, 0x01, 0x10, 0x00, 0xf8,
+  0xfb, 0xfb, 0xf3, 0x06, 0xea, 0xf4, 0xe0, 0xe7, 0x07, 0xbe, 0x15, 0x08,
+  0xfe, 0xd3, 0xe6, 0x03, 0xe4, 0xf0, 0xc9, 0x02, 0xfb, 0xde, 0xd4, 0x09,
+  0x06, 0xec, 0xee, 0xff, 0x03, 0x02, 0x08, 0x04, 0x03, 0x12, 0xfc, 0xfb,
+  0x01, 0xfb, 0xf5, 0x00, 0x01, 0xfa, 0x08, 0x01, 0xf1, 0xf0, 0xde, 0xf4,
+  0x0c, 0xe0, 0x2f, 0xfd, 0xee, 0xcf, 0xf6, 0xf8, 0xe0, 0xc9, 0xb4, 0x12,
+  0xe8, 0xe7, 0xee, 0x0e, 0xfb, 0xdd, 0xef, 0xee, 0x04, 0xfc, 0x0b, 0xfd,
+  0x05, 0xec, 0xf6, 0xf6, 0x01, 0x16, 0x04, 0x05, 0x03, 0x00, 0x0a, 0xf7,
+  0xc6, 0xe0, 0xd8, 0xf0, 0x06, 0xf5, 0x0b, 0x03, 0xdb, 0xfc, 0x14, 0xf4,
+  0xf5, 0xf0, 0xc8, 0x12, 0x04, 0x08, 0xfe, 0xfc, 0xfc, 0x08, 0xf5, 0x17,
+  0x00, 0x0e, 0xfd, 0x0e, 0x03, 0x23, 0x10, 0x13, 0x03, 0x12, 0xfe, 0x01,
+  0x00, 0x04, 0xfa, 0xf3, 0xc5, 0xe6, 0xf3, 0xd9, 0xe3, 0x08, 0xee, 0x0f,
+  0xf2, 0xf6, 0xff, 0xec, 0xe9, 0xf8, 0xec, 0x08, 0x06, 0xee, 0xff, 0x02,
+  0x00, 0x07, 0x07, 0x0f, 0xff, 0x25, 0xfa, 0x09, 0x02, 0x2f, 0x07, 0x21,
+  0x01, 0x0e, 0x01, 0x07, 0x00, 0x08, 0x03, 0x05, 0xcd, 0xe9, 0xf8, 0xf8,
+  0xcc, 0x10, 0xd5, 0x0b, 0xe4, 0xf4, 0x0a, 0x09, 0xf0, 0xfd, 0xe7, 0xf6,
+  0x02, 0xe2, 0xea, 0xfc, 0xfd, 0xf5, 0xfc, 0x05, 0xf9, 0x08, 0xf8, 0x0b,
+  0x01, 0x15, 0x05, 0x19, 0x00, 0x01, 0x08, 0x07, 0x00, 0x06, 0x03, 0x02,
+  0xdf, 0xf6, 0x0c, 0x17, 0xc3, 0x10, 0xe5, 0x05, 0xd6, 0xde, 0x01, 0xfb,
+  0xfa, 0xe8, 0xe9, 0xf2, 0xf7, 0xe7, 0xff, 0x00, 0xf8, 0xf7, 0xfc, 0xfb,
+  0xf0, 0x0a, 0xf7, 0x02, 0x00, 0x14, 0x02, 0x0d, 0x00, 0x0e, 0xf9, 0xff,
+  0x00, 0x09, 0xf8, 0x01, 0xcf, 0xe6, 0x15, 0x11, 0xd8, 0xdf, 0x0b, 0xf1,
+  0xe8, 0xe0, 0x0f, 0xfc, 0xfa, 0xf7, 0xfb, 0xf7, 0x04, 0xe0, 0xf2, 0x06,
+  0x01, 0x0b, 0x08, 0xfa, 0xf0, 0x0b, 0xf7, 0x0d, 0x01, 0x19, 0x04, 0x15,
+  0x00, 0x05, 0xf7, 0xfe, 0x00, 0x05, 0x01, 0x06, 0xd8, 0x1e, 0x1f, 0x3f,
+  0xd8, 0x0d, 0xf3, 0x1b, 0x06, 0x0f, 0x2e, 0x1f, 0xf8, 0x17, 0xf8, 0x0d,
+  0xfd, 0x0b, 0xfe, 0x10, 0xff, 0x14, 0x09, 0x19, 0xfa, 0x18, 0xfe, 0x0e,
+  0x00, 0x1e, 0xf8, 0x22, 0x00, 0x0c, 0x06, 0x02, 0x00, 0x0a, 0x03, 0xfe,
+  0x10, 0x1b, 0x44, 0x36, 0xf9, 0x2b, 0xee, 0x15, 0x0f, 0x13, 0x0c, 0x05,
+  0xf8, 0x0d, 0x07, 0x01, 0xf7, 0xf9, 0xfe, 0xf6, 0xf6, 0x07, 0x02, 0x0a,
+  0x01, 0xfa, 0xff, 0xf2, 0x0d, 0x05, 0x04, 0x09, 0x00, 0x04, 0x01, 0xfa,
+  0x00, 0xfe, 0xf9, 0xfe, 0x24, 0x17, 0x25, 0x53, 0x06, 0x35, 0xea, 0x35,
+  0xf6, 0x13, 0xfb, 0x11, 0x11, 0x02, 0x21, 0x11, 0x02, 0x17, 0xff, 0x0e,
+  0xfc, 0x03, 0x07, 0x12, 0xfb, 0xfb, 0x00, 0xef, 0x03, 0xea, 0xff, 0x08,
+  0x01, 0xff, 0xfb, 0xf8, 0x00, 0xfb, 0xfe, 0x01, 0x16, 0x11, 0x25, 0x2e,
+  0x01, 0x1b, 0xfe, 0x0d, 0xeb, 0x06, 0xde, 0x14, 0x10, 0x12, 0x1e, 0x1c,
+  0xfc, 0x17, 0x07, 0x03, 0xf9, 0xe5, 0xf5, 0x0b, 0xfa, 0xf8, 0x04, 0xf6,
+  0x03, 0xd8, 0xf7, 0x03, 0x00, 0xf4, 0xf2, 0xf2, 0x00, 0xf3, 0xf0, 0xfa,
+  0x16, 0xe1, 0xf4, 0xf0, 0xee, 0x1b, 0x09, 0xfd, 0xe4, 0xe4, 0xed, 0x09,
+  0x06, 0x0c, 0x08, 0x0d, 0x10, 0x0b, 0xfd, 0x05, 0x04, 0xec, 0xf9, 0x0a,
+  0x01, 0xfe, 0xfd, 0xfb, 0x00, 0xfc, 0x06, 0x09, 0x00, 0x14, 0xf9, 0x02,
+  0x00, 0x04, 0xfd, 0xfe, 0x05, 0xd5, 0xd4, 0xe9, 0xf6, 0xe7, 0x0a, 0xf8,
+  0xf1, 0xd0, 0xd9, 0x09, 0x02, 0xec, 0xfd, 0xf5, 0x1b, 0xee, 0x0d, 0xf3,
+  0x07, 0xee, 0xf8, 0xff, 0x02, 0xf6, 0xff, 0x05, 0x00, 0xf5, 0xfc, 0x00,
+  0x00, 0x03, 0xff, 0x07, 0x01, 0x06, 0xfb, 0x00, 0xf1, 0xe9, 0xd9, 0xdf,
+  0xec, 0xee, 0xfb, 0xf9, 0xe5, 0xcf, 0xb8, 0xfb, 0x06, 0xe1, 0xee, 0xfc,
+  0x08, 0xfa, 0xf1, 0xf6, 0x02, 0xff, 0xfe, 0x05, 0x00, 0xfc, 0x0f, 0x03,
+  0x01, 0x08, 0xfd, 0x09, 0x01, 0x06, 0x05, 0x06, 0x00, 0x01, 0xf8, 0x01,
+  0xdd, 0xf7, 0xcf, 0xe2, 0xef, 0xd7, 0xf5, 0x00, 0xe9, 0xe5, 0xdc, 0x01,
+  0xf9, 0xec, 0xd1, 0x04, 0x04, 0xf2, 0xfa, 0xfb, 0x04, 0x00, 0xf4, 0xff,
+  0x00, 0x10, 0x04, 0x04, 0x00, 0x0a, 0x05, 0x05, 0x00, 0x00, 0xfe, 0xfc,
+  0x01, 0xfe, 0xfa, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x06, 0xee, 0xf7, 0x04, 0xe3, 0xfc,
+  0x01, 0xfa, 0xf8, 0xfc, 0xff, 0xfe, 0xff, 0xfa, 0x09, 0x0c, 0xfe, 0x07,
+  0x05, 0x21, 0x10, 0x06, 0x06, 0x18, 0xfe, 0x09, 0x02, 0x12, 0x12, 0x05,
+  0x00, 0x00, 0xf4, 0xfc, 0xff, 0x1a, 0x0c, 0x10, 0xfa, 0x01, 0x16, 0xff,
+  0xeb, 0xf5, 0xee, 0xfe, 0xed, 0xe6, 0xee, 0xe7, 0x02, 0xd5, 0xef, 0xea,
+  0x03, 0xe8, 0xf8, 0xed, 0x06, 0xf2, 0x09, 0xee, 0x06, 0x00, 0x00, 0xf7,
+  0x02, 0x08, 0x05, 0x05, 0x02, 0x08, 0x01, 0x01, 0x01, 0x0a, 0xff, 0xfd,
+  0xf5, 0xe3, 0x14, 0xf0, 0xe5, 0xe8, 0xfb, 0xfe, 0xe9, 0xe2, 0xf7, 0xe0,
+  0xfa, 0x08, 0xed, 0xe7, 0x01, 0x04, 0xf6, 0x08, 0x05, 0xff, 0x04, 0xed,
+  0x07, 0x0a, 0x02, 0xe8, 0x03, 0x13, 0x05, 0x02, 0x02, 0x16, 0x0e, 0x03,
+  0x01, 0x18, 0x0d, 0xfb, 0xf4, 0xda, 0x16, 0x0c, 0xee, 0x0d, 0x02, 0x0e,
+  0xe9, 0x0e, 0xfc, 0x00, 0xf6, 0x13, 0x03, 0x28, 0x00, 0x1c, 0x04, 0x1b,
+  0x01, 0x24, 0x07, 0x0e, 0x02, 0x14, 0x01, 0x1a, 0xfe, 0x21, 0x0c, 0x1a,
+  0x02, 0x1c, 0x00, 0x1e, 0x01, 0x23, 0x0f, 0x19, 0xfa, 0xdf, 0x24, 0xf2,
+  0xec, 0x0d, 0xe6, 0x0f, 0xf5, 0x33, 0x05, 0x2b, 0x02, 0x2b, 0x04, 0x00,
+  0x0a, 0x1a, 0xfa, 0x16, 0x08, 0x13, 0x1d, 0x04, 0xfd, 0x16, 0x05, 0x14,
+  0xfd, 0x30, 0x09, 0x1d, 0x03, 0x2b, 0x00, 0x0f, 0x02, 0x24, 0x0b, 0x0a,
+  0xfb, 0xfb, 0x30, 0xfc, 0xea, 0x05, 0xe7, 0x2d, 0x0b, 0x1b, 0xf5, 0x2c,
+  0x0a, 0x11, 0xfd, 0xfb, 0xf2, 0x06, 0xff, 0xef, 0x0b, 0x23, 0x0c, 0xfd,
+  0x04, 0x10, 0x04, 0xfe, 0xff, 0x2d, 0x03, 0x0b, 0x02, 0x33, 0x15, 0x04,
+  0x03, 0x1e, 0xfe, 0x1f, 0xfb, 0xff, 0x24, 0x1f, 0xde, 0x33, 0x17, 0x25,
+  0xf4, 0x2a, 0xf4, 0x49, 0xfe, 0x3d, 0x12, 0x1f, 0xf9, 0x33, 0x1a, 0x19,
+  0x14, 0x2b, 0x14, 0x19, 0x0c, 0x03, 0xfc, 0x16, 0x06, 0x30, 0x15, 0x1d,
+  0x04, 0x1d, 0x10, 0x0e, 0x05, 0x0c, 0x0b, 0x08, 0xff, 0x08, 0x36, 0x33,
+  0xe0, 0x22, 0xfe, 0x36, 0xe7, 0x1b, 0xdb, 0x23, 0xfc, 0x1b, 0x01, 0x18,
+  0xf9, 0x20, 0x11, 0xf8, 0x13, 0x27, 0x0d, 0x00, 0x05, 0xf9, 0x07, 0xed,
+  0xfd, 0x19, 0x0b, 0xf8, 0x05, 0x15, 0x12, 0x06, 0x03, 0x09, 0x16, 0x03,
+  0xf7, 0xe9, 0x36, 0x25, 0xec, 0x3f, 0xfa, 0x34, 0xd6, 0x1d, 0xda, 0x30,
+  0xf8, 0xff, 0x10, 0x06, 0x0d, 0x15, 0x08, 0x05, 0x0f, 0x27, 0x18, 0x06,
+  0xfc, 0x0b, 0x0b, 0x20, 0xf6, 0x01, 0xf6, 0xfb, 0x02, 0x15, 0x15, 0x20,
+  0x01, 0x08, 0x0e, 0x13, 0xdc, 0xfe, 0x1e, 0x27, 0xee, 0x0b, 0x00, 0x33,
+  0xd6, 0xf3, 0xda, 0x20, 0xed, 0x0d, 0xea, 0x02, 0x00, 0xff, 0xec, 0xfc,
+  0x03, 0x27, 0x16, 0x0a, 0x09, 0x0a, 0xf8, 0x18, 0x00, 0x0a, 0x03, 0xf8,
+  0x07, 0x0c, 0x0e, 0x17, 0x03, 0x16, 0x09, 0x0f, 0xd6, 0x12, 0x1a, 0x49,
+  0xf9, 0x15, 0x24, 0x1a, 0xe4, 0xe3, 0xaf, 0x0b, 0xd8, 0xfa, 0xd5, 0x19,
+  0xed, 0x0b, 0xf3, 0x16, 0x19, 0x09, 0xf8, 0x09, 0xfd, 0xf8, 0xf8, 0x02,
+  0x06, 0x15, 0xff, 0xec, 0x02, 0x16, 0x0b, 0xfd, 0x03, 0x14, 0x0a, 0xff,
+  0xcd, 0x01, 0x06, 0x44, 0x24, 0xf0, 0x07, 0x22, 0xed, 0xd1, 0xd2, 0xf6,
+  0xf5, 0xdc, 0xcc, 0xed, 0xfb, 0xeb, 0xd7, 0xec, 0x1b, 0xf6, 0xe9, 0xe9,
+  0xf6, 0xfc, 0x06, 0xf2, 0x14, 0xf3, 0x0d, 0xf4, 0x09, 0xf5, 0x01, 0xea,
+  0x04, 0x0e, 0xfc, 0x04, 0xf6, 0x0a, 0xef, 0x2b, 0x32, 0xe1, 0x17, 0x0a,
+  0x08, 0xb9, 0xf6, 0xe5, 0xed, 0xe0, 0xdf, 0x08, 0xfe, 0xdf, 0xe6, 0xf5,
+  0x13, 0xff, 0xed, 0xed, 0x1c, 0xdc, 0xf6, 0xf6, 0x12, 0xf2, 0x02, 0xee,
+  0x03, 0xfd, 0x00, 0xf8, 0x05, 0xfc, 0x05, 0x03, 0x16, 0x43, 0xe3, 0x21,
+  0x4c, 0xeb, 0x22, 0x08, 0x0f, 0xe0, 0x0d, 0xe6, 0x12, 0xe7, 0xf0, 0x09,
+  0x11, 0xfa, 0xe2, 0xf2, 0x12, 0xff, 0xf6, 0xe9, 0x15, 0xc2, 0xf8, 0xe8,
+  0x14, 0xf2, 0x0a, 0xef, 0x03, 0x02, 0x06, 0xfa, 0x03, 0xfe, 0xff, 0x06,
+  0x24, 0x1d, 0xd3, 0xfc, 0x4f, 0xf0, 0x20, 0x04, 0x06, 0xf5, 0x27, 0xde,
+  0x16, 0x01, 0x02, 0x14, 0xfc, 0xfd, 0xd5, 0xe4, 0x11, 0xd5, 0xf3, 0xea,
+  0x0a, 0xd9, 0xf8, 0xea, 0x18, 0xe3, 0xfa, 0xe1, 0x04, 0xf5, 0xf8, 0xee,
+  0x05, 0x0d, 0x13, 0x06, 0x3c, 0xf2, 0xbd, 0xe5, 0x49, 0xd9, 0x12, 0xfb,
+  0x22, 0xe8, 0x0d, 0xd8, 0x14, 0xf0, 0xee, 0x15, 0xeb, 0xca, 0xe5, 0xfa,
+  0x10, 0xe0, 0xf4, 0xe3, 0xff, 0xf6, 0xef, 0x08, 0x06, 0xfa, 0xe9, 0xee,
+  0x03, 0xf3, 0x02, 0xf4, 0x02, 0xfc, 0xf5, 0xfa, 0x30, 0xf9, 0xb6, 0xae,
+  0x17, 0xce, 0x15, 0xff, 0x18, 0xf3, 0xf5, 0xe9, 0x0a, 0x08, 0xf5, 0x03,
+  0xe3, 0xed, 0xef, 0xf7, 0x0b, 0xe6, 0xf4, 0xee, 0xf7, 0xf6, 0x0e, 0x01,
+  0x08, 0xfa, 0xf5, 0xf7, 0x07, 0xff, 0x01, 0xed, 0x01, 0x04, 0x03, 0x03,
+  0x22, 0xe2, 0x97, 0x96, 0xea, 0xd0, 0x0c, 0xfc, 0x01, 0xf7, 0x01, 0x10,
+  0x1d, 0xfc, 0xea, 0x17, 0x10, 0xfe, 0x0b, 0xf7, 0x16, 0x09, 0xf8, 0xf9,
+  0x14, 0x0e, 0x12, 0x01, 0x12, 0x0d, 0xfd, 0x0a, 0x06, 0x11, 0xfe, 0xf9,
+  0x05, 0x09, 0x05, 0x07, 0xff, 0xce, 0xa6, 0xa5, 0xe2, 0xbe, 0xe3, 0xf3,
+  0xef, 0xc9, 0xf8, 0xf9, 0x18, 0xf1, 0xdc, 0xfd, 0x08, 0xf1, 0x09, 0x0d,
+  0x07, 0xf5, 0xf8, 0xf3, 0x16, 0xf8, 0xfd, 0x0c, 0x0e, 0x1e, 0x05, 0x0e,
+  0x08, 0x0e, 0x00, 0xfd, 0x02, 0x09, 0xfd, 0x0a, 0xe5, 0xc3, 0xc2, 0xbd,
+  0xc4, 0xe8, 0xf0, 0x0d, 0xf4, 0xf6, 0xf7, 0x07, 0x10, 0x0d, 0xf9, 0x18,
+  0x03, 0x08, 0xfa, 0x14, 0xf8, 0x06, 0xec, 0x08, 0x07, 0x17, 0xf9, 0x17,
+  0x0b, 0x1e, 0x03, 0x18, 0x0b, 0x1a, 0xfb, 0x08, 0x0c, 0x12, 0x0d, 0x07,
+  0xcb, 0xe9, 0xc8, 0xc4, 0xd3, 0xfd, 0xc9, 0x0d, 0x02, 0xe7, 0xf9, 0xfa,
+  0x05, 0x0c, 0xf0, 0x0e, 0x01, 0x10, 0x01, 0x29, 0xfb, 0x20, 0x0c, 0x13,
+  0xf5, 0x29, 0x01, 0x13, 0x0c, 0x40, 0x03, 0x16, 0x0b, 0x15, 0xf9, 0x06,
+  0x03, 0x17, 0x05, 0x08, 0xc7, 0xe3, 0xe4, 0xe0, 0xd8, 0x13, 0xf4, 0x03,
+  0x03, 0xff, 0xf9, 0xf6, 0x01, 0x19, 0xeb, 0x13, 0xfc, 0x13, 0x09, 0x19,
+  0xfb, 0x20, 0x08, 0x14, 0xfc, 0x2d, 0x0e, 0x17, 0x05, 0x36, 0x05, 0x14,
+  0x0b, 0x18, 0x05, 0x01, 0x03, 0x14, 0xf4, 0x04, 0xbc, 0xe6, 0x16, 0xec,
+  0xe3, 0x0f, 0xfc, 0x0d, 0x05, 0x08, 0x04, 0x02, 0x02, 0x1f, 0x01, 0xff,
+  0x0d, 0x1c, 0x0b, 0x0c, 0x04, 0x2e, 0x05, 0x09, 0x07, 0x2a, 0x04, 0x14,
+  0x03, 0x23, 0xff, 0x10, 0x03, 0x1a, 0x04, 0x0d, 0x01, 0x11, 0x00, 0x03,
+  0xb8, 0x15, 0x23, 0xf0, 0xf7, 0x06, 0xf1, 0x04, 0x05, 0x11, 0x09, 0x0a,
+  0x00, 0x1d, 0x04, 0x00, 0x03, 0x19, 0x09, 0x12, 0xfe, 0x1c, 0x0d, 0x05,
+  0x09, 0x20, 0xf7, 0x16, 0x02, 0x1e, 0x0a, 0x1b, 0x03, 0x11, 0xff, 0x04,
+  0x01, 0x0c, 0x0e, 0x01, 0xd1, 0x00, 0xbd, 0x11, 0xf3, 0x05, 0xec, 0x12,
+  0xfc, 0xf4, 0x09, 0x08, 0x00, 0xfd, 0x08, 0xf9, 0x00, 0xf8, 0xfe, 0xfe,
+  0x00, 0xfa, 0xf6, 0x04, 0x00, 0xfc, 0x0e, 0xff, 0x00, 0xfd, 0xfe, 0x00,
+  0x00, 0xfd, 0xff, 0x05, 0x00, 0x01, 0xff, 0x00, 0xec, 0xf5, 0xf1, 0xf0,
+  0xf2, 0xfb, 0xeb, 0xf1, 0xfa, 0xf6, 0x03, 0xfb, 0x00, 0xfe, 0xff, 0xf8,
+  0xff, 0xf7, 0xfc, 0xf9, 0x00, 0xf5, 0xf6, 0x00, 0x00, 0xfe, 0xfd, 0xfd,
+  0x00, 0xfc, 0x0a, 0xfe, 0x00, 0x01, 0x01, 0x04, 0x00, 0xfc, 0xfc, 0x01,
+  0xe6, 0xf8, 0xf5, 0xe8, 0xdb, 0xfe, 0xd6, 0xe9, 0xf5, 0xf8, 0x02, 0x07,
+  0x00, 0xe8, 0x01, 0xec, 0x00, 0xf6, 0xfc, 0xf5, 0x00, 0xff, 0xf8, 0x0c,
+  0x00, 0xfb, 0xfd, 0x09, 0x00, 0x02, 0x02, 0x04, 0x00, 0x06, 0xfb, 0x04,
+  0x00, 0x03, 0x00, 0xfc, 0xf2, 0xe9, 0x05, 0xe5, 0xd5, 0x16, 0xa6, 0xe9,
+  0xfd, 0xd6, 0xdd, 0xfe, 0xfe, 0xec, 0xf9, 0xee, 0xff, 0xe6, 0xfd, 0xf0,
+  0xff, 0xf1, 0x02, 0xf8, 0x00, 0xf3, 0x08, 0xf1, 0x00, 0xfe, 0xfe, 0xf6,
+  0x00, 0xfa, 0xf4, 0xf5, 0x00, 0xfb, 0xfe, 0xfc, 0xf9, 0xb8, 0xfc, 0xdf,
+  0xf6, 0x34, 0xf0, 0xc6, 0xe6, 0xde, 0xbc, 0xe9, 0xf6, 0xff, 0xf8, 0xea,
+  0x00, 0xdf, 0x07, 0xe5, 0x01, 0xee, 0xef, 0x04, 0x00, 0xd5, 0xfc, 0xef,
+  0x00, 0xf0, 0xf4, 0xed, 0x00, 0xe8, 0xf7, 0xf6, 0x00, 0xf2, 0xf9, 0xf6,
+  0x1e, 0x86, 0x05, 0xb6, 0x09, 0x2d, 0x3d, 0xd3, 0xde, 0x0e, 0xdd, 0xed,
+  0xf2, 0xeb, 0x04, 0xfa, 0xfd, 0xe3, 0x01, 0x05, 0x01, 0xed, 0xf7, 0x0b,
+  0xff, 0xdb, 0xec, 0xef, 0x00, 0xf0, 0xf2, 0x02, 0x00, 0xe7, 0xf8, 0xfd,
+  0x00, 0xee, 0xf3, 0xeb, 0x12, 0xa3, 0xf2, 0xa1, 0x10, 0x07, 0x41, 0xce,
+  0xfa, 0x2c, 0xe0, 0xcd, 0xf4, 0xee, 0xf0, 0xf8, 0xf8, 0xff, 0x0e, 0xf0,
+  0x05, 0x0a, 0x02, 0x11, 0xfc, 0x12, 0x0e, 0x05, 0x00, 0x04, 0xfc, 0xf5,
+  0x00, 0xfe, 0xf7, 0xfc, 0x00, 0xfd, 0xf6, 0xf9, 0x16, 0xa9, 0xe8, 0xb0,
+  0x2d, 0xff, 0x3c, 0xd6, 0xf9, 0x12, 0x13, 0xe3, 0x00, 0xd8, 0x06, 0x0a,
+  0x0c, 0xfd, 0x13, 0x18, 0x07, 0x0b, 0x06, 0x0d, 0x08, 0x15, 0x01, 0x22,
+  0x07, 0x02, 0xf6, 0xfa, 0x00, 0xf3, 0x04, 0x00, 0x00, 0xfc, 0xf8, 0xff,
+  0x2e, 0xea, 0xd0, 0xd5, 0x3d, 0x04, 0x52, 0xd3, 0x25, 0x05, 0x1c, 0xd9,
+  0x16, 0xda, 0xf4, 0x07, 0xfa, 0xf4, 0xfe, 0x03, 0xfe, 0xd5, 0xee, 0xe3,
+  0x0c, 0xfd, 0x05, 0xf4, 0x0d, 0x0c, 0x10, 0x19, 0x00, 0x10, 0xf4, 0x04,
+  0x00, 0x0b, 0x09, 0xfb, 0x1f, 0xf7, 0xd3, 0xc3, 0x51, 0xe3, 0x39, 0xeb,
+  0x51, 0x14, 0x27, 0xd8, 0x0e, 0xd3, 0xe7, 0x04, 0xfb, 0xf3, 0x03, 0xff,
+  0x07, 0xcf, 0xfb, 0xe7, 0x01, 0x1f, 0x01, 0x12, 0x04, 0x08, 0xf5, 0x23,
+  0xfa, 0x13, 0xf9, 0xf9, 0x02, 0xf9, 0x1d, 0xf9, 0x08, 0x16, 0xe0, 0xc8,
+  0x54, 0xe2, 0x44, 0xe6, 0x34, 0x05, 0x2c, 0xde, 0x13, 0xc9, 0xff, 0xf5,
+  0x05, 0xe9, 0x12, 0x00, 0xe3, 0xeb, 0xf1, 0xe2, 0x0e, 0x20, 0xf6, 0x06,
+  0xff, 0xf5, 0x02, 0x18, 0x00, 0x07, 0x00, 0x0b, 0x0a, 0x10, 0x0b, 0x05,
+  0xfe, 0x36, 0x00, 0x0f, 0x34, 0xde, 0x0d, 0xe0, 0x4f, 0x22, 0x56, 0xe1,
+  0x0a, 0xf9, 0x11, 0xff, 0xff, 0x05, 0x0e, 0x05, 0xe5, 0x03, 0x0c, 0xeb,
+  0x13, 0x0f, 0x00, 0x12, 0xf3, 0xff, 0xee, 0x18, 0xf6, 0x07, 0x06, 0x12,
+  0xff, 0xf8, 0x0c, 0xfc, 0x09, 0x2a, 0x04, 0x15, 0x17, 0x05, 0xd7, 0xf2,
+  0x4b, 0xfa, 0x54, 0x02, 0x20, 0xfd, 0x00, 0xe6, 0x08, 0xde, 0x14, 0xe6,
+  0xea, 0x05, 0xf1, 0xf1, 0xf6, 0xf3, 0xee, 0xfa, 0xf2, 0xee, 0xf6, 0x15,
+  0xfd, 0x04, 0xf5, 0x05, 0xff, 0x18, 0x07, 0xff, 0x09, 0x34, 0x15, 0x23,
+  0x15, 0x24, 0xd8, 0xfd, 0x12, 0x14, 0x36, 0x0f, 0xfd, 0x0d, 0x19, 0xe0,
+  0xed, 0xf3, 0x07, 0xeb, 0xf4, 0xe6, 0x03, 0xe6, 0xf6, 0x06, 0xfe, 0xf4,
+  0xef, 0x00, 0xf3, 0x16, 0x00, 0x00, 0xf2, 0x11, 0xff, 0xfe, 0x0f, 0xf7,
+  0xfa, 0x13, 0x3d, 0x3f, 0xf8, 0x1c, 0xdc, 0x00, 0xfd, 0x0c, 0x0b, 0x02,
+  0xf3, 0xf3, 0x2d, 0xd6, 0xef, 0x09, 0x28, 0xf6, 0xf0, 0x1a, 0xef, 0xeb,
+  0xfe, 0xfc, 0xf5, 0xfa, 0xee, 0x05, 0x08, 0x12, 0xff, 0xf9, 0x04, 0x0b,
+  0xff, 0xed, 0x04, 0xfd, 0xff, 0x08, 0x3b, 0x3d, 0xd3, 0x21, 0xd9, 0xfd,
+  0xbb, 0x30, 0x0a, 0x13, 0x09, 0x26, 0x30, 0xf1, 0x0c, 0x13, 0x1b, 0xdf,
+  0xf2, 0x10, 0xfd, 0xfa, 0x0a, 0xff, 0xfc, 0x00, 0xfd, 0xde, 0x04, 0xf9,
+  0x00, 0xf1, 0x0c, 0x01, 0x00, 0xf1, 0x0a, 0xf8, 0x06, 0xf6, 0x3a, 0x34,
+  0xc0, 0x12, 0xe6, 0xff, 0xcd, 0x2e, 0xf6, 0x0f, 0x0b, 0x26, 0x17, 0xe9,
+  0x18, 0x13, 0x19, 0xf7, 0xfd, 0x1b, 0x0d, 0xf9, 0x08, 0x03, 0x0a, 0xf7,
+  0xff, 0xea, 0xf8, 0xf8, 0x00, 0xe6, 0x03, 0x00, 0x00, 0xe2, 0xfa, 0xfe,
+  0x13, 0x0f, 0x36, 0x2e, 0xc3, 0x0a, 0xda, 0xf3, 0xd0, 0x21, 0xd9, 0x03,
+  0xfc, 0x37, 0x37, 0x02, 0x0f, 0x17, 0x2b, 0xfd, 0x01, 0x12, 0x08, 0xfe,
+  0x04, 0x0b, 0x04, 0xfe, 0xf8, 0xee, 0x06, 0xff, 0x00, 0xf4, 0x03, 0xfc,
+  0x00, 0xf3, 0xfd, 0xfc, 0x25, 0x0d, 0x12, 0x13, 0xce, 0xe7, 0xda, 0xf7,
+  0xe9, 0x07, 0xd0, 0x1f, 0x02, 0x12, 0x13, 0x04, 0x02, 0x14, 0x21, 0xec,
+  0x10, 0x1a, 0x10, 0x18, 0x11, 0xfe, 0x0a, 0xf2, 0xfa, 0xd8, 0x0b, 0xef,
+  0xff, 0xde, 0xfb, 0xf3, 0x00, 0xe6, 0xfd, 0xf8, 0x11, 0xfe, 0xeb, 0xfd,
+  0xe6, 0xc9, 0xfd, 0xec, 0xf4, 0xff, 0xd1, 0x10, 0x06, 0xe9, 0x11, 0xfa,
+  0x03, 0xf9, 0x26, 0xe3, 0x03, 0xf5, 0xf8, 0xf7, 0x11, 0xf4, 0x11, 0xf8,
+  0xfa, 0xee, 0x04, 0xef, 0x00, 0xea, 0x03, 0x03, 0x00, 0xf6, 0x01, 0x01,
+  0x02, 0xe7, 0xe6, 0xe4, 0xe1, 0xc0, 0x0d, 0x01, 0xf8, 0xf5, 0xd8, 0x09,
+  0x05, 0xde, 0xff, 0xfd, 0xfa, 0xf7, 0xf6, 0xef, 0x09, 0xe6, 0x00, 0xf6,
+  0x1a, 0xe9, 0x08, 0xf9, 0xfb, 0xe3, 0x03, 0xf5, 0x00, 0xf4, 0xfd, 0xfd,
+  0x00, 0xf9, 0xfc, 0xff, 0x09, 0x07, 0xde, 0xf4, 0xe2, 0xd0, 0x07, 0xf7,
+  0xf9, 0xf2, 0xed, 0x04, 0xff, 0xf9, 0xec, 0x10, 0x04, 0x07, 0xf0, 0xe5,
+  0x0b, 0xe3, 0xfb, 0xf9, 0x10, 0xf6, 0xfa, 0xfc, 0x00, 0xec, 0x04, 0xf3,
+  0x00, 0xf5, 0x00, 0xfe, 0x00, 0xfe, 0x0e, 0x00, 0x03, 0xf0, 0xcf, 0xf2,
+  0xda, 0xdc, 0x08, 0xf8, 0xf9, 0xe3, 0xfb, 0x09, 0x01, 0xff, 0xfb, 0x16,
+  0x08, 0xf9, 0xec, 0xfd, 0x10, 0xed, 0xf8, 0x02, 0x00, 0xf4, 0xfe, 0xfb,
+  0x00, 0xf3, 0x09, 0xf0, 0x00, 0xf1, 0xfd, 0xf4, 0x00, 0xf6, 0x00, 0xfe,
+  0xf2, 0xfa, 0xe0, 0x06, 0xe8, 0xe4, 0xf5, 0x07, 0x00, 0xf5, 0xf8, 0xf8,
+  0x07, 0xfc, 0xf4, 0x11, 0x02, 0x01, 0x06, 0xf5, 0x0a, 0xe9, 0xf6, 0xf5,
+  0x00, 0xf4, 0x06, 0xf9, 0x00, 0xf5, 0x01, 0xee, 0x00, 0xf2, 0x01, 0xf8,
+  0xff, 0xf8, 0xfb, 0x00, 0xd1, 0xea, 0xf8, 0xea, 0xe4, 0xff, 0xd9, 0xdd,
+  0xfd, 0xe3, 0xdc, 0x10, 0x00, 0xfb, 0xfc, 0x02, 0x00, 0x07, 0xfa, 0xfd,
+  0x00, 0xdd, 0xf8, 0xee, 0xfd, 0xea, 0xf6, 0xde, 0xff, 0xf2, 0xfc, 0x00,
+  0x00, 0xf1, 0xfc, 0xea, 0x00, 0xf5, 0xfd, 0xfd, 0x05, 0xdb, 0x11, 0xe6,
+  0xc3, 0xee, 0xd7, 0xbd, 0xf3, 0xd5, 0xd5, 0x01, 0xf6, 0xf4, 0xf8, 0x00,
+  0x01, 0xed, 0xfd, 0xff, 0xff, 0xe4, 0xfe, 0x03, 0xfc, 0xf7, 0xef, 0xfb,
+  0xff, 0xf8, 0xf9, 0xf2, 0x00, 0xef, 0xfd, 0xf5, 0x00, 0xf8, 0xfd, 0x00,
+  0x34, 0xe1, 0x18, 0x04, 0xe9, 0x23, 0x0c, 0xe0, 0xe3, 0x03, 0xd5, 0x09,
+  0xf7, 0xf2, 0x0c, 0xed, 0x00, 0xeb, 0x0e, 0xee, 0xff, 0xf1, 0xf2, 0x0e,
+  0xff, 0xec, 0xf5, 0x06, 0x00, 0xf2, 0xea, 0xf8, 0x00, 0xeb, 0xfd, 0xee,
+  0x00, 0xfc, 0xff, 0xf5, 0x2a, 0xd4, 0xf7, 0xd5, 0xff, 0x0c, 0x5c, 0xdd,
+  0xdb, 0x2a, 0xe8, 0x0b, 0xf4, 0xf9, 0x0a, 0xef, 0xf8, 0x06, 0x0c, 0x0d,
+  0xfc, 0xfa, 0xef, 0xf7, 0x04, 0xef, 0xf8, 0xfb, 0x03, 0xe5, 0xec, 0xe5,
+  0x00, 0xe8, 0x00, 0xe3, 0x00, 0xdd, 0xfb, 0xef, 0x03, 0xdf, 0x04, 0xd7,
+  0x10, 0xee, 0x61, 0xfd, 0xee, 0x2e, 0x0a, 0xf6, 0xf9, 0x19, 0xf2, 0x04,
+  0xf4, 0x0b, 0x33, 0xf9, 0xf1, 0x03, 0xf6, 0x08, 0x05, 0x07, 0xfd, 0xf0,
+  0x06, 0xfb, 0xf7, 0xf9, 0x00, 0xf7, 0xfc, 0x00, 0x00, 0xed, 0x0a, 0xfb,
+  0x08, 0x26, 0xe7, 0xfa, 0x11, 0xd6, 0x41, 0x03, 0x1b, 0x1f, 0x29, 0x01,
+  0x10, 0x0c, 0xe2, 0x1a, 0x03, 0xf0, 0x09, 0x24, 0xf8, 0xee, 0x00, 0x02,
+  0x07, 0x14, 0x04, 0x04, 0x06, 0xf2, 0x0c, 0xfd, 0x00, 0xf5, 0xf0, 0x06,
+  0x00, 0xf8, 0xff, 0xfd, 0xfd, 0x3d, 0xcc, 0xef, 0x20, 0xbc, 0x16, 0xe2,
+  0x29, 0x07, 0x32, 0xf8, 0x1b, 0xe6, 0x05, 0x02, 0xf7, 0xe1, 0xf0, 0xfd,
+  0xf7, 0xde, 0x04, 0xf0, 0x08, 0x10, 0xf4, 0xfe, 0x01, 0xe4, 0xfb, 0xf9,
+  0x00, 0xf3, 0xfb, 0xff, 0x00, 0x0d, 0xfa, 0xff, 0xf4, 0x48, 0xf7, 0x19,
+  0x28, 0xe2, 0xe0, 0xfe, 0x2b, 0xf6, 0x37, 0xf5, 0xee, 0xdd, 0xe6, 0xee,
+  0xff, 0xba, 0xdf, 0xe7, 0x00, 0xde, 0xf5, 0x01, 0x0d, 0xe9, 0xf5, 0xfe,
+  0xfe, 0xe8, 0x02, 0xfa, 0xff, 0xef, 0xf7, 0xfe, 0x00, 0xf7, 0xfa, 0xff,
+  0xf9, 0x33, 0x0b, 0x2b, 0x17, 0x08, 0xc3, 0xe6, 0x0a, 0xfa, 0x2d, 0xfe,
+  0xd3, 0xe2, 0xf9, 0xe4, 0xf0, 0xe6, 0xd3, 0xf8, 0x01, 0xf9, 0x0d, 0xfb,
+  0x02, 0xee, 0xf0, 0xf4, 0xff, 0xfc, 0xfc, 0x11, 0x00, 0xfe, 0xff, 0x1b,
+  0x00, 0x15, 0xf4, 0x10, 0xdd, 0x26, 0x30, 0x3f, 0xe0, 0x3f, 0xdd, 0x10,
+  0xc4, 0x18, 0x0a, 0x1a, 0xf6, 0x0c, 0x1a, 0xd8, 0xf3, 0x0d, 0x03, 0xf5,
+  0xfb, 0x11, 0xff, 0x00, 0x00, 0x0c, 0x08, 0xec, 0xff, 0x05, 0xfd, 0xf4,
+  0x00, 0x02, 0x09, 0x03, 0x00, 0x13, 0xfd, 0x03, 0xe7, 0xf3, 0x25, 0x33,
+  0xe2, 0x31, 0xe8, 0x15, 0xd2, 0x15, 0x0c, 0x0f, 0xf9, 0x2b, 0x25, 0xe5,
+  0x09, 0x2a, 0xf6, 0xf8, 0x00, 0x07, 0x13, 0x03, 0x05, 0xf2, 0x07, 0xf2,
+  0xff, 0x04, 0x0c, 0xf8, 0xff, 0xed, 0xfa, 0xfa, 0xfe, 0xf3, 0x03, 0xfb,
+  0xf6, 0x05, 0x27, 0x25, 0xba, 0x06, 0xec, 0xee, 0xd1, 0x13, 0xfe, 0x14,
+  0x00, 0x04, 0x27, 0xd5, 0x06, 0x19, 0xf8, 0xeb, 0x0c, 0x1f, 0x12, 0xfc,
+  0x10, 0xfc, 0x0a, 0xed, 0x01, 0xf2, 0xef, 0xec, 0xff, 0xf0, 0x08, 0x03,
+  0xff, 0xfd, 0x07, 0x00, 0x0c, 0xf1, 0xf0, 0xf8, 0xe6, 0xf1, 0xed, 0xe7,
+  0xef, 0xf7, 0xf2, 0x02, 0x0d, 0xfd, 0x0b, 0xc8, 0x10, 0x19, 0x10, 0xdf,
+  0x0d, 0xfa, 0xff, 0xeb, 0x11, 0x04, 0x09, 0xe4, 0x01, 0xeb, 0x06, 0xf3,
+  0x00, 0xff, 0x07, 0xff, 0x00, 0xfc, 0xf8, 0x00, 0x16, 0xd1, 0xec, 0xe7,
+  0xe7, 0x06, 0xcd, 0xeb, 0xea, 0xe3, 0xc3, 0xe8, 0x00, 0xd9, 0xf0, 0xdd,
+  0x01, 0xff, 0xf0, 0x08, 0x0d, 0xda, 0xfd, 0xe1, 0x09, 0xee, 0x0d, 0xe6,
+  0x00, 0xf4, 0xf5, 0xf1, 0x00, 0xf3, 0xfa, 0x03, 0x00, 0x02, 0x09, 0xf9,
+  0x0a, 0xeb, 0xf5, 0xd8, 0xe0, 0x13, 0xea, 0xe5, 0xe1, 0x00, 0xca, 0xeb,
+  0x0e, 0xf3, 0xfc, 0xe1, 0x0a, 0xdb, 0xec, 0xfa, 0xfe, 0xe7, 0x04, 0xfd,
+  0x01, 0xeb, 0x02, 0xfb, 0xff, 0xef, 0x02, 0xf8, 0x00, 0xed, 0xfa, 0xf9,
+  0xff, 0xf0, 0x02, 0xfd, 0x14, 0xd4, 0xe1, 0xd0, 0x17, 0x17, 0x1f, 0xfd,
+  0xe1, 0x17, 0xe3, 0xf8, 0x0f, 0xfc, 0xfe, 0xee, 0x02, 0x01, 0x0e, 0xf6,
+  0x07, 0xe6, 0x06, 0xf1, 0xfb, 0xf5, 0xfe, 0xfb, 0x04, 0x04, 0xef, 0x02,
+  0xff, 0x07, 0x04, 0x05, 0x00, 0x0a, 0xed, 0xfe, 0x0a, 0xc1, 0xd2, 0xc1,
+  0xf7, 0x0f, 0x2f, 0x00, 0x06, 0x17, 0xfd, 0x10, 0x00, 0xff, 0xff, 0x04,
+  0x01, 0x08, 0x09, 0xeb, 0x04, 0xe9, 0x06, 0xe9, 0xfa, 0xfe, 0x03, 0x03,
+  0xf9, 0xf7, 0xfb, 0xf1, 0xfc, 0xf5, 0x12, 0xfc, 0x00, 0x0c, 0xef, 0x03,
+  0x0d, 0xb3, 0xda, 0xc8, 0x14, 0x08, 0x27, 0xf5, 0xf3, 0xf9, 0x0e, 0x06,
+  0x08, 0x08, 0x0b, 0xee, 0x11, 0x1b, 0x0d, 0x1a, 0x05, 0x01, 0xff, 0xf9,
+  0xfa, 0x0b, 0x01, 0x0c, 0xf4, 0x0d, 0xf7, 0xf0, 0xf7, 0xfe, 0xfd, 0x0b,
+  0x00, 0x0c, 0xf3, 0x08, 0x10, 0xe8, 0xe4, 0xc5, 0x1b, 0xc6, 0x31, 0xd3,
+  0x1b, 0xf9, 0x1d, 0xfa, 0x05, 0xf9, 0x0f, 0xfd, 0x0e, 0x02, 0x09, 0xfc,
+  0x0d, 0x06, 0x09, 0xe7, 0xfc, 0x0b, 0xfb, 0x0d, 0x0a, 0x1c, 0xff, 0xef,
+  0x00, 0x15, 0x0b, 0x0e, 0xfd, 0x1a, 0xfe, 0x05, 0x19, 0x0a, 0xcc, 0xd6,
+  0x3b, 0xf4, 0x29, 0xf5, 0x39, 0x1f, 0x0c, 0x0b, 0x0c, 0xe0, 0xf6, 0xe3,
+  0x12, 0xf7, 0xfe, 0x02, 0x14, 0x19, 0x0b, 0xe4, 0x09, 0xf0, 0xef, 0xfd,
+  0xfc, 0x12, 0xef, 0xf2, 0x00, 0x0c, 0x14, 0x15, 0xff, 0x17, 0x03, 0x04,
+  0xe6, 0x05, 0xc6, 0xeb, 0x4e, 0xd8, 0x0b, 0x01, 0x34, 0x06, 0x1d, 0xed,
+  0x10, 0xda, 0x0a, 0xe9, 0x02, 0xe6, 0x07, 0xfc, 0x00, 0x0b, 0x04, 0xf3,
+  0x02, 0xf3, 0xf1, 0xff, 0xff, 0x07, 0xf7, 0xff, 0x00, 0x08, 0x06, 0x12,
+  0x00, 0xfc, 0x06, 0x00, 0xf1, 0x17, 0x18, 0x20, 0x2b, 0x04, 0xf2, 0xf2,
+  0x3f, 0xf9, 0x1c, 0xee, 0x0c, 0xff, 0x00, 0xf0, 0x01, 0xfc, 0xfd, 0x0b,
+  0xff, 0x0e, 0x09, 0xfa, 0xfd, 0x08, 0xf3, 0xfb, 0xff, 0x10, 0x02, 0x13,
+  0x00, 0x08, 0x06, 0x02, 0xfe, 0x00, 0x17, 0xfd, 0xf3, 0x2e, 0x31, 0x26,
+  0x19, 0x16, 0xc8, 0xf2, 0x38, 0x17, 0x23, 0x01, 0x05, 0x0a, 0x10, 0xea,
+  0xff, 0x07, 0xf7, 0x0d, 0x04, 0x07, 0x03, 0xfd, 0x02, 0xf9, 0xed, 0xf9,
+  0xff, 0x00, 0x01, 0x05, 0x0c, 0x02, 0x0a, 0x03, 0x00, 0x00, 0x0b, 0xfe,
+  0xf0, 0x19, 0x29, 0x1e, 0xe2, 0xf8, 0xde, 0xf8, 0x24, 0xfc, 0x14, 0x0b,
+  0x18, 0x08, 0x24, 0xff, 0xfd, 0x0e, 0x09, 0x04, 0x00, 0xff, 0xf8, 0x15,
+  0x00, 0x0a, 0x06, 0xfb, 0x00, 0x07, 0xef, 0xf8, 0x00, 0x12, 0xff, 0x0b,
+  0xff, 0x16, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfc, 0x0d, 0x0c, 0x1b, 0x05, 0x16, 0xfc, 0x01,
+  0x02, 0xef, 0x0b, 0xf6, 0x01, 0x06, 0x05, 0x00, 0xfe, 0x06, 0xf7, 0xfc,
+  0x01, 0xfd, 0xfb, 0xf8, 0x01, 0xfc, 0x03, 0x05, 0x00, 0xf7, 0x05, 0xf7,
+  0xfc, 0xf0, 0xf2, 0xf9, 0xf4, 0x0b, 0x00, 0x05, 0xfd, 0xf7, 0x05, 0x18,
+  0x16, 0x1b, 0x08, 0x01, 0x01, 0xfc, 0x07, 0xf5, 0x03, 0x06, 0x05, 0x0c,
+  0x03, 0xf5, 0x06, 0xfd, 0x01, 0xf5, 0xfd, 0xfd, 0x01, 0xfe, 0x06, 0x07,
+  0x00, 0x0e, 0x06, 0x05, 0x00, 0x0e, 0x01, 0x09, 0x00, 0x07, 0xfd, 0x02,
+  0x0c, 0xf1, 0x02, 0x0b, 0x0b, 0x10, 0x01, 0xfb, 0xf9, 0xfb, 0x15, 0xf7,
+  0x01, 0xf8, 0x0c, 0xf9, 0x06, 0xfe, 0xfd, 0x03, 0x02, 0x01, 0x0c, 0xf9,
+  0xfe, 0x01, 0x06, 0x01, 0x01, 0x01, 0x03, 0xff, 0x00, 0x07, 0x08, 0x04,
+  0x00, 0x07, 0x01, 0xfd, 0x0f, 0xf5, 0x0f, 0x04, 0x09, 0x09, 0x00, 0xfc,
+  0xf0, 0x07, 0x07, 0xee, 0x06, 0x08, 0x0e, 0x15, 0x02, 0x06, 0x0d, 0x04,
+  0xff, 0x15, 0x08, 0x0a, 0x01, 0xf1, 0x04, 0x06, 0x00, 0xf7, 0x07, 0x0d,
+  0x00, 0xfa, 0x04, 0x03, 0x00, 0x00, 0xf9, 0x0b, 0x17, 0xf0, 0x00, 0x01,
+  0xf9, 0xfc, 0x07, 0xf8, 0xfe, 0xf8, 0xfe, 0xec, 0x04, 0x01, 0xfe, 0xfd,
+  0x05, 0xf2, 0xfd, 0xfe, 0xfe, 0xf9, 0x0e, 0xf0, 0xfb, 0xf8, 0x04, 0xfd,
+  0x00, 0xfc, 0xfe, 0x01, 0x00, 0xfc, 0x06, 0xff, 0x00, 0xfc, 0x01, 0x02,
+  0xfd, 0xdb, 0xe0, 0xeb, 0x04, 0xfa, 0x0f, 0xf8, 0xe9, 0xf1, 0xf7, 0xf9,
+  0x02, 0xfb, 0x00, 0xfd, 0xfc, 0xec, 0xf5, 0xf8, 0x04, 0xed, 0x01, 0xf7,
+  0x00, 0xf8, 0x00, 0xfe, 0x00, 0xff, 0x02, 0x07, 0x00, 0xfa, 0x0e, 0xfc,
+  0x00, 0x01, 0xf9, 0xff, 0xf9, 0xe7, 0xe7, 0xef, 0xed, 0xe0, 0xf3, 0xfb,
+  0xf2, 0xe3, 0xff, 0xef, 0x00, 0xe7, 0xf8, 0x04, 0xf9, 0x01, 0xfe, 0xfd,
+  0x01, 0xf2, 0x03, 0xfb, 0xf8, 0xf8, 0xfd, 0x04, 0xff, 0xfa, 0xff, 0x08,
+  0x01, 0xf4, 0x03, 0xfc, 0x00, 0xfd, 0xf9, 0xfa, 0xf3, 0xda, 0xf6, 0xf0,
+  0xe5, 0xeb, 0x03, 0xf8, 0xfd, 0xf3, 0xf7, 0xf3, 0x06, 0xf5, 0xf9, 0x05,
+  0xf4, 0x0e, 0xf3, 0xfc, 0xf8, 0xfa, 0x01, 0xff, 0xf8, 0x0e, 0xfe, 0x02,
+  0x01, 0x10, 0xff, 0x0a, 0x01, 0xff, 0x0d, 0x02, 0x00, 0x01, 0xfb, 0xf9,
+  0xd5, 0xe4, 0xdd, 0xee, 0xdf, 0xe6, 0xf0, 0xfe, 0xe7, 0xf5, 0xf5, 0x04,
+  0x04, 0xf4, 0xf8, 0xf0, 0x00, 0xff, 0xfa, 0xf8, 0x01, 0x00, 0xf5, 0x02,
+  0x01, 0x02, 0x00, 0x02, 0x00, 0x0a, 0xfc, 0x06, 0x00, 0x09, 0x01, 0x0c,
+  0xff, 0x00, 0x00, 0x00, 0xd7, 0xeb, 0xf1, 0xed, 0xcf, 0xf1, 0xfd, 0xfe,
+  0xf9, 0xf7, 0x01, 0x00, 0x05, 0xf4, 0x00, 0xfb, 0xfa, 0xfd, 0xf5, 0x04,
+  0xf9, 0x07, 0xf7, 0xff, 0x01, 0x0d, 0xfd, 0x07, 0x01, 0x0b, 0xf9, 0x03,
+  0x01, 0x0c, 0xfe, 0x05, 0x01, 0x05, 0x09, 0x01, 0xdf, 0xde, 0xf4, 0xe9,
+  0xd7, 0xea, 0xfa, 0x0a, 0xf4, 0xf4, 0xf7, 0x11, 0xff, 0xe6, 0xfd, 0xf7,
+  0xfb, 0xf3, 0xfa, 0x0b, 0x01, 0xf7, 0x05, 0xfb, 0x02, 0x07, 0xfd, 0x07,
+  0x01, 0xff, 0x00, 0x02, 0x00, 0x0b, 0xff, 0x08, 0x01, 0x00, 0x09, 0xff,
+  0xcf, 0xe1, 0xf4, 0xfe, 0xe6, 0xfc, 0x02, 0x08, 0xe8, 0xef, 0x08, 0x01,
+  0xfd, 0xef, 0xfe, 0xf2, 0x05, 0x04, 0xfe, 0x06, 0x09, 0x0d, 0x06, 0x0d,
+  0x01, 0x1f, 0xfd, 0x09, 0x01, 0x12, 0x02, 0x04, 0x00, 0x11, 0x03, 0x0b,
+  0x00, 0x00, 0x07, 0xfa, 0xe3, 0xf2, 0xfc, 0xfd, 0xe2, 0x02, 0x07, 0x19,
+  0xf6, 0xe6, 0x03, 0xf9, 0x06, 0xfc, 0xef, 0x05, 0x05, 0xfb, 0xfe, 0x02,
+  0x0b, 0xfe, 0xf7, 0xfd, 0x01, 0x16, 0x06, 0x05, 0x00, 0x0f, 0x03, 0x0b,
+  0x00, 0x09, 0xfe, 0x05, 0x00, 0x04, 0x10, 0x01, 0x00, 0x05, 0x19, 0x0b,
+  0xfa, 0x18, 0xf6, 0x1f, 0x04, 0x02, 0x17, 0x09, 0x05, 0x05, 0x02, 0xef,
+  0x0a, 0xfa, 0xf8, 0x09, 0x03, 0xfd, 0xef, 0xf6, 0x01, 0x03, 0xfc, 0xfb,
+  0x00, 0x04, 0x03, 0x0d, 0x00, 0x00, 0x01, 0x09, 0x00, 0x03, 0x03, 0x01,
+  0x0e, 0x12, 0x2e, 0x23, 0x06, 0x16, 0xfa, 0x0c, 0xf8, 0x03, 0x1f, 0x0d,
+  0x06, 0x2c, 0x1c, 0x0d, 0x06, 0x0b, 0x07, 0xff, 0xff, 0x0d, 0xfc, 0x0b,
+  0xfe, 0xfa, 0xfd, 0xfb, 0x00, 0x09, 0xff, 0x06, 0x00, 0x04, 0xfe, 0xfb,
+  0x00, 0x04, 0x07, 0x02, 0x1f, 0x03, 0x29, 0x19, 0x06, 0x07, 0xf5, 0x05,
+  0x06, 0x06, 0xfa, 0x0e, 0x12, 0x12, 0x2b, 0x07, 0x04, 0x03, 0x19, 0xfe,
+  0xfd, 0x11, 0x0a, 0x00, 0xfe, 0x01, 0xf5, 0xfd, 0x01, 0x0c, 0x00, 0x04,
+  0x00, 0xfa, 0x06, 0x04, 0xff, 0xf8, 0x00, 0x00, 0x27, 0xee, 0x1e, 0x0b,
+  0xf5, 0x07, 0xed, 0x03, 0x02, 0x0f, 0x06, 0x08, 0x16, 0x15, 0x12, 0x02,
+  0x08, 0x01, 0x1d, 0xf9, 0x02, 0x06, 0x18, 0xf9, 0xfc, 0x00, 0x01, 0xff,
+  0x01, 0xfe, 0xfc, 0xfd, 0x00, 0x05, 0x00, 0x06, 0x00, 0xfe, 0x01, 0x01,
+  0x07, 0xd8, 0xf2, 0xf1, 0xce, 0xf7, 0xf9, 0xfa, 0xec, 0x00, 0xf8, 0x01,
+  0x16, 0x00, 0x0c, 0xf1, 0x14, 0xf3, 0x07, 0xfb, 0x06, 0xfe, 0x0d, 0x02,
+  0xff, 0x03, 0x04, 0x05, 0x00, 0x0c, 0xfc, 0x09, 0x00, 0x12, 0xfd, 0x09,
+  0x04, 0x08, 0x07, 0x03, 0xf0, 0xd5, 0x07, 0xf9, 0xda, 0xf4, 0xeb, 0xfe,
+  0xe4, 0xe7, 0xf1, 0xfe, 0x10, 0xf0, 0xfa, 0xf3, 0x02, 0x00, 0x0c, 0x02,
+  0xff, 0xf9, 0x05, 0xf4, 0xfe, 0x02, 0xfa, 0x01, 0x01, 0x04, 0x03, 0x04,
+  0x03, 0x06, 0xf9, 0x07, 0x00, 0x09, 0x00, 0x09, 0xe8, 0xfa, 0xfa, 0x09,
+  0xdd, 0xf1, 0x09, 0xfa, 0xef, 0xee, 0xf3, 0xff, 0x08, 0x00, 0x06, 0x0e,
+  0xfd, 0x05, 0x0f, 0xfe, 0xf6, 0xf6, 0xf3, 0xfd, 0xf7, 0x01, 0xfe, 0xf8,
+  0x00, 0xfe, 0xfe, 0x06, 0x08, 0x05, 0xff, 0xff, 0x08, 0x05, 0x01, 0x01,
+  0xea, 0x04, 0x08, 0x0b, 0xfa, 0x09, 0xfb, 0x0a, 0xf8, 0x05, 0xf3, 0x03,
+  0x08, 0x0b, 0xfb, 0x15, 0x01, 0x0b, 0x0b, 0x13, 0xfc, 0x19, 0x05, 0x15,
+  0xf4, 0x0a, 0xfe, 0x0b, 0x05, 0x1e, 0xf8, 0x0e, 0x09, 0x15, 0xfb, 0x05,
+  0x00, 0x0e, 0x03, 0x01, 0xde, 0x1b, 0x11, 0x17, 0x06, 0x0a, 0x1d, 0x06,
+  0x00, 0x0d, 0x09, 0x02, 0x0b, 0x0b, 0xfe, 0x07, 0x00, 0x08, 0x0b, 0x0e,
+  0xf8, 0x13, 0x07, 0x06, 0xf5, 0x1b, 0x0b, 0x0f, 0x00, 0x16, 0xfb, 0x08,
+  0x09, 0x08, 0x01, 0x02, 0x00, 0x07, 0x07, 0xfd, 0xeb, 0x0c, 0x03, 0x09,
+  0x03, 0x07, 0xff, 0x08, 0xfa, 0x04, 0x0c, 0xf5, 0x06, 0x0a, 0xf3, 0x00,
+  0x09, 0xfa, 0x03, 0x10, 0xff, 0x06, 0xfb, 0x09, 0x01, 0x13, 0x07, 0x0b,
+  0x02, 0x10, 0xfe, 0x05, 0x01, 0x0b, 0x05, 0x03, 0x00, 0x02, 0x00, 0x00,
+  0xeb, 0x15, 0x0d, 0x05, 0x01, 0xfe, 0xe6, 0x03, 0xfc, 0xfe, 0x08, 0x03,
+  0x05, 0xfd, 0xfe, 0xfb, 0x01, 0x05, 0x04, 0xfa, 0xfd, 0x06, 0xfe, 0x03,
+  0x01, 0x09, 0x02, 0x07, 0x00, 0x09, 0x04, 0x09, 0x00, 0x08, 0x01, 0x05,
+  0x00, 0x03, 0x04, 0xfd, 0xfd, 0xd2, 0xe6, 0xe2, 0xdc, 0x04, 0xec, 0xfc,
+  0x01, 0x0a, 0x01, 0x03, 0xfd, 0xf7, 0x01, 0xfa, 0x00, 0x00, 0x02, 0xfc,
+  0x01, 0x21, 0x19, 0x1d, 0x08, 0x1b, 0x21, 0x19, 0x01, 0x19, 0x0e, 0xf9,
+  0x00, 0x0d, 0x0a, 0x06, 0x00, 0x10, 0x11, 0x09, 0xed, 0xe1, 0xdd, 0xe4,
+  0xe4, 0x1c, 0xd4, 0xfe, 0xf3, 0xde, 0xfd, 0xef, 0x02, 0xce, 0xfb, 0xf4,
+  0xf5, 0xea, 0xf4, 0x04, 0x02, 0x12, 0xf7, 0x0f, 0x0a, 0x06, 0x03, 0x01,
+  0x02, 0x1c, 0x0a, 0x02, 0x02, 0x13, 0x09, 0x04, 0x00, 0x0c, 0x0e, 0xfe,
+  0xed, 0xe2, 0x08, 0xe3, 0xed, 0x10, 0xc5, 0xf7, 0xef, 0xd0, 0xf1, 0xfc,
+  0xfc, 0xec, 0x00, 0xf8, 0xfc, 0xf3, 0xf6, 0xfa, 0x02, 0xfe, 0x03, 0x10,
+  0x03, 0x0d, 0x05, 0x0a, 0x02, 0x13, 0x0e, 0x02, 0x00, 0x0d, 0x07, 0x04,
+  0x00, 0x0b, 0x01, 0xff, 0xd8, 0xe1, 0x03, 0x19, 0xcb, 0x0b, 0xed, 0xfb,
+  0xcb, 0xe5, 0xfe, 0xf2, 0xfe, 0xda, 0x0f, 0xe7, 0xeb, 0xe0, 0xf3, 0xea,
+  0xf4, 0xf8, 0x03, 0x15, 0x03, 0x00, 0xf2, 0x03, 0x05, 0x04, 0xfc, 0x10,
+  0x00, 0x0b, 0x09, 0x01, 0x01, 0x0b, 0x07, 0x10, 0x02, 0x07, 0xec, 0x20,
+  0xe3, 0xfc, 0xec, 0x0b, 0xdc, 0xdf, 0x0d, 0xf1, 0xf1, 0xfe, 0x04, 0xe9,
+  0xec, 0xe0, 0xf6, 0xec, 0xfd, 0xe7, 0xf5, 0xf5, 0xff, 0x00, 0xf9, 0xfd,
+  0x01, 0x0c, 0x06, 0xfd, 0x01, 0x12, 0xfe, 0x05, 0x02, 0x10, 0x0c, 0x08,
+  0xf1, 0xfa, 0x16, 0x2b, 0xe8, 0x2a, 0x06, 0x19, 0xfa, 0xf9, 0x30, 0x02,
+  0xf5, 0x07, 0x0b, 0xfc, 0xee, 0xfb, 0xf2, 0x06, 0xf9, 0x06, 0xeb, 0x04,
+  0xf6, 0xfe, 0x00, 0xfb, 0x01, 0x09, 0x09, 0xfe, 0x00, 0x13, 0x03, 0x0b,
+  0x02, 0x15, 0x08, 0x0d, 0xf6, 0xea, 0x09, 0x2b, 0x01, 0x1d, 0xf8, 0x0c,
+  0x0b, 0xfe, 0x45, 0xd9, 0x03, 0x0b, 0x2b, 0x04, 0xe4, 0xf8, 0xf7, 0xfb,
+  0xff, 0xe8, 0xf2, 0xdb, 0xfd, 0xee, 0xf7, 0xe8, 0x00, 0x06, 0x03, 0x0c,
+  0x01, 0x12, 0x08, 0x0f, 0x01, 0x0d, 0x0f, 0x00, 0x2b, 0x16, 0x31, 0x10,
+  0x0d, 0x37, 0x09, 0x14, 0x1b, 0x13, 0x02, 0xf7, 0x13, 0x05, 0x3a, 0xfb,
+  0xdf, 0xfc, 0xfe, 0xf7, 0xfc, 0xf0, 0xf3, 0xef, 0xf1, 0xe9, 0xf7, 0xed,
+  0xf8, 0xfe, 0x03, 0x0a, 0x00, 0x12, 0x04, 0x04, 0x00, 0x13, 0x02, 0x0c,
+  0x33, 0xfb, 0x12, 0xf4, 0xf7, 0x27, 0xdc, 0x21, 0xf5, 0x1b, 0xf1, 0x08,
+  0x14, 0x05, 0x3e, 0xef, 0xf1, 0x0d, 0x28, 0xf0, 0x05, 0x05, 0x09, 0xf9,
+  0xed, 0xfd, 0xfd, 0x00, 0xf2, 0xfe, 0xf4, 0xf1, 0x00, 0x09, 0x05, 0xee,
+  0x00, 0x04, 0x03, 0x03, 0x1f, 0xf4, 0x03, 0xf4, 0xf1, 0x20, 0xf4, 0xe8,
+  0xe7, 0x06, 0xe5, 0x0e, 0x11, 0xe9, 0x27, 0xfd, 0xff, 0x2b, 0x17, 0x04,
+  0x0b, 0x05, 0x21, 0x0a, 0xff, 0xf2, 0x04, 0x12, 0xf8, 0x04, 0x0a, 0xfe,
+  0x01, 0x0a, 0x05, 0xfd, 0x00, 0x04, 0x03, 0x05, 0xe0, 0x93, 0xeb, 0xc0,
+  0xda, 0xfd, 0xf7, 0x09, 0xb6, 0x0e, 0xc8, 0x27, 0xfd, 0xf5, 0xfa, 0x04,
+  0xe7, 0x19, 0x0d, 0x00, 0x0a, 0x0e, 0x12, 0x0c, 0xfb, 0x08, 0x06, 0x1b,
+  0x04, 0x1b, 0xfb, 0x06, 0x03, 0x27, 0x0b, 0x0d, 0x03, 0x19, 0x03, 0x10,
+  0xc7, 0x93, 0xef, 0xcd, 0xb5, 0xf7, 0xe6, 0x14, 0xb1, 0x00, 0xcd, 0x21,
+  0xed, 0xf5, 0xe9, 0xf7, 0xff, 0xfe, 0x09, 0x0b, 0xfe, 0x17, 0xf4, 0x08,
+  0xf1, 0x0f, 0x13, 0x16, 0x02, 0x30, 0x12, 0x14, 0x04, 0x25, 0x08, 0x12,
+  0x03, 0x14, 0x07, 0x09, 0x9d, 0xc1, 0x04, 0xfd, 0x9e, 0xe7, 0xee, 0x04,
+  0xc0, 0xf3, 0xe3, 0x10, 0x00, 0xfc, 0xdf, 0xfb, 0x04, 0x00, 0x00, 0x10,
+  0x05, 0x29, 0xfe, 0x27, 0x01, 0x23, 0x0e, 0x20, 0x02, 0x2f, 0x08, 0x14,
+  0x03, 0x1b, 0x07, 0x0c, 0x01, 0x0f, 0x0d, 0x04, 0xa9, 0x0d, 0x24, 0x36,
+  0xc6, 0xdb, 0x04, 0x22, 0xcc, 0xe5, 0xe9, 0x0c, 0x0a, 0x01, 0xf0, 0xeb,
+  0x0f, 0xf8, 0xdf, 0xff, 0x0a, 0x22, 0xf6, 0x1e, 0x02, 0x1d, 0x0f, 0x1c,
+  0x02, 0x1a, 0x0d, 0x09, 0x00, 0x16, 0x0d, 0x03, 0x01, 0x00, 0x09, 0x02,
+  0xc1, 0x40, 0x26, 0x53, 0xf4, 0x1a, 0x08, 0x3e, 0xeb, 0xef, 0x17, 0x04,
+  0xf5, 0x05, 0xe0, 0x1c, 0xfa, 0x03, 0xef, 0x02, 0xf1, 0x19, 0xf3, 0x20,
+  0xf4, 0x07, 0xeb, 0x05, 0x03, 0x1f, 0x03, 0x12, 0x01, 0x1e, 0x03, 0x12,
+  0x01, 0x14, 0x03, 0x02, 0xde, 0x45, 0x50, 0x5e, 0x0d, 0x2c, 0xf5, 0x30,
+  0xfc, 0xec, 0x21, 0xf5, 0xe1, 0x19, 0xf4, 0x15, 0xf4, 0x05, 0x09, 0x12,
+  0x01, 0x2b, 0xff, 0x29, 0xe6, 0x16, 0xe3, 0x08, 0x04, 0x2b, 0x00, 0x17,
+  0x01, 0x1c, 0xfa, 0x0c, 0x01, 0x0d, 0x08, 0x01, 0x07, 0x40, 0x2f, 0x59,
+  0x16, 0x31, 0xdc, 0x1f, 0xff, 0xf8, 0x24, 0xe7, 0xde, 0x25, 0xee, 0xed,
+  0xf8, 0xf9, 0x02, 0x05, 0xfe, 0x10, 0xfb, 0x19, 0xec, 0xfa, 0xfe, 0x00,
+  0x04, 0x0a, 0xfb, 0x08, 0x01, 0xfe, 0xfe, 0xf7, 0x01, 0x0d, 0x19, 0xf4,
+  0x1f, 0x1b, 0x37, 0x3b, 0x1c, 0x20, 0xf8, 0x1f, 0xeb, 0x1a, 0x0b, 0xe3,
+  0xec, 0x1c, 0x16, 0x01, 0x0d, 0xfc, 0xf1, 0x09, 0xfe, 0xff, 0x06, 0x08,
+  0xfa, 0xe9, 0xfb, 0xf0, 0x10, 0xeb, 0x02, 0x01, 0x00, 0xf5, 0xfa, 0xf7,
+  0x00, 0xfb, 0x0c, 0xf6, 0x11, 0xeb, 0x07, 0x29, 0x20, 0x19, 0xfd, 0x22,
+  0xdf, 0x15, 0xfa, 0x01, 0x12, 0x0d, 0x2d, 0x06, 0x05, 0x18, 0xf9, 0x15,
+  0x00, 0x07, 0x10, 0x14, 0xfa, 0x08, 0x0b, 0xfd, 0x09, 0xfc, 0x02, 0x13,
+  0x01, 0x0d, 0x02, 0x0c, 0x00, 0x0b, 0xfc, 0x06, 0xfa, 0xfc, 0x03, 0x11,
+  0x29, 0xf4, 0xf9, 0x0b, 0xe8, 0xf7, 0xbf, 0xff, 0x0e, 0x07, 0x15, 0x0e,
+  0xfe, 0xf9, 0x00, 0xed, 0xfa, 0xf3, 0x05, 0x19, 0x00, 0x0e, 0x10, 0x0a,
+  0x05, 0xf6, 0x0b, 0x0c, 0x01, 0x06, 0xf7, 0xf4, 0x01, 0xfe, 0x0b, 0xff,
+  0x02, 0xf0, 0xd7, 0xe7, 0x1c, 0xe1, 0x07, 0xf6, 0xf2, 0xda, 0xe0, 0x0b,
+  0xf4, 0xf6, 0xe6, 0xfa, 0xff, 0xf5, 0x07, 0xf9, 0x08, 0x0b, 0xf7, 0x13,
+  0x03, 0xfb, 0x1a, 0xff, 0x02, 0x12, 0x0a, 0xfa, 0x00, 0x1b, 0x01, 0xf6,
+  0x00, 0x10, 0x0b, 0x02, 0xf1, 0xf4, 0xc1, 0xda, 0x22, 0xc5, 0x03, 0xf9,
+  0xeb, 0xd4, 0xe8, 0xf7, 0xf3, 0xd4, 0xce, 0x00, 0x06, 0xf3, 0xf6, 0xf1,
+  0x09, 0x06, 0xf4, 0x13, 0x09, 0x01, 0x11, 0x0e, 0x00, 0x16, 0x04, 0x06,
+  0x01, 0x0c, 0x01, 0x05, 0x00, 0x0b, 0x03, 0x03, 0x15, 0xe9, 0xd0, 0xdd,
+  0x25, 0xdb, 0x04, 0x02, 0xdf, 0xe1, 0xd6, 0xf6, 0xfd, 0xeb, 0xda, 0x0a,
+  0x07, 0x04, 0xf5, 0x00, 0x04, 0x07, 0x04, 0x02, 0x04, 0x0b, 0x1e, 0x0b,
+  0x02, 0x1b, 0x0f, 0x17, 0x02, 0x1b, 0x05, 0x10, 0x00, 0x12, 0xff, 0x02,
+  0xfc, 0xe7, 0xc3, 0xf3, 0x04, 0xef, 0xee, 0x0c, 0xf7, 0xeb, 0xeb, 0xf0,
+  0x01, 0x01, 0xd9, 0x0b, 0x05, 0x12, 0xff, 0x0a, 0x09, 0x19, 0x02, 0x05,
+  0x06, 0x20, 0x07, 0x0b, 0x00, 0x16, 0x12, 0x16, 0x00, 0x02, 0x07, 0x03,
+  0x02, 0x10, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xe9, 0x15, 0xe1, 0xea, 0xf2, 0xd8, 0xfa,
+  0x0b, 0x16, 0xfa, 0x10, 0x00, 0xff, 0xfc, 0x04, 0x00, 0x02, 0xf2, 0x0f,
+  0x01, 0x10, 0x0c, 0x0c, 0x03, 0x0c, 0xfb, 0x09, 0x00, 0xfc, 0x07, 0xf9,
+  0xf8, 0xe7, 0xf4, 0xfb, 0xf4, 0x10, 0xff, 0x0c, 0xeb, 0xf1, 0x11, 0x0e,
+  0xd9, 0xf8, 0x02, 0x0c, 0xf4, 0x1f, 0xfb, 0x21, 0x0f, 0xff, 0x04, 0x08,
+  0x04, 0x00, 0x08, 0xf1, 0x02, 0x0d, 0x03, 0xf2, 0x04, 0x13, 0x0c, 0x13,
+  0x00, 0x17, 0x09, 0x1e, 0x00, 0x04, 0x04, 0x08, 0x00, 0x05, 0xfe, 0x00,
+  0xf5, 0xf5, 0x3b, 0x20, 0xd7, 0xfa, 0xfc, 0x20, 0xf8, 0x16, 0xee, 0x0e,
+  0x12, 0x29, 0x08, 0x10, 0x08, 0xf5, 0x01, 0x01, 0xf8, 0x03, 0x07, 0x07,
+  0xf7, 0x15, 0xf3, 0x07, 0x00, 0x1c, 0x0d, 0x1f, 0x00, 0x26, 0x17, 0x18,
+  0x00, 0x1c, 0x11, 0x08, 0xe8, 0x02, 0x57, 0x36, 0xce, 0x0a, 0xf9, 0x2f,
+  0xda, 0x14, 0xf5, 0x34, 0xf4, 0x13, 0xf2, 0x14, 0x08, 0xfd, 0xeb, 0xfa,
+  0x00, 0x0d, 0x05, 0x12, 0xfd, 0x1a, 0xff, 0x22, 0x00, 0x21, 0x08, 0x23,
+  0x00, 0x14, 0x07, 0x25, 0x00, 0x1d, 0x00, 0x16, 0xe4, 0x1e, 0x44, 0x49,
+  0xd9, 0x14, 0x0c, 0x46, 0xca, 0x0c, 0xd2, 0x4c, 0xe5, 0xfa, 0xff, 0xf2,
+  0xf1, 0x18, 0xea, 0x16, 0x04, 0x12, 0xff, 0x16, 0xf5, 0x05, 0xfc, 0x2c,
+  0xfa, 0x17, 0xfe, 0x15, 0x02, 0x0d, 0x06, 0xfe, 0x00, 0x0f, 0x02, 0x06,
+  0xdc, 0x37, 0x22, 0x54, 0xee, 0x0e, 0x09, 0x33, 0xd6, 0xd5, 0xe5, 0x0c,
+  0xdb, 0x02, 0xea, 0x08, 0xee, 0x09, 0xfc, 0xdf, 0x02, 0x1a, 0xfb, 0x08,
+  0xf9, 0x09, 0x09, 0x1b, 0xfb, 0x1b, 0xfc, 0x06, 0x01, 0x11, 0x07, 0xf2,
+  0x00, 0x0b, 0xfd, 0x16, 0xeb, 0x30, 0x26, 0x67, 0xf3, 0x28, 0x19, 0x38,
+  0xd8, 0xd6, 0xe8, 0x25, 0xda, 0x0f, 0xef, 0xf9, 0xf4, 0xea, 0x0a, 0xf5,
+  0xfc, 0x24, 0xe0, 0x18, 0x02, 0xec, 0x02, 0x0f, 0x06, 0x06, 0x0f, 0x05,
+  0x00, 0xfb, 0x08, 0xfb, 0x00, 0xf3, 0x05, 0x05, 0xea, 0x2e, 0x22, 0x64,
+  0x1a, 0x13, 0x26, 0x21, 0xea, 0xf1, 0x0f, 0x06, 0xf7, 0x0a, 0xfd, 0xfe,
+  0xf6, 0xf0, 0x00, 0xfa, 0x04, 0x1b, 0xdb, 0xf5, 0xf8, 0xf7, 0x0b, 0xff,
+  0x04, 0x07, 0x0e, 0xfc, 0x02, 0x01, 0xf8, 0xfc, 0x00, 0xff, 0xfd, 0x04,
+  0x06, 0x22, 0x14, 0x4b, 0x40, 0xfe, 0x1c, 0x11, 0x09, 0xe3, 0x0f, 0xff,
+  0xfb, 0xff, 0xfa, 0x07, 0x0b, 0xf1, 0x00, 0xf8, 0x01, 0x02, 0xf8, 0x02,
+  0xfe, 0xfe, 0xf7, 0x19, 0x02, 0xfd, 0x06, 0xe7, 0x00, 0x04, 0xfd, 0x08,
+  0x00, 0xf5, 0xf0, 0x10, 0x13, 0x1a, 0xf5, 0x48, 0x52, 0xf4, 0x13, 0x01,
+  0x13, 0xf9, 0x1f, 0x07, 0xed, 0x05, 0x01, 0x11, 0xfd, 0xf6, 0xe8, 0x14,
+  0xf4, 0xfc, 0xf7, 0xed, 0xfb, 0xdc, 0xe0, 0x00, 0x03, 0xec, 0x07, 0xeb,
+  0x02, 0xee, 0x00, 0x0f, 0xff, 0x07, 0xff, 0x07, 0x39, 0x05, 0xdc, 0x15,
+  0x4c, 0xc3, 0x0d, 0xeb, 0x1c, 0xfa, 0x03, 0x06, 0xf8, 0xff, 0xea, 0x19,
+  0xef, 0xfd, 0x00, 0x16, 0x14, 0xf5, 0xf5, 0xf5, 0xf7, 0xe4, 0xeb, 0x01,
+  0x04, 0xf7, 0xf8, 0xd5, 0x01, 0x03, 0xf6, 0x05, 0xfd, 0x02, 0xff, 0xfb,
+  0x2b, 0xed, 0xbc, 0xd9, 0x36, 0xc0, 0x1d, 0x0a, 0x0f, 0xea, 0xeb, 0xfe,
+  0x33, 0xfc, 0xe5, 0x1c, 0xfb, 0x05, 0xeb, 0x18, 0x10, 0x03, 0x04, 0xfd,
+  0xef, 0x0e, 0x01, 0x07, 0x13, 0xec, 0x08, 0xe6, 0x07, 0xec, 0xeb, 0xf7,
+  0x00, 0x00, 0xf3, 0x05, 0x32, 0xec, 0x88, 0xca, 0x26, 0xa3, 0x19, 0xfd,
+  0xfc, 0xfd, 0x0c, 0xf4, 0x17, 0x0e, 0xe4, 0x2d, 0x03, 0x02, 0xea, 0x24,
+  0x02, 0xff, 0x19, 0xfa, 0x13, 0x0f, 0x09, 0x1a, 0x10, 0x0a, 0xff, 0xfc,
+  0x01, 0xfb, 0x04, 0x10, 0x00, 0xf7, 0xfb, 0xff, 0x0f, 0xd6, 0x84, 0x9f,
+  0x10, 0xa3, 0x07, 0x0a, 0x0c, 0xe0, 0xf6, 0x04, 0x2a, 0xe5, 0xd2, 0x2e,
+  0x11, 0xf0, 0xeb, 0x1a, 0x08, 0x03, 0xf9, 0x0f, 0x0a, 0x0a, 0x10, 0x2b,
+  0x12, 0x04, 0xfe, 0xff, 0x00, 0x12, 0x08, 0x0a, 0x00, 0xfe, 0xff, 0x09,
+  0xed, 0xdd, 0x8f, 0xb1, 0xef, 0xaf, 0xfe, 0xfa, 0xf6, 0xd7, 0x0a, 0xfe,
+  0x1e, 0xe1, 0xd5, 0x2d, 0x02, 0xf8, 0xf3, 0x13, 0x0b, 0xf3, 0xf3, 0x02,
+  0xfb, 0x13, 0x0f, 0xfe, 0x11, 0x12, 0xfe, 0x03, 0x01, 0x16, 0x01, 0x0f,
+  0x07, 0x19, 0x00, 0x00, 0xe3, 0xd4, 0x99, 0xb3, 0xdb, 0xc2, 0xe3, 0x07,
+  0x1d, 0xd0, 0x01, 0xf5, 0x01, 0xe7, 0xbb, 0x0f, 0x02, 0xf5, 0xf5, 0x20,
+  0x0b, 0xff, 0xfe, 0x00, 0x00, 0x17, 0x06, 0x06, 0x02, 0x21, 0x05, 0x0f,
+  0x00, 0x11, 0xf7, 0xfc, 0x06, 0x0b, 0xfa, 0xfb, 0xdf, 0xbc, 0xbe, 0xb4,
+  0xd3, 0xeb, 0xe2, 0x1b, 0x0e, 0xf2, 0xf1, 0xfe, 0x06, 0x0a, 0xdc, 0x2d,
+  0xff, 0x17, 0xf6, 0x2d, 0x06, 0x13, 0x04, 0x1c, 0x05, 0x29, 0x05, 0x17,
+  0x01, 0x32, 0x13, 0x29, 0x00, 0x2d, 0x01, 0x1a, 0x06, 0x1a, 0x05, 0x08,
+  0xe1, 0xcf, 0xe0, 0xb8, 0xcf, 0x05, 0xe4, 0x21, 0xfb, 0x07, 0xf9, 0x1a,
+  0x00, 0xf6, 0xdf, 0x0d, 0xff, 0x21, 0xf3, 0x10, 0x02, 0x13, 0x08, 0x19,
+  0xfa, 0x2a, 0xfe, 0x10, 0x10, 0x33, 0x13, 0x1b, 0x03, 0x2e, 0x09, 0x0f,
+  0x04, 0x13, 0x0d, 0x09, 0xca, 0xc6, 0xf8, 0xc8, 0xbe, 0xfb, 0xf2, 0x15,
+  0xf0, 0xe1, 0x0c, 0xf3, 0xea, 0xd8, 0xfd, 0xf2, 0x03, 0xf8, 0xec, 0xfa,
+  0xf6, 0xf4, 0xea, 0xe2, 0xfc, 0x06, 0xe8, 0x01, 0x08, 0x27, 0xfa, 0x08,
+  0x05, 0x14, 0x13, 0x09, 0x02, 0x04, 0x08, 0x04, 0xe6, 0xe2, 0x02, 0xf9,
+  0xc4, 0xfc, 0xef, 0x19, 0xf6, 0xf3, 0x0a, 0x09, 0xf3, 0xf6, 0x04, 0xff,
+  0xf7, 0xf5, 0xe5, 0x0e, 0xf4, 0xf4, 0x03, 0xf9, 0xf7, 0x05, 0xe3, 0x08,
+  0x07, 0x0d, 0x06, 0x18, 0x08, 0x0e, 0x07, 0x0c, 0x0a, 0x02, 0x05, 0x0a,
+  0xd2, 0xe7, 0x06, 0x00, 0xd3, 0xfb, 0x03, 0x04, 0xf1, 0xf1, 0xf3, 0x09,
+  0x01, 0x0d, 0xf7, 0xf5, 0xfe, 0xf1, 0xf5, 0xff, 0xef, 0x0a, 0x06, 0xff,
+  0xe0, 0x1d, 0xfc, 0x0d, 0x0a, 0x20, 0x07, 0x1d, 0x0a, 0x0b, 0xfb, 0x06,
+  0x00, 0x02, 0x03, 0x00, 0xfa, 0x0e, 0x67, 0x23, 0xe3, 0x0e, 0x00, 0x08,
+  0xf4, 0x07, 0xf7, 0x14, 0x02, 0x0f, 0x0b, 0xf2, 0x00, 0xf7, 0x0a, 0x10,
+  0xf0, 0x17, 0x0a, 0x05, 0xeb, 0x07, 0xf8, 0x08, 0x01, 0x1b, 0xf7, 0x0b,
+  0x0a, 0x05, 0xf5, 0x00, 0x00, 0x05, 0xf2, 0x00, 0x01, 0x03, 0x3d, 0x24,
+  0x06, 0x18, 0xf8, 0x0b, 0x02, 0x15, 0x08, 0x01, 0x02, 0x00, 0x00, 0xf2,
+  0xfc, 0xfb, 0x0b, 0xfb, 0xf0, 0x13, 0xf5, 0x09, 0x01, 0x0f, 0xff, 0xfe,
+  0x00, 0x07, 0xf5, 0xfd, 0x00, 0xfc, 0xfd, 0x02, 0x00, 0x02, 0xf8, 0x03,
+  0x18, 0x14, 0x31, 0x1e, 0x11, 0x19, 0x07, 0x07, 0x0c, 0x10, 0x0f, 0x11,
+  0x0d, 0xf6, 0x0a, 0xe6, 0x00, 0xfa, 0x0c, 0xe7, 0xf7, 0x05, 0x07, 0x06,
+  0x01, 0x09, 0x04, 0x0a, 0x00, 0xf5, 0xf6, 0x06, 0x00, 0x02, 0xf7, 0x0b,
+  0x00, 0x01, 0x0c, 0x00, 0x0e, 0xbf, 0xef, 0xdc, 0xec, 0x4e, 0xbf, 0xdd,
+  0xf7, 0xf0, 0xe0, 0x1c, 0x04, 0xe3, 0x0c, 0xf5, 0x00, 0x10, 0xfa, 0x22,
+  0x01, 0x12, 0xf9, 0x03, 0xfe, 0xf8, 0xfc, 0xef, 0x00, 0xfc, 0xf2, 0xff,
+  0x00, 0x04, 0x05, 0xfc, 0x00, 0xf7, 0xf4, 0xfe, 0x31, 0xd7, 0xf3, 0xda,
+  0xf9, 0x1f, 0x04, 0xd9, 0xf4, 0x01, 0xe2, 0xf8, 0xfc, 0xe3, 0x00, 0xf1,
+  0x0b, 0x04, 0xf6, 0x04, 0xff, 0xfb, 0x02, 0x08, 0xfd, 0x16, 0x02, 0xeb,
+  0x00, 0xf0, 0xf6, 0xf9, 0x00, 0x1c, 0x01, 0x0f, 0x00, 0x17, 0x03, 0x17,
+  0x39, 0xc1, 0xee, 0xd0, 0x02, 0x20, 0x3d, 0xdf, 0xe7, 0x1c, 0xde, 0xf4,
+  0xf7, 0xfb, 0x0e, 0xfd, 0x0b, 0x20, 0x0d, 0x09, 0xfe, 0xf9, 0xe5, 0x0d,
+  0x01, 0x0e, 0x0e, 0x09, 0xff, 0x05, 0xf6, 0xf6, 0xff, 0x02, 0xf7, 0x06,
+  0x00, 0x04, 0xf0, 0x09, 0x36, 0xaa, 0xea, 0x9e, 0x0c, 0x17, 0x3f, 0xd0,
+  0x0d, 0x16, 0x06, 0xed, 0x07, 0xf5, 0x04, 0xfb, 0x17, 0x0b, 0x11, 0xf6,
+  0x0b, 0xf3, 0xf9, 0xf1, 0x05, 0x02, 0x0b, 0xef, 0xff, 0xfc, 0xf8, 0xec,
+  0xff, 0xfc, 0xf6, 0xf4, 0x00, 0xe8, 0x07, 0xf0, 0x1f, 0xdf, 0x00, 0xba,
+  0x20, 0x11, 0x49, 0xdb, 0x2d, 0x0d, 0x24, 0xd4, 0x13, 0xf3, 0xe3, 0xfc,
+  0x0b, 0xfd, 0x1e, 0xd4, 0x06, 0x0c, 0xf4, 0x0e, 0x0f, 0x24, 0x2c, 0xfe,
+  0x05, 0x18, 0xfb, 0xf7, 0xff, 0x00, 0x03, 0xfd, 0x00, 0xf9, 0x00, 0xfb,
+  0x2b, 0x0e, 0xd7, 0xd3, 0x44, 0xef, 0x2e, 0xe2, 0x46, 0x0a, 0x2e, 0xe9,
+  0x15, 0xdd, 0xf4, 0xf3, 0x01, 0xe9, 0x02, 0x02, 0x03, 0x03, 0xfb, 0x16,
+  0x12, 0x26, 0x27, 0x15, 0x04, 0xfb, 0x07, 0xf9, 0xff, 0xfd, 0xf2, 0x07,
+  0x00, 0xfc, 0x01, 0xf4, 0x0c, 0x16, 0xeb, 0xcd, 0x43, 0xd1, 0x31, 0xda,
+  0x4b, 0x16, 0x20, 0xea, 0x0d, 0xc9, 0xfd, 0xfa, 0xea, 0xfa, 0xf5, 0xfa,
+  0x0b, 0xff, 0x09, 0x00, 0x16, 0x0d, 0x14, 0xe7, 0xff, 0x00, 0xfd, 0xfc,
+  0x00, 0xfc, 0xfa, 0x06, 0x00, 0x04, 0xff, 0x0c, 0x03, 0x27, 0x05, 0xfa,
+  0x42, 0xee, 0x1d, 0xff, 0x48, 0x1b, 0x33, 0xff, 0xf3, 0xf4, 0xfe, 0x05,
+  0x07, 0xe5, 0x02, 0x08, 0x0c, 0x01, 0x04, 0xfd, 0x19, 0x13, 0x04, 0x0c,
+  0x03, 0xfa, 0x02, 0x0a, 0xfd, 0x09, 0xfb, 0x10, 0x00, 0x12, 0x09, 0x0e,
+  0x04, 0x33, 0x18, 0x20, 0x23, 0xfa, 0xfa, 0xf6, 0x47, 0xfd, 0x36, 0x10,
+  0xf6, 0xe6, 0x0c, 0xee, 0xf8, 0xf1, 0xd6, 0x00, 0xf8, 0xee, 0x06, 0xf7,
+  0x0d, 0x07, 0x0b, 0x04, 0x0b, 0xe4, 0x07, 0x11, 0xff, 0xdd, 0xf0, 0x09,
+  0x04, 0x08, 0x04, 0xfd, 0x04, 0x31, 0x1f, 0x1d, 0x10, 0x04, 0xc1, 0xf7,
+  0x39, 0x01, 0x34, 0x00, 0x17, 0xf0, 0x03, 0xde, 0xe8, 0xf7, 0xf3, 0xeb,
+  0xfb, 0xf0, 0x0d, 0x07, 0x05, 0x02, 0x01, 0x06, 0x05, 0xf6, 0x0c, 0x0a,
+  0xff, 0xfc, 0x0e, 0x0f, 0xfe, 0x0c, 0xf1, 0x07, 0x0a, 0x18, 0x3b, 0x29,
+  0x07, 0x2d, 0xbf, 0xff, 0x23, 0x07, 0x06, 0x0a, 0x02, 0x17, 0x3b, 0xef,
+  0xf9, 0x18, 0xf5, 0x04, 0xf7, 0x05, 0x14, 0xee, 0x08, 0x17, 0xff, 0xf4,
+  0xff, 0x0b, 0x13, 0x14, 0xfe, 0xf7, 0x05, 0xf6, 0xfd, 0xfb, 0xfd, 0x0b,
+  0x07, 0x05, 0x42, 0x39, 0xf2, 0x37, 0xd1, 0xdc, 0xe4, 0x05, 0xf8, 0x0b,
+  0xee, 0xf8, 0x46, 0xd7, 0x01, 0x10, 0xf9, 0xe6, 0xff, 0xfd, 0x09, 0xed,
+  0x0d, 0xf3, 0xfd, 0xf1, 0xfd, 0xea, 0xeb, 0xf2, 0xfd, 0xeb, 0x0e, 0x00,
+  0xff, 0x05, 0x05, 0x08, 0x1c, 0xef, 0x47, 0x2e, 0xc1, 0x27, 0xd3, 0xeb,
+  0xb1, 0x1e, 0xe8, 0x1f, 0xff, 0x15, 0x1d, 0xe0, 0x03, 0x26, 0x26, 0xfe,
+  0x06, 0x1a, 0x03, 0x02, 0xfa, 0xed, 0x06, 0xf0, 0x00, 0xe1, 0x08, 0xf1,
+  0xff, 0xf2, 0x08, 0xf3, 0xff, 0xfb, 0xfa, 0xfc, 0x16, 0xf4, 0x2b, 0x22,
+  0xb6, 0x23, 0x0c, 0xee, 0xb5, 0x17, 0xee, 0x17, 0xf6, 0x21, 0x1f, 0xfa,
+  0xfb, 0x4b, 0x17, 0x0a, 0x0a, 0x1c, 0x29, 0x12, 0x06, 0xf9, 0x0b, 0xf6,
+  0xff, 0xfa, 0xfc, 0xf8, 0xff, 0xf8, 0xfb, 0xfe, 0xff, 0xfb, 0xf7, 0xfe,
+  0x1b, 0x0b, 0x23, 0x19, 0xc9, 0x0a, 0xf7, 0xf3, 0xc3, 0x0c, 0xce, 0x2b,
+  0x03, 0x1b, 0x13, 0xf5, 0xfb, 0x1c, 0x0e, 0xf4, 0x14, 0x06, 0x04, 0xf6,
+  0x1b, 0xfc, 0x19, 0x05, 0xfe, 0xf1, 0x05, 0xf5, 0xff, 0xe5, 0x0a, 0xed,
+  0xf9, 0xf0, 0xf6, 0xfc, 0x23, 0x0d, 0xf9, 0xf8, 0xd8, 0xf9, 0x14, 0x01,
+  0xe5, 0x08, 0xd6, 0x1a, 0x0b, 0xfc, 0x07, 0x11, 0x05, 0x1b, 0x0c, 0xe5,
+  0x0a, 0xe8, 0xed, 0xe8, 0x1b, 0xfb, 0x23, 0xfb, 0xfe, 0xf5, 0x0a, 0xf8,
+  0xfe, 0xff, 0x10, 0x02, 0xfb, 0x02, 0x02, 0x00, 0x07, 0x05, 0xbf, 0xe5,
+  0xd8, 0xda, 0x07, 0xee, 0xfd, 0xf3, 0xd0, 0xfd, 0x15, 0xe4, 0xf0, 0xeb,
+  0x0b, 0xf1, 0xff, 0xdb, 0x16, 0xec, 0xeb, 0xeb, 0x12, 0xe9, 0x12, 0xfb,
+  0xff, 0xe6, 0x09, 0xe9, 0xff, 0xeb, 0x03, 0xf7, 0xfb, 0xf9, 0xf8, 0x00,
+  0x03, 0xed, 0xc4, 0xe8, 0xe5, 0xe1, 0x00, 0xf4, 0xf2, 0x10, 0xd3, 0x02,
+  0x0c, 0xf4, 0x0e, 0xfb, 0x01, 0xfe, 0x03, 0xf1, 0x10, 0xed, 0x00, 0xfe,
+  0x00, 0xf1, 0x10, 0x00, 0xff, 0xe8, 0x0c, 0xfb, 0xff, 0xea, 0xfc, 0xfd,
+  0x00, 0x01, 0xfc, 0x03, 0x06, 0x00, 0xc7, 0xea, 0xd8, 0xe8, 0xec, 0xf6,
+  0x00, 0x06, 0xeb, 0x07, 0x02, 0xe9, 0xf8, 0xf0, 0x04, 0xf3, 0x03, 0xf8,
+  0x03, 0xf2, 0x0b, 0x14, 0xfe, 0xf0, 0x09, 0xee, 0x01, 0xec, 0x00, 0xec,
+  0x00, 0xf0, 0xf4, 0xfa, 0x00, 0xfc, 0xf8, 0xff, 0xfe, 0xed, 0xd9, 0xfc,
+  0xde, 0xed, 0xef, 0xf0, 0xff, 0xf5, 0xe9, 0x05, 0x06, 0xd9, 0x08, 0xe3,
+  0xfe, 0xe8, 0xf1, 0xf0, 0xfc, 0xf5, 0x0d, 0x03, 0xff, 0xf2, 0x03, 0xf2,
+  0xff, 0xf0, 0xf8, 0xee, 0x00, 0xef, 0xf9, 0xf5, 0x00, 0xfd, 0xf8, 0xfd,
+  0xf1, 0x02, 0xe8, 0x05, 0xe1, 0xe3, 0xf2, 0x05, 0xff, 0xf3, 0xe8, 0x0b,
+  0x00, 0xf1, 0x09, 0xe5, 0xfd, 0xe5, 0xf5, 0xfa, 0xfd, 0xe8, 0xf9, 0x02,
+  0xfb, 0xf6, 0x0b, 0xf1, 0xff, 0xea, 0x08, 0xef, 0x00, 0xfb, 0xf9, 0x00,
+  0xff, 0xf6, 0xf6, 0x00, 0xdd, 0xfe, 0xd1, 0x13, 0xec, 0xe3, 0xf2, 0xf9,
+  0xfb, 0xf5, 0xf1, 0x09, 0xff, 0xee, 0xf5, 0xed, 0xfd, 0xef, 0xf9, 0xfb,
+  0xff, 0xfc, 0xfc, 0x0c, 0xfa, 0xf2, 0xf7, 0xfb, 0x00, 0xfe, 0xfd, 0x00,
+  0x00, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xde, 0xfe, 0xd9, 0x16,
+  0xee, 0xe3, 0xe3, 0xfe, 0xfc, 0xf4, 0xff, 0xfc, 0xff, 0xf4, 0x05, 0xf1,
+  0xff, 0x00, 0xf7, 0x02, 0x00, 0xfd, 0xfc, 0xfd, 0x00, 0xfa, 0xfc, 0xfd,
+  0x00, 0xfc, 0x04, 0x01, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfc, 0x03, 0xfe,
+  0xca, 0x03, 0xe6, 0x0e, 0xf8, 0xf9, 0xeb, 0xfd, 0xfd, 0xf2, 0xee, 0xf5,
+  0x00, 0xf6, 0xff, 0xf7, 0x00, 0x03, 0xfc, 0x04, 0x00, 0x08, 0xff, 0x07,
+  0x00, 0xfd, 0xfd, 0xf9, 0x00, 0xff, 0xff, 0x01, 0x00, 0x04, 0xfe, 0xfd,
+  0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x65, 0x3c, 0x35, 0x34, 0x32, 0x25, 0xfb,
+  0x0f, 0x0f, 0x26, 0xee, 0x05, 0x24, 0x26, 0x10, 0xfb, 0xf0, 0x11, 0xe0,
+  0x03, 0xf5, 0xf8, 0xe5, 0x04, 0x0a, 0xfb, 0x0d, 0x03, 0x04, 0x0d, 0xfd,
+  0xfb, 0xfb, 0xf9, 0xf4, 0xf4, 0x14, 0xfa, 0x08, 0x45, 0xff, 0xf0, 0xef,
+  0x24, 0xfc, 0xf4, 0x04, 0x0b, 0xf6, 0xf3, 0xf8, 0x0e, 0xe4, 0x2a, 0x03,
+  0x0b, 0x09, 0x0a, 0xf7, 0x03, 0xf1, 0x0a, 0xf3, 0x04, 0xf9, 0xf1, 0x06,
+  0x03, 0x03, 0x03, 0xf5, 0x02, 0xf4, 0x03, 0xf9, 0x01, 0xfc, 0xf7, 0xf4,
+  0x43, 0xf8, 0xd1, 0xf8, 0x19, 0xd8, 0x00, 0x01, 0xf4, 0xda, 0xf1, 0xf1,
+  0x0a, 0xde, 0x12, 0xf0, 0x02, 0xf3, 0xfe, 0xef, 0x05, 0xf1, 0x00, 0xeb,
+  0x01, 0xfb, 0x00, 0x06, 0x03, 0x0c, 0x0b, 0x03, 0x02, 0x04, 0x0e, 0x0c,
+  0x01, 0x15, 0x13, 0x13, 0x2b, 0xf3, 0x16, 0x0e, 0x08, 0x0e, 0xfe, 0xf7,
+  0xc1, 0xf9, 0xdf, 0xed, 0x0f, 0xcb, 0xff, 0xe8, 0xfb, 0xf5, 0xe8, 0xf0,
+  0x09, 0xe7, 0xfc, 0xf2, 0x02, 0xf1, 0xf9, 0x01, 0x03, 0xfe, 0x02, 0xfa,
+  0x01, 0x11, 0x0c, 0x14, 0x01, 0x15, 0x00, 0x00, 0x11, 0xf7, 0xec, 0x0a,
+  0xf2, 0x02, 0x01, 0xf3, 0xc8, 0x07, 0xf2, 0xf6, 0x03, 0xde, 0xfc, 0xee,
+  0xfc, 0x16, 0xf4, 0x0f, 0x04, 0xfc, 0x1c, 0xea, 0x03, 0xf8, 0xf2, 0xf6,
+  0x03, 0xfc, 0xfd, 0x06, 0x04, 0x0f, 0x0a, 0xfc, 0x02, 0x08, 0x07, 0x01,
+  0x0c, 0xc8, 0xdc, 0xd5, 0xe4, 0xd6, 0xfd, 0xe9, 0xb8, 0xe3, 0xcc, 0xec,
+  0xf6, 0xf1, 0xfc, 0xf9, 0xfc, 0xfc, 0xf4, 0xea, 0x05, 0x0b, 0x03, 0xf0,
+  0x04, 0x08, 0x05, 0xf7, 0x02, 0x13, 0x04, 0x03, 0x02, 0x0e, 0x17, 0x00,
+  0x03, 0x05, 0xff, 0xfd, 0xeb, 0xc1, 0xd4, 0xe2, 0xd5, 0xee, 0xff, 0xf7,
+  0xe1, 0xe0, 0xf5, 0x0c, 0xf4, 0xe6, 0xfc, 0xfb, 0x07, 0x05, 0xf1, 0xf9,
+  0x11, 0xf4, 0x0d, 0x04, 0x06, 0x0a, 0x0e, 0x07, 0x05, 0x12, 0x03, 0x0a,
+  0x04, 0x0f, 0x10, 0xf8, 0x03, 0x00, 0x0c, 0xf6, 0xd9, 0xed, 0xe1, 0xf7,
+  0xb9, 0xdc, 0x0f, 0x15, 0xe5, 0xe0, 0x21, 0xff, 0xfd, 0xff, 0xf6, 0x08,
+  0x02, 0x03, 0xfe, 0xf1, 0x11, 0x04, 0xf7, 0x0c, 0x09, 0x14, 0x05, 0x02,
+  0x05, 0x1a, 0x07, 0x08, 0x04, 0x0b, 0x0c, 0xfb, 0x03, 0x02, 0x13, 0xf3,
+  0xbf, 0x1b, 0x1d, 0x07, 0xd8, 0x02, 0x0b, 0x49, 0xda, 0xf1, 0x09, 0x1a,
+  0xff, 0xfe, 0xff, 0x13, 0x02, 0x1d, 0x03, 0x0a, 0x04, 0x0f, 0x10, 0x0b,
+  0x05, 0x23, 0xfe, 0x08, 0x04, 0xff, 0xfd, 0xf3, 0x03, 0xf5, 0x0b, 0xfd,
+  0xfe, 0xf0, 0x08, 0xfc, 0xe8, 0x40, 0x1e, 0x2c, 0xe3, 0xfc, 0x16, 0x2e,
+  0xf5, 0xea, 0x2d, 0x0d, 0x06, 0x00, 0xea, 0x05, 0xfa, 0x13, 0x04, 0x04,
+  0x07, 0x0c, 0x18, 0xfd, 0x05, 0xf3, 0xfc, 0xe7, 0x08, 0xfd, 0x14, 0xf4,
+  0x08, 0xf1, 0x08, 0xed, 0x02, 0x04, 0x00, 0x0c, 0x15, 0x2a, 0x2f, 0x38,
+  0x03, 0x16, 0x0d, 0x14, 0x0e, 0x09, 0x18, 0x21, 0xf2, 0x1d, 0x27, 0x18,
+  0xfc, 0x1e, 0xeb, 0x0e, 0x18, 0x06, 0xf9, 0x0b, 0xfd, 0x07, 0xf3, 0xfe,
+  0x01, 0x16, 0xf9, 0x05, 0x01, 0x0f, 0x0c, 0xfe, 0xfd, 0x06, 0x09, 0x08,
+  0x17, 0x30, 0x1f, 0x44, 0x04, 0x0a, 0xf7, 0x2e, 0x06, 0x0d, 0x21, 0x39,
+  0x09, 0x26, 0x1e, 0x09, 0x11, 0x2a, 0xf7, 0x08, 0x15, 0x30, 0xfc, 0x09,
+  0xf9, 0x28, 0xfe, 0xf9, 0x11, 0x22, 0x11, 0x05, 0x08, 0x12, 0x03, 0xf5,
+  0x02, 0x17, 0x09, 0xfc, 0x03, 0x1e, 0x23, 0x1d, 0x01, 0x15, 0xeb, 0x2c,
+  0x0f, 0x19, 0x04, 0x1d, 0x10, 0x21, 0x25, 0x15, 0x12, 0x34, 0x05, 0x0f,
+  0x12, 0x30, 0x09, 0x10, 0x04, 0x12, 0x03, 0x11, 0x12, 0x18, 0x0a, 0x07,
+  0x03, 0x14, 0x09, 0xfa, 0x04, 0x00, 0x0f, 0x03, 0x07, 0xff, 0xef, 0x22,
+  0xfe, 0x05, 0xfb, 0x20, 0x14, 0xfa, 0xe6, 0x08, 0x20, 0x1a, 0x26, 0xf7,
+  0x24, 0x04, 0x02, 0xf7, 0x02, 0x08, 0x0f, 0xee, 0x07, 0xe8, 0xfb, 0xf5,
+  0x14, 0x02, 0x19, 0xf6, 0x03, 0x21, 0x10, 0x06, 0x03, 0x09, 0x04, 0x0c,
+  0x05, 0xfd, 0xe4, 0x1c, 0x02, 0xf7, 0x07, 0x23, 0x01, 0xf3, 0xf1, 0x17,
+  0x1a, 0x0e, 0xfa, 0xf2, 0x08, 0x07, 0xfc, 0xf0, 0x08, 0xf9, 0x12, 0x11,
+  0x04, 0xf0, 0x01, 0xf6, 0x16, 0xe6, 0xfe, 0xe3, 0x04, 0x01, 0x04, 0x00,
+  0x07, 0x1a, 0x0a, 0x07, 0x0d, 0xf5, 0xf8, 0x0d, 0x17, 0xe3, 0x0a, 0xfc,
+  0x17, 0xd5, 0xe7, 0xec, 0x07, 0xf0, 0xd6, 0xfa, 0xff, 0xdc, 0xeb, 0x0b,
+  0x0d, 0x08, 0xfd, 0x19, 0x00, 0x0c, 0x01, 0x03, 0x03, 0xfb, 0x08, 0xe9,
+  0x03, 0xfa, 0x07, 0x03, 0x06, 0xfd, 0x0a, 0xfe, 0x16, 0x11, 0xce, 0x15,
+  0x32, 0xb8, 0x1a, 0x09, 0x0c, 0xc4, 0xd7, 0xdd, 0x06, 0xd1, 0xe3, 0xe9,
+  0xf1, 0xe4, 0xdf, 0x11, 0x02, 0xff, 0xea, 0x04, 0xfd, 0xf2, 0x01, 0xf2,
+  0x07, 0xf3, 0xf8, 0xf0, 0x06, 0xff, 0xf4, 0xfe, 0x04, 0xf2, 0x11, 0x01,
+  0x14, 0x04, 0xca, 0x04, 0x43, 0xbb, 0x21, 0xf9, 0x18, 0xbd, 0xfa, 0xdf,
+  0x08, 0xcc, 0xeb, 0x26, 0xfb, 0xf0, 0xe3, 0x02, 0x05, 0x0c, 0x00, 0x0f,
+  0x0a, 0x04, 0x0d, 0xf6, 0x08, 0x00, 0x05, 0xfe, 0x0c, 0x08, 0xf8, 0xf6,
+  0x06, 0x01, 0x10, 0xfc, 0x18, 0xfb, 0xb2, 0xf1, 0x36, 0xc3, 0x0d, 0xf2,
+  0xff, 0xd7, 0x14, 0xf7, 0xf2, 0xeb, 0xe0, 0x11, 0xf6, 0xd6, 0xe3, 0xf5,
+  0xfa, 0xff, 0xe6, 0x07, 0x0a, 0xfb, 0x12, 0xf2, 0xfc, 0x16, 0x03, 0x0a,
+  0x06, 0x05, 0xf7, 0xfe, 0x03, 0x06, 0x08, 0x0b, 0x21, 0xd7, 0xb1, 0xd3,
+  0x1e, 0xcd, 0x0f, 0xf9, 0x01, 0xdb, 0x35, 0x04, 0x00, 0x0c, 0x00, 0x14,
+  0xe9, 0xd7, 0xd1, 0xe5, 0xf9, 0xde, 0xd6, 0xf0, 0xfc, 0xfa, 0xfb, 0xfe,
+  0x05, 0xf8, 0x13, 0x1d, 0x0a, 0xff, 0xfb, 0xfc, 0x0c, 0x01, 0x09, 0xff,
+  0x0f, 0xf3, 0xb9, 0xd9, 0x05, 0xe4, 0xf5, 0xfb, 0x08, 0xde, 0x25, 0xf6,
+  0x05, 0xe8, 0xe8, 0x02, 0xfa, 0xea, 0xe0, 0xfb, 0xfc, 0xd8, 0xef, 0xfa,
+  0xf7, 0x1c, 0x00, 0x10, 0x08, 0x24, 0xf9, 0x19, 0x0b, 0x02, 0x04, 0x01,
+  0x02, 0x12, 0x07, 0x03, 0xf9, 0xf5, 0x9f, 0xe0, 0xeb, 0xee, 0x0c, 0x05,
+  0x01, 0xf7, 0x1d, 0x01, 0x0b, 0xeb, 0xfa, 0x05, 0xf1, 0xed, 0x04, 0x02,
+  0x00, 0xef, 0xea, 0xf4, 0xfc, 0x08, 0xf0, 0x07, 0x03, 0x17, 0x07, 0x0c,
+  0x0a, 0x0f, 0xfe, 0x06, 0x02, 0x08, 0xec, 0x04, 0xe8, 0xfb, 0xe6, 0xe2,
+  0xef, 0xd1, 0x09, 0x18, 0x12, 0xe3, 0x31, 0x00, 0x0b, 0x04, 0xf8, 0x05,
+  0xfc, 0x10, 0x08, 0xfd, 0xfb, 0x01, 0xfb, 0x07, 0x02, 0x1a, 0xfd, 0x17,
+  0x03, 0x12, 0x04, 0x0a, 0xf5, 0x0a, 0xf6, 0x0a, 0x01, 0x0a, 0xfd, 0x02,
+  0x00, 0x09, 0xf7, 0xff, 0x0c, 0xef, 0xf3, 0x10, 0x08, 0x14, 0x14, 0xef,
+  0xf7, 0x08, 0x12, 0xfe, 0x00, 0x23, 0x00, 0x0b, 0x01, 0x31, 0x19, 0xfa,
+  0x05, 0x31, 0x01, 0x20, 0x02, 0x20, 0x06, 0x1d, 0x02, 0x1a, 0x01, 0x14,
+  0x02, 0xfc, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x3a, 0xe8, 0x4f, 0x1a, 0xfc, 0x01, 0x1f,
+  0x09, 0x2a, 0x13, 0xf1, 0x05, 0x01, 0x04, 0xf7, 0xff, 0x1b, 0x15, 0x0d,
+  0xfd, 0xfc, 0x04, 0xfc, 0xfd, 0xf8, 0xfb, 0xfc, 0xfe, 0x03, 0xf6, 0x0c,
+  0x07, 0x07, 0x15, 0x05, 0x0d, 0xec, 0x10, 0xf3, 0x09, 0xf6, 0xf9, 0x1a,
+  0xea, 0xd8, 0xd3, 0x01, 0x1c, 0xe5, 0x0f, 0xf0, 0x02, 0xe3, 0x03, 0xed,
+  0x02, 0xf9, 0xf0, 0xfe, 0xfd, 0xfd, 0xfe, 0xf2, 0xfd, 0xfb, 0x05, 0xfc,
+  0xfd, 0xde, 0xff, 0xf8, 0xfe, 0xf1, 0xfb, 0xf7, 0xff, 0xf1, 0x04, 0xfc,
+  0xef, 0x0c, 0x15, 0x14, 0x04, 0xeb, 0xdf, 0xf7, 0x13, 0xea, 0x18, 0x10,
+  0x09, 0x02, 0xf1, 0x05, 0xed, 0x0a, 0xfe, 0xf9, 0xfe, 0x09, 0x14, 0x07,
+  0xfe, 0xf9, 0x0d, 0xf7, 0xfd, 0xf9, 0xef, 0xfa, 0xff, 0xfc, 0xf6, 0xfb,
+  0xff, 0xfb, 0xfc, 0x02, 0xf8, 0x05, 0xe4, 0x04, 0x02, 0xdf, 0xee, 0xf7,
+  0xfe, 0x03, 0xec, 0x12, 0x03, 0x1d, 0x01, 0xf4, 0xff, 0x07, 0x14, 0x11,
+  0x06, 0x13, 0x11, 0xf1, 0xff, 0x0a, 0x0b, 0xe9, 0xfe, 0xfb, 0xee, 0xe7,
+  0xff, 0xf8, 0xf2, 0xf9, 0xff, 0xf9, 0x03, 0xed, 0xfb, 0xfd, 0xf9, 0x07,
+  0xee, 0xd7, 0xfe, 0xf8, 0xe8, 0xea, 0xd7, 0xf9, 0x06, 0xf2, 0xf3, 0x04,
+  0x05, 0xe5, 0xf0, 0xed, 0x05, 0xfb, 0xf1, 0x08, 0x06, 0xf9, 0x04, 0x02,
+  0xfe, 0xf2, 0xf7, 0xed, 0xfe, 0xf7, 0xfa, 0xfb, 0xfe, 0xeb, 0xfc, 0xfc,
+  0xfb, 0xfa, 0x14, 0x20, 0xd0, 0x0c, 0xd3, 0x06, 0xec, 0x19, 0x00, 0x0c,
+  0xf8, 0xf8, 0x05, 0x02, 0xff, 0x09, 0xfb, 0xf0, 0xfe, 0x07, 0x09, 0x0c,
+  0x02, 0x02, 0xfd, 0x0b, 0xfe, 0xfa, 0xfb, 0xf5, 0xff, 0xfc, 0xf4, 0x01,
+  0xfc, 0xec, 0x0d, 0xfa, 0xf8, 0xef, 0xe5, 0x0a, 0xde, 0xfa, 0x0a, 0xff,
+  0xe5, 0xf4, 0xf9, 0x05, 0xf6, 0x04, 0xfe, 0x00, 0xfc, 0x00, 0x0a, 0xf9,
+  0xf5, 0x07, 0x00, 0xfe, 0x06, 0xf8, 0xfb, 0xf0, 0xfe, 0x01, 0xfc, 0xf1,
+  0xfb, 0xef, 0xf4, 0xfe, 0xfe, 0xf5, 0x09, 0x03, 0xf4, 0xee, 0xe4, 0x0c,
+  0xfb, 0xd7, 0xeb, 0xfd, 0xe6, 0x09, 0xd7, 0x0d, 0xfa, 0x14, 0x13, 0xf9,
+  0x01, 0xe9, 0xfd, 0x09, 0x00, 0xef, 0xfa, 0xfd, 0x00, 0xf1, 0x05, 0xf9,
+  0xfe, 0xed, 0x01, 0xff, 0xfe, 0xfa, 0xf5, 0xf6, 0xfd, 0xf9, 0xfc, 0xff,
+  0xff, 0x04, 0x0d, 0x16, 0xe7, 0xdd, 0x04, 0x05, 0xf3, 0x19, 0xea, 0x00,
+  0xff, 0x0f, 0xf5, 0xe6, 0x03, 0x02, 0xe8, 0xf0, 0x00, 0xf4, 0xf6, 0x01,
+  0x00, 0xf9, 0x11, 0xf6, 0xfe, 0xf8, 0x03, 0xf6, 0xfe, 0xf5, 0xf2, 0xf2,
+  0xfe, 0xf8, 0x04, 0xff, 0xe0, 0xfa, 0xe4, 0x0e, 0xea, 0xd8, 0x0a, 0x0f,
+  0xfc, 0xfb, 0xef, 0x00, 0x07, 0xfc, 0x06, 0xed, 0xfd, 0xf3, 0xf1, 0xf1,
+  0xf9, 0xf6, 0xee, 0x07, 0x06, 0x06, 0xfe, 0xf5, 0xfd, 0x00, 0xff, 0xf2,
+  0x00, 0xf3, 0xfd, 0xfd, 0xff, 0xf9, 0xfa, 0xfc, 0xd7, 0xfe, 0x0d, 0x10,
+  0xef, 0xf4, 0xed, 0xf4, 0xfe, 0xef, 0xf8, 0xe4, 0x03, 0xf1, 0xf5, 0xeb,
+  0x00, 0xea, 0xfc, 0xf7, 0xf9, 0xf3, 0xfb, 0xfe, 0x00, 0xee, 0xf6, 0xee,
+  0xff, 0xf8, 0x01, 0xfb, 0xff, 0xfa, 0xf2, 0xfe, 0xfe, 0xfe, 0xf6, 0xfb,
+  0xe3, 0xea, 0x07, 0x01, 0xdc, 0x27, 0xc8, 0xee, 0xf9, 0xfa, 0xdb, 0xf3,
+  0x06, 0xeb, 0xf8, 0xf1, 0xf9, 0xe6, 0xf2, 0xf7, 0xfb, 0xfc, 0xfe, 0xfe,
+  0xff, 0xe8, 0xff, 0xec, 0xfe, 0xf2, 0xf9, 0xea, 0xfe, 0xfb, 0xf5, 0xf8,
+  0xfe, 0xfb, 0x09, 0xfe, 0x09, 0xe4, 0x09, 0xf6, 0xf0, 0x28, 0xf7, 0xf3,
+  0xef, 0x09, 0xcf, 0xea, 0xfc, 0xe6, 0x02, 0xee, 0xfd, 0xe5, 0xfd, 0xf9,
+  0xfd, 0xfc, 0x06, 0x00, 0xfd, 0xee, 0xef, 0xec, 0xfd, 0xe2, 0x09, 0xe2,
+  0xfd, 0xf0, 0x00, 0xf2, 0xfe, 0xfc, 0xf0, 0xfe, 0x09, 0xd9, 0xf0, 0xd9,
+  0xef, 0x18, 0x27, 0xe7, 0xe8, 0x12, 0xe6, 0xdb, 0xfb, 0xdc, 0xf1, 0xfa,
+  0xfb, 0xf4, 0x08, 0x17, 0x02, 0x18, 0x0d, 0x0a, 0xfe, 0x01, 0xed, 0xf6,
+  0xfe, 0xf2, 0xf2, 0xf8, 0xfd, 0xff, 0x03, 0x06, 0xfe, 0x04, 0xfd, 0xfe,
+  0x11, 0xee, 0xe4, 0xc9, 0xf9, 0xf1, 0x52, 0xd6, 0xfd, 0x15, 0x09, 0xf1,
+  0xfd, 0xee, 0xd7, 0xed, 0x07, 0xf6, 0x14, 0x1a, 0x09, 0x04, 0x09, 0xec,
+  0xff, 0x18, 0x11, 0x08, 0xfe, 0x07, 0xfc, 0xfe, 0xfe, 0x05, 0xf9, 0xf8,
+  0xfe, 0xfd, 0xf7, 0xfd, 0xf1, 0x0f, 0xde, 0xfb, 0xfb, 0xfe, 0x18, 0xee,
+  0x15, 0x13, 0x18, 0xf8, 0x00, 0xfa, 0xef, 0xfb, 0x01, 0x07, 0xf4, 0x08,
+  0x0d, 0xff, 0x00, 0xf0, 0x04, 0x07, 0x24, 0xfd, 0x02, 0x04, 0xf6, 0x00,
+  0xfe, 0x18, 0xf5, 0xfe, 0x00, 0x0e, 0x00, 0x00, 0xf5, 0x2b, 0xcc, 0xe5,
+  0x2b, 0xdb, 0xfb, 0xec, 0x32, 0xf0, 0xff, 0xf7, 0x09, 0xeb, 0xef, 0x05,
+  0x02, 0xe6, 0xe0, 0xfa, 0x0e, 0xf5, 0xf2, 0x03, 0x0a, 0x0c, 0xfc, 0xff,
+  0xfe, 0x09, 0x05, 0x02, 0xfe, 0x11, 0x05, 0xf7, 0x00, 0x10, 0xf9, 0xff,
+  0xfc, 0x34, 0xf9, 0x20, 0x20, 0xfd, 0xbd, 0xf7, 0x40, 0xfb, 0x0d, 0xf4,
+  0x03, 0xc0, 0xdb, 0xe8, 0xee, 0xdc, 0xdf, 0x06, 0x09, 0xde, 0xdf, 0xfc,
+  0xfc, 0x01, 0x05, 0x05, 0xfd, 0x05, 0xfa, 0xf5, 0xff, 0xfc, 0x0e, 0xfa,
+  0xff, 0x04, 0xfe, 0x08, 0xe0, 0x10, 0xdf, 0xe5, 0x0f, 0xf0, 0xce, 0xf9,
+  0x1e, 0xf4, 0xf6, 0xe4, 0xf8, 0xdd, 0xee, 0xe7, 0xf4, 0xe9, 0xed, 0xf3,
+  0xff, 0xee, 0xeb, 0xf9, 0xfd, 0x02, 0xea, 0xfd, 0xfb, 0x00, 0xf9, 0xec,
+  0xfe, 0xf9, 0x05, 0xf5, 0xff, 0xf7, 0x0b, 0xf5, 0xdb, 0xea, 0x4b, 0x0f,
+  0xd5, 0x39, 0xc3, 0xf5, 0xe8, 0x1e, 0xf8, 0xef, 0xe9, 0x04, 0x00, 0xeb,
+  0x02, 0x05, 0x01, 0x02, 0xfd, 0x25, 0x0c, 0xfa, 0x00, 0x01, 0x01, 0xfc,
+  0xfe, 0x08, 0xf1, 0xf5, 0x00, 0xf6, 0xf6, 0x04, 0xff, 0xf6, 0xf8, 0xfe,
+  0xf8, 0xf0, 0x34, 0x10, 0xbd, 0x2f, 0x03, 0xf8, 0xe1, 0x19, 0x01, 0xff,
+  0x05, 0x12, 0x13, 0xf3, 0x05, 0x1c, 0x07, 0xf1, 0xf6, 0x13, 0xe9, 0xec,
+  0xff, 0xff, 0xf2, 0xfa, 0xfe, 0xe6, 0x04, 0xf7, 0xff, 0xe6, 0xf9, 0xfe,
+  0xff, 0xf1, 0x02, 0xfd, 0x14, 0xce, 0x41, 0x17, 0xf8, 0x2e, 0x00, 0x02,
+  0xf4, 0x0d, 0xec, 0x06, 0xfc, 0x3b, 0x0a, 0x0b, 0x03, 0x24, 0x05, 0x03,
+  0xfe, 0x18, 0x21, 0xfd, 0xfc, 0xf6, 0xec, 0xf4, 0xfe, 0xee, 0xf8, 0xf4,
+  0xff, 0xf3, 0xfe, 0x03, 0xfe, 0xf3, 0xfc, 0x03, 0x3f, 0xdf, 0x1e, 0x10,
+  0x18, 0x03, 0x19, 0xff, 0xf9, 0xf7, 0xd7, 0xfa, 0xf4, 0x02, 0x00, 0xef,
+  0xf8, 0xfc, 0xf7, 0xf9, 0xfb, 0x00, 0x01, 0xe4, 0xff, 0xe9, 0xf5, 0xea,
+  0xfe, 0xed, 0xf6, 0xfb, 0xfc, 0xf7, 0x00, 0x05, 0xff, 0xfe, 0x0d, 0x05,
+  0x39, 0xe2, 0xf0, 0xfc, 0x3d, 0xff, 0x51, 0xf1, 0x0e, 0x02, 0xef, 0x07,
+  0xfb, 0x0b, 0x0a, 0x09, 0xfd, 0xf6, 0xed, 0x19, 0xff, 0xf3, 0x04, 0x00,
+  0xfd, 0xe2, 0xfc, 0xe3, 0xfe, 0xf6, 0xed, 0xec, 0xfe, 0xf7, 0xff, 0x01,
+  0xff, 0x01, 0xfc, 0x06, 0x2e, 0xe2, 0xf9, 0xf4, 0x20, 0x1c, 0x2f, 0xf8,
+  0xf3, 0x28, 0xeb, 0x02, 0x05, 0xd5, 0xfe, 0xda, 0xfa, 0x09, 0xe5, 0x10,
+  0xff, 0x03, 0x01, 0x0e, 0xfd, 0xec, 0x04, 0xf1, 0x00, 0xe9, 0xf5, 0xfc,
+  0x00, 0x02, 0xff, 0xff, 0xf8, 0xe9, 0xef, 0xf6, 0x28, 0xfa, 0xf9, 0xec,
+  0x32, 0x06, 0x1e, 0xdd, 0x18, 0x18, 0x22, 0xeb, 0xf2, 0xf4, 0xf9, 0xee,
+  0x05, 0x03, 0xfc, 0x14, 0xfd, 0x1a, 0xfc, 0x14, 0xfd, 0x0a, 0x0c, 0xf7,
+  0x00, 0xf3, 0xfc, 0xfa, 0x00, 0x0b, 0x04, 0x0b, 0x00, 0x06, 0x05, 0x01,
+  0x14, 0x08, 0xdc, 0xdb, 0x2d, 0xe0, 0x35, 0xe7, 0x30, 0x1a, 0x26, 0xea,
+  0xf5, 0x00, 0xf3, 0x04, 0x00, 0x06, 0x05, 0x0d, 0x03, 0x07, 0xef, 0xfe,
+  0x09, 0x09, 0x18, 0x0e, 0xff, 0xf2, 0xf4, 0xea, 0x00, 0xf7, 0xf7, 0xfe,
+  0x00, 0xfb, 0xff, 0xf9, 0xf1, 0x29, 0xd2, 0xe9, 0x12, 0xc9, 0x1b, 0x0a,
+  0x41, 0x13, 0x35, 0xf0, 0x01, 0x13, 0xff, 0x0b, 0x09, 0x10, 0x0b, 0x12,
+  0x09, 0x08, 0x10, 0xf5, 0x07, 0x15, 0x10, 0xff, 0xff, 0x05, 0xf8, 0xf8,
+  0xff, 0x03, 0xfa, 0xf5, 0x00, 0xeb, 0x14, 0xf8, 0xe9, 0x3d, 0xe7, 0xed,
+  0x18, 0xcf, 0xe1, 0xf7, 0x33, 0xe9, 0x2c, 0xf5, 0x0c, 0xf9, 0x03, 0x04,
+  0x0a, 0xd5, 0xff, 0xeb, 0x03, 0xf7, 0xe6, 0xee, 0x10, 0x07, 0x05, 0xfc,
+  0x04, 0x0b, 0x0d, 0x02, 0xff, 0x15, 0x00, 0x10, 0x00, 0x05, 0x09, 0xfb,
+  0xe1, 0x2f, 0xf6, 0x14, 0x22, 0xfd, 0xd2, 0xf9, 0x3b, 0xf8, 0x1b, 0x05,
+  0x06, 0xdb, 0x1e, 0xec, 0x06, 0xe6, 0xfe, 0xf8, 0xfa, 0xdd, 0xf0, 0xf2,
+  0x00, 0x01, 0xfc, 0xec, 0x04, 0xe8, 0xfe, 0xf6, 0xff, 0xed, 0xed, 0x06,
+  0x00, 0xf0, 0x01, 0xf8, 0x01, 0x0f, 0x2a, 0x2d, 0xff, 0x27, 0xce, 0xff,
+  0x12, 0x04, 0x05, 0x1f, 0xed, 0x0f, 0x22, 0xed, 0xf8, 0x01, 0xff, 0xec,
+  0xfe, 0x04, 0xf0, 0x03, 0x00, 0x08, 0x01, 0xef, 0xfe, 0xf8, 0xf5, 0x00,
+  0x00, 0xfc, 0xfa, 0x08, 0x00, 0x10, 0xfd, 0x0a, 0x02, 0xee, 0x33, 0x09,
+  0xdc, 0x55, 0xae, 0xda, 0xe1, 0xfd, 0xe1, 0x07, 0xde, 0x0e, 0x0e, 0xdf,
+  0xf7, 0xf6, 0xfd, 0x03, 0x08, 0x1b, 0x0d, 0x06, 0x0c, 0xfe, 0x07, 0x06,
+  0x05, 0xff, 0x06, 0x08, 0xff, 0x05, 0xf6, 0x04, 0x00, 0x03, 0x04, 0x07,
+  0x14, 0xde, 0x37, 0x1f, 0xcf, 0x5d, 0xe2, 0xe0, 0xd2, 0x24, 0xe4, 0x07,
+  0xed, 0xf4, 0x1f, 0xe3, 0x02, 0x13, 0xf4, 0xf6, 0xff, 0xef, 0xfa, 0xef,
+  0x10, 0xe9, 0x04, 0xee, 0x0b, 0xfd, 0x06, 0xff, 0xff, 0xe0, 0x04, 0xe7,
+  0x03, 0x02, 0xfa, 0xef, 0x1a, 0xc8, 0x1c, 0xfb, 0xe3, 0x33, 0x34, 0xf2,
+  0xc6, 0x2e, 0xe4, 0xec, 0x00, 0xf8, 0x15, 0xf2, 0x01, 0x1e, 0x05, 0xf4,
+  0x05, 0xd5, 0xff, 0xf6, 0x00, 0xfe, 0xfe, 0xf7, 0x04, 0xef, 0xf3, 0x02,
+  0xfb, 0xec, 0x01, 0xf0, 0xff, 0xef, 0xe0, 0xf2, 0x28, 0xe5, 0xde, 0xd7,
+  0xfa, 0xdc, 0x45, 0xf4, 0xd4, 0x40, 0xfa, 0xee, 0x1d, 0x24, 0x14, 0xf5,
+  0x1b, 0x1c, 0x22, 0x01, 0xf6, 0x03, 0x0d, 0xf4, 0x06, 0x0d, 0x07, 0x02,
+  0xfb, 0xfd, 0x0a, 0x10, 0xff, 0xef, 0x0a, 0x05, 0xfe, 0xf8, 0xed, 0xf7,
+  0x22, 0x06, 0xcc, 0xd2, 0x00, 0xd3, 0x2d, 0xe9, 0x22, 0x21, 0x12, 0x05,
+  0x05, 0x07, 0x00, 0x0a, 0x07, 0x10, 0x20, 0x2e, 0xf9, 0x00, 0x1d, 0xf7,
+  0x11, 0xff, 0x1b, 0x08, 0xf4, 0xe9, 0xf1, 0xfb, 0xf9, 0xef, 0xfd, 0x0b,
+  0x00, 0xee, 0x11, 0x09, 0x0f, 0x2a, 0xb6, 0x00, 0x27, 0xce, 0x0b, 0xdf,
+  0x4f, 0xf4, 0x10, 0x06, 0x11, 0xe5, 0xfd, 0xfa, 0xfc, 0xd9, 0x05, 0xe8,
+  0xf9, 0xed, 0xfa, 0xf8, 0x03, 0xf6, 0x0b, 0xf6, 0xf4, 0xe5, 0xff, 0xee,
+  0xff, 0xec, 0xf9, 0x04, 0xff, 0xfa, 0xf4, 0x00, 0x02, 0x3f, 0xd3, 0x08,
+  0x28, 0xe2, 0xed, 0xf4, 0x38, 0xd9, 0x0c, 0xf9, 0x02, 0xe3, 0xf2, 0xea,
+  0xf2, 0xeb, 0x01, 0xfe, 0x04, 0xe3, 0xfc, 0xf0, 0xfe, 0x16, 0x0a, 0x09,
+  0xee, 0x02, 0x0f, 0xf4, 0xff, 0xfb, 0xf3, 0x02, 0xff, 0xfd, 0xfb, 0xf9,
+  0xe9, 0x19, 0x15, 0x14, 0xf8, 0x0c, 0xd9, 0xf6, 0x22, 0xf8, 0xf9, 0x08,
+  0xf9, 0xf0, 0x18, 0x0b, 0x02, 0xef, 0x03, 0x10, 0x01, 0xf6, 0xf0, 0x02,
+  0x05, 0xfb, 0x06, 0xff, 0xef, 0x00, 0x0c, 0xf4, 0xff, 0xea, 0x00, 0xff,
+  0xff, 0xeb, 0xfa, 0x00, 0xd8, 0x08, 0x13, 0x33, 0xd2, 0x1f, 0xde, 0x06,
+  0xf6, 0x1e, 0x16, 0x05, 0x05, 0x1f, 0x23, 0x06, 0x06, 0x18, 0x0a, 0xf0,
+  0xf5, 0xf5, 0x02, 0xff, 0x09, 0x03, 0xfe, 0xef, 0xff, 0xe8, 0x05, 0xec,
+  0xff, 0xf6, 0xfa, 0xf4, 0x00, 0xf8, 0xf2, 0x01, 0xe8, 0x07, 0x32, 0x29,
+  0xd0, 0x08, 0xf5, 0xef, 0xee, 0x26, 0x0d, 0x06, 0x11, 0x26, 0x15, 0xea,
+  0x0c, 0x19, 0x04, 0x06, 0x00, 0x0a, 0x11, 0xf3, 0x0a, 0xed, 0x02, 0xf9,
+  0xfe, 0xdf, 0x03, 0xe7, 0x00, 0xdb, 0xf8, 0xf1, 0x00, 0xed, 0xee, 0xff,
+  0x09, 0x1a, 0xf5, 0x06, 0xcb, 0x09, 0xdb, 0xfc, 0xea, 0x1e, 0xe5, 0x07,
+  0x0e, 0x1c, 0x23, 0xfe, 0xfa, 0x18, 0x13, 0x03, 0x01, 0x0e, 0x0e, 0xfe,
+  0xfb, 0x12, 0x02, 0x05, 0xf7, 0xe7, 0x09, 0xfa, 0xfa, 0xef, 0xf9, 0x09,
+  0x00, 0xfc, 0xf3, 0xfb, 0x0c, 0x16, 0x07, 0x07, 0xd1, 0x17, 0xeb, 0x02,
+  0x00, 0x0e, 0xd2, 0x08, 0x03, 0x03, 0x15, 0xee, 0xf7, 0x11, 0x13, 0xfc,
+  0x11, 0x22, 0x1c, 0x11, 0x00, 0x14, 0x09, 0x08, 0xfb, 0xe8, 0x0b, 0xfc,
+  0xfe, 0xf6, 0xfa, 0x04, 0xff, 0xf7, 0xf9, 0xfd, 0x1c, 0x03, 0xfd, 0x00,
+  0xee, 0xf5, 0xfe, 0xf9, 0xfa, 0x04, 0xd1, 0xff, 0x04, 0xe6, 0xe4, 0xf9,
+  0xf7, 0x01, 0x18, 0xfe, 0xff, 0x18, 0x10, 0x18, 0x0b, 0x1f, 0x15, 0x0d,
+  0xfb, 0x13, 0x0f, 0xf6, 0xfe, 0xf4, 0x02, 0x04, 0xff, 0xf7, 0xfb, 0xfc,
+  0x0f, 0xe2, 0xf2, 0xf6, 0x02, 0xee, 0x09, 0x03, 0xf4, 0xfc, 0xd8, 0x07,
+  0xf0, 0xfc, 0xf2, 0xfc, 0xf2, 0x06, 0x09, 0xfc, 0x04, 0x1e, 0x03, 0x0b,
+  0x12, 0xf9, 0x14, 0xfb, 0xfc, 0xf0, 0xff, 0xec, 0xff, 0xfb, 0x03, 0xfb,
+  0xff, 0xf7, 0x00, 0xff, 0x03, 0xe9, 0xd6, 0xf8, 0xe7, 0xdf, 0xfb, 0xf3,
+  0xe7, 0x06, 0xf1, 0x05, 0xee, 0x05, 0xef, 0x0b, 0xff, 0x16, 0xef, 0xf1,
+  0x0b, 0x01, 0x07, 0x11, 0x10, 0x00, 0x10, 0x01, 0x00, 0xfa, 0x06, 0xf8,
+  0x00, 0xf5, 0x04, 0x09, 0xff, 0xfb, 0x00, 0x00, 0x04, 0xe1, 0xcd, 0xda,
+  0xe3, 0xdc, 0x00, 0xf5, 0xec, 0x05, 0xe9, 0x0d, 0xfe, 0xfd, 0x03, 0x08,
+  0x03, 0x05, 0xe4, 0x03, 0x0d, 0xf5, 0xfb, 0x00, 0xfe, 0xfa, 0x04, 0xfe,
+  0x00, 0xf4, 0x0e, 0xf7, 0x00, 0xfe, 0x02, 0xfb, 0x00, 0xfd, 0xff, 0xfe,
+  0xe7, 0xe2, 0xcc, 0xed, 0xe1, 0xe7, 0xf6, 0xf9, 0xf5, 0xfb, 0xe6, 0x00,
+  0x06, 0xf2, 0xf5, 0x09, 0x00, 0x00, 0x00, 0xff, 0x06, 0xec, 0xee, 0xf9,
+  0xfd, 0xec, 0x04, 0xfc, 0xff, 0x00, 0x03, 0xfb, 0x00, 0xfb, 0x02, 0xfd,
+  0xff, 0xfa, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xe8, 0x03, 0xea, 0xff, 0xf3, 0xed, 0xf0,
+  0x06, 0xe7, 0x07, 0xe4, 0xfb, 0xf1, 0xf5, 0xf7, 0x00, 0x03, 0xf3, 0xf6,
+  0x01, 0x05, 0xfb, 0xfd, 0x01, 0x00, 0x03, 0xfc, 0x00, 0x03, 0x03, 0x00,
+  0x00, 0x08, 0x05, 0x03, 0x00, 0x05, 0x04, 0x01, 0xf6, 0xec, 0xdd, 0xf2,
+  0xf9, 0xd7, 0xea, 0xf9, 0x06, 0xe3, 0xf7, 0xea, 0x00, 0xde, 0xf8, 0xf7,
+  0x00, 0xe7, 0xed, 0xf2, 0x01, 0xfb, 0x02, 0xfe, 0x01, 0x0c, 0xfb, 0x00,
+  0x00, 0x05, 0xf9, 0x07, 0x00, 0x09, 0x02, 0x01, 0x00, 0x07, 0xfd, 0x00,
+  0xe3, 0xf5, 0xfa, 0x01, 0xec, 0xee, 0xec, 0x08, 0x02, 0xec, 0xef, 0xff,
+  0xfd, 0xed, 0xfa, 0x03, 0xf8, 0xf0, 0xf1, 0x04, 0x01, 0xf4, 0x02, 0xfd,
+  0x01, 0x07, 0xf8, 0xfc, 0x01, 0x07, 0x04, 0x00, 0x00, 0x06, 0x01, 0x00,
+  0x00, 0x08, 0x02, 0x00, 0xd3, 0xe1, 0xfb, 0xeb, 0xd3, 0xf8, 0xca, 0x04,
+  0xe2, 0x00, 0xfa, 0x0a, 0xf6, 0x00, 0x07, 0x0c, 0x02, 0x04, 0xf2, 0x18,
+  0x00, 0x02, 0xf8, 0x12, 0xfb, 0x19, 0xfb, 0x0b, 0xfc, 0x03, 0xfd, 0x15,
+  0x00, 0x19, 0x03, 0x13, 0x00, 0x12, 0x06, 0x15, 0xdc, 0xd5, 0xe4, 0xd8,
+  0xc0, 0xea, 0xc8, 0xfa, 0xe1, 0xfd, 0xeb, 0x0c, 0xfd, 0xe7, 0xf0, 0x05,
+  0x00, 0x0d, 0xdd, 0x0d, 0xfd, 0x00, 0x05, 0x07, 0xff, 0x0f, 0x11, 0x17,
+  0xfb, 0x20, 0x03, 0x0f, 0x00, 0x1d, 0xfa, 0x02, 0x00, 0x17, 0xfb, 0x02,
+  0xea, 0xd0, 0x19, 0xf3, 0xc2, 0xf9, 0xcd, 0xfb, 0xd6, 0xeb, 0xf8, 0xfd,
+  0xfc, 0xf3, 0xf7, 0xfd, 0xe9, 0x05, 0xec, 0xdd, 0xfd, 0x10, 0xf8, 0x04,
+  0x06, 0x23, 0x10, 0x14, 0xfc, 0x28, 0x0c, 0x0c, 0x00, 0x23, 0x16, 0x02,
+  0x00, 0x15, 0x15, 0x18, 0xd3, 0xf5, 0x17, 0x17, 0xbb, 0xfd, 0xf4, 0x1e,
+  0xe0, 0xe3, 0x04, 0x00, 0x01, 0xff, 0xfc, 0x08, 0x00, 0xf8, 0x11, 0x08,
+  0x09, 0x14, 0x01, 0x04, 0x0c, 0x16, 0x07, 0x07, 0x04, 0x1a, 0x11, 0x10,
+  0x01, 0x1f, 0x12, 0x07, 0x02, 0x02, 0x0e, 0x04, 0xfc, 0x1a, 0x0a, 0x1c,
+  0xed, 0xfc, 0xfc, 0xff, 0xfb, 0xeb, 0x23, 0x1d, 0x0a, 0x2b, 0x13, 0x17,
+  0xfd, 0x0e, 0x11, 0x02, 0x08, 0x0a, 0xf7, 0x0a, 0x09, 0xfa, 0x05, 0x03,
+  0x01, 0x0c, 0x0e, 0x06, 0x02, 0x12, 0x05, 0xff, 0x00, 0x03, 0x08, 0x02,
+  0x11, 0x33, 0x31, 0x04, 0xe9, 0x26, 0xfa, 0x17, 0x0b, 0x1c, 0x3b, 0x1e,
+  0x14, 0x36, 0x46, 0xff, 0x0a, 0x0d, 0x0f, 0xe2, 0xff, 0x1b, 0x00, 0x10,
+  0xfe, 0x0b, 0x10, 0x15, 0x00, 0x00, 0x02, 0xfb, 0x01, 0x13, 0x04, 0x11,
+  0x00, 0xf7, 0x06, 0x03, 0x22, 0x19, 0x37, 0x1c, 0x06, 0x29, 0x0f, 0x1b,
+  0x0f, 0x11, 0x0b, 0x24, 0x29, 0x2a, 0x3c, 0xff, 0x00, 0x12, 0x1e, 0xf9,
+  0xfd, 0x1c, 0x03, 0x18, 0x02, 0xfa, 0x01, 0x15, 0x02, 0x01, 0x12, 0x07,
+  0x00, 0xfc, 0x0e, 0x0a, 0x00, 0x11, 0x12, 0x0f, 0x20, 0x02, 0x48, 0x05,
+  0x0d, 0x56, 0xe9, 0x09, 0x11, 0x25, 0x04, 0x1c, 0x19, 0x21, 0x3a, 0x07,
+  0xf7, 0x1e, 0x0e, 0xe0, 0x18, 0x26, 0x09, 0x16, 0x00, 0x04, 0xf7, 0xf9,
+  0x03, 0x04, 0xed, 0xeb, 0x00, 0x15, 0x00, 0xfc, 0x00, 0x13, 0x14, 0x08,
+  0x13, 0x08, 0x32, 0xfa, 0xf4, 0x2f, 0xe7, 0x0c, 0xf6, 0x0e, 0xc8, 0x14,
+  0x26, 0x09, 0x25, 0xee, 0x12, 0x09, 0x14, 0xcc, 0x11, 0x0d, 0xf2, 0x04,
+  0xf6, 0xf0, 0x05, 0xf0, 0x09, 0x04, 0xfd, 0xe4, 0x09, 0xfd, 0x04, 0xf9,
+  0x00, 0x11, 0xf7, 0x03, 0x10, 0xf9, 0x08, 0xe2, 0xe9, 0x17, 0xe6, 0x04,
+  0xcc, 0xf4, 0xbf, 0x0b, 0x15, 0xda, 0x1a, 0xe0, 0x1d, 0xf9, 0x08, 0xdc,
+  0x08, 0x0d, 0xf9, 0x12, 0x0c, 0xf7, 0x10, 0x05, 0x0c, 0x02, 0xfe, 0xf6,
+  0x00, 0x0a, 0x05, 0x01, 0x00, 0x07, 0xfb, 0x05, 0xf5, 0xd5, 0xe1, 0xd9,
+  0xdd, 0xdd, 0x11, 0x09, 0xc4, 0xd4, 0xaa, 0xfc, 0x0e, 0xd3, 0xf9, 0xdb,
+  0x20, 0xe1, 0xdf, 0xe8, 0x05, 0x13, 0xfe, 0x11, 0x10, 0xf4, 0xff, 0x12,
+  0x10, 0x03, 0xfa, 0x07, 0x00, 0x0f, 0x0e, 0x0a, 0x00, 0x08, 0xfe, 0x07,
+  0xe2, 0xe9, 0xc6, 0xdf, 0xd6, 0xde, 0x01, 0xfa, 0xac, 0xd2, 0xc4, 0x0c,
+  0xfc, 0xdd, 0xd8, 0xe9, 0xfc, 0xf6, 0xe1, 0xf6, 0xfd, 0x0a, 0xf4, 0x08,
+  0xff, 0x00, 0xf5, 0x00, 0x10, 0x0d, 0xee, 0xfd, 0x01, 0x13, 0xfe, 0xf8,
+  0x05, 0x16, 0x00, 0x01, 0xbe, 0xd6, 0x13, 0xe8, 0xd5, 0xe7, 0x00, 0x05,
+  0xc3, 0xdb, 0xd8, 0x04, 0xe1, 0xd7, 0xbf, 0xed, 0x00, 0xec, 0xdd, 0xff,
+  0xfe, 0xfe, 0xfb, 0x01, 0x00, 0x04, 0xfb, 0x0f, 0x00, 0x12, 0xfe, 0x00,
+  0x00, 0x0c, 0x00, 0xf5, 0x04, 0x05, 0xfc, 0xf8, 0xc6, 0xf8, 0xf5, 0x01,
+  0x0a, 0xe2, 0x20, 0x0c, 0xc8, 0xe2, 0xeb, 0xf1, 0xe2, 0xef, 0xd4, 0xf1,
+  0xfd, 0xec, 0xe3, 0x0a, 0x10, 0xf0, 0xed, 0x06, 0x03, 0xfe, 0xf3, 0x02,
+  0x01, 0x10, 0xfc, 0xfc, 0x00, 0x03, 0xf6, 0xf7, 0x03, 0xf9, 0xfc, 0x03,
+  0xe6, 0x26, 0x13, 0x3b, 0x1d, 0xea, 0x02, 0x0d, 0xeb, 0xf2, 0x1f, 0xf1,
+  0xeb, 0xed, 0xc3, 0x1a, 0xfd, 0xd1, 0xf2, 0xf9, 0x03, 0xf9, 0xf3, 0xfa,
+  0x05, 0xfe, 0xfb, 0x02, 0x10, 0x01, 0x01, 0xfe, 0x02, 0x02, 0x00, 0x0c,
+  0x00, 0x07, 0x05, 0x03, 0xf9, 0x34, 0x0e, 0x43, 0x31, 0x21, 0xfd, 0x2a,
+  0xed, 0x08, 0x39, 0xe7, 0xf5, 0xd4, 0xc8, 0x12, 0xf8, 0xd8, 0xef, 0xfb,
+  0xec, 0xec, 0xe3, 0xf8, 0x01, 0xfd, 0xf2, 0x09, 0xfb, 0x0a, 0xf8, 0x00,
+  0x01, 0x04, 0xfc, 0x00, 0x00, 0xf5, 0x01, 0x07, 0xf1, 0x14, 0x24, 0x3a,
+  0x1d, 0x1d, 0x05, 0x17, 0xf5, 0x0b, 0x2a, 0xed, 0xf1, 0x07, 0xf3, 0x18,
+  0xef, 0x06, 0xff, 0x10, 0xeb, 0xf9, 0xee, 0x03, 0xf6, 0x05, 0xf5, 0xf9,
+  0x07, 0x02, 0xf9, 0x13, 0x00, 0x00, 0xf6, 0xf8, 0x00, 0xf8, 0xfc, 0xfe,
+  0xf6, 0x02, 0xfb, 0x0c, 0x15, 0x0c, 0xfc, 0x02, 0xfc, 0xfc, 0x2d, 0xf7,
+  0xf9, 0x1d, 0xfe, 0x07, 0x01, 0xfc, 0x00, 0x0a, 0xee, 0xf6, 0xf8, 0x0c,
+  0xe5, 0x1a, 0xf0, 0x09, 0x04, 0x05, 0x0e, 0x09, 0x00, 0x00, 0xf5, 0xfe,
+  0x00, 0x09, 0x00, 0x02, 0x09, 0xf5, 0xed, 0x04, 0xfb, 0xe1, 0xf0, 0x07,
+  0x05, 0x01, 0xfe, 0xfb, 0xfc, 0xff, 0x11, 0xf0, 0x06, 0xee, 0x12, 0x05,
+  0xf5, 0x08, 0xf7, 0x18, 0xed, 0x07, 0x00, 0x07, 0x00, 0x01, 0xf9, 0x00,
+  0x00, 0xf6, 0xfe, 0x01, 0x00, 0x06, 0xe9, 0xf9, 0xe1, 0xf2, 0xd7, 0xef,
+  0x19, 0xeb, 0xe8, 0xfd, 0xe8, 0xf5, 0xeb, 0xec, 0xfe, 0xe5, 0x01, 0xea,
+  0xfb, 0xf1, 0x0e, 0xf8, 0xf3, 0x07, 0xfc, 0x10, 0x01, 0x10, 0x06, 0x04,
+  0x05, 0xf7, 0xf7, 0xfd, 0xf2, 0x00, 0xf8, 0xff, 0x00, 0x03, 0xfc, 0xff,
+  0xfb, 0xed, 0xd4, 0xed, 0xfe, 0xe7, 0xf0, 0x09, 0xe9, 0xfd, 0xe4, 0x00,
+  0xf2, 0x01, 0xf3, 0xf7, 0xfe, 0x13, 0x0a, 0x0e, 0xf8, 0x15, 0xfe, 0xfa,
+  0x01, 0x06, 0xef, 0x05, 0x00, 0x05, 0x02, 0x02, 0x00, 0xfc, 0x04, 0xf4,
+  0x00, 0xfa, 0x08, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd6, 0xe3, 0xd5, 0xee, 0xfc, 0xed, 0xf0, 0x0b,
+  0x00, 0x07, 0x03, 0x0a, 0x00, 0x07, 0x08, 0xfd, 0xf8, 0xf7, 0xf9, 0x01,
+  0x00, 0xfd, 0xfc, 0x14, 0x00, 0xfd, 0x07, 0x08, 0x00, 0xfd, 0x03, 0x08,
+  0x00, 0x06, 0x06, 0x06, 0xf8, 0xf3, 0x0d, 0xf8, 0xcf, 0x0a, 0xf4, 0x0a,
+  0xfd, 0xe0, 0xfa, 0xfb, 0xfd, 0xf9, 0xf2, 0x03, 0x00, 0x07, 0xf6, 0x03,
+  0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0xf5, 0xfc, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x02, 0xfe, 0x07, 0x00, 0x0a, 0x00, 0xff, 0x00, 0x00, 0x04, 0x01,
+  0xc7, 0xf8, 0xf0, 0xf9, 0xe7, 0x0e, 0xe8, 0x02, 0xfe, 0x0a, 0x0b, 0x1b,
+  0x00, 0x0c, 0x05, 0x15, 0x00, 0x0f, 0x04, 0x0c, 0x00, 0xfc, 0x06, 0x11,
+  0x00, 0x0d, 0x00, 0x06, 0x00, 0xf4, 0x00, 0x06, 0x00, 0xec, 0xf9, 0x01,
+  0x00, 0x00, 0x01, 0x0d, 0xd2, 0x10, 0xe9, 0x06, 0xe4, 0xfb, 0xed, 0x01,
+  0xfa, 0x08, 0xe9, 0x0a, 0x00, 0x05, 0xfc, 0xfe, 0x00, 0x12, 0x02, 0x07,
+  0x00, 0x0b, 0x07, 0x08, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0c, 0xfa, 0xf7,
+  0x00, 0x0c, 0xfb, 0xf0, 0x00, 0x0b, 0x13, 0xf7, 0xcd, 0x09, 0xce, 0xff,
+  0xe6, 0xe8, 0xe6, 0xf6, 0xf5, 0xef, 0xf8, 0xee, 0xff, 0x05, 0xf1, 0x08,
+  0xff, 0xf9, 0xfe, 0xfc, 0x00, 0x0e, 0xf7, 0x1a, 0x00, 0xfc, 0x08, 0xfc,
+  0x00, 0xf9, 0x01, 0xfa, 0x00, 0xf7, 0xfb, 0xfb, 0x00, 0xfc, 0xfc, 0x06,
+  0xd9, 0xff, 0xe3, 0xfc, 0xdf, 0xf5, 0xec, 0xf2, 0xf7, 0xf7, 0xfa, 0x0a,
+  0xfc, 0xf4, 0x01, 0xf8, 0x00, 0x05, 0xf4, 0xfb, 0xff, 0x00, 0xf8, 0x08,
+  0x00, 0xff, 0xfc, 0x04, 0xff, 0x02, 0x02, 0x0e, 0x00, 0x0c, 0xf8, 0x14,
+  0x00, 0x01, 0x04, 0x00, 0xc5, 0xfb, 0xf2, 0x08, 0xd6, 0xee, 0xca, 0x08,
+  0xf6, 0xf1, 0xf0, 0x07, 0xfa, 0xfe, 0xfa, 0xf7, 0xfe, 0xf5, 0xf6, 0xf5,
+  0x00, 0xf3, 0xf5, 0xea, 0x00, 0xfe, 0xef, 0xef, 0xff, 0x07, 0xf7, 0xf9,
+  0x00, 0xff, 0xf7, 0x0c, 0x00, 0x0d, 0x03, 0x00, 0x05, 0xbd, 0xee, 0xd5,
+  0xe8, 0x06, 0xcb, 0xcb, 0xec, 0xd3, 0xd8, 0x03, 0xfa, 0xe9, 0x09, 0xf0,
+  0xfe, 0xdd, 0xef, 0xfe, 0xfb, 0xee, 0xf3, 0x00, 0xff, 0xee, 0xf9, 0xfc,
+  0x00, 0xee, 0xee, 0xfb, 0x00, 0xf7, 0xf3, 0x05, 0x00, 0xfd, 0xf7, 0x01,
+  0x04, 0xcc, 0xf0, 0xcf, 0xdf, 0x12, 0xbe, 0xcf, 0xe3, 0xe5, 0xdb, 0xff,
+  0xfb, 0xf6, 0xfb, 0x00, 0xfe, 0xf6, 0xf3, 0xe8, 0x00, 0xfa, 0xef, 0x09,
+  0xff, 0xff, 0xfb, 0x05, 0x00, 0xf1, 0xf7, 0xef, 0x00, 0xff, 0xf3, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x18, 0x9b, 0xf9, 0xd0, 0xf6, 0x2e, 0xf0, 0xcd,
+  0xea, 0xec, 0xc7, 0x10, 0xfb, 0xe3, 0x0c, 0xea, 0xfd, 0xe7, 0xf9, 0xd5,
+  0x00, 0xed, 0xf4, 0xf8, 0x00, 0xe6, 0xf4, 0xf2, 0x00, 0xdf, 0x09, 0xe8,
+  0x00, 0x01, 0xff, 0x03, 0x00, 0xff, 0xfb, 0x00, 0x12, 0xa1, 0xf9, 0xbe,
+  0x05, 0x1e, 0x38, 0xcf, 0xd2, 0xfd, 0xd9, 0xe4, 0x02, 0xde, 0xe9, 0xdb,
+  0x02, 0xe2, 0x03, 0xe8, 0xfe, 0xdf, 0xf8, 0xf0, 0x00, 0xea, 0x0c, 0xff,
+  0x00, 0xdc, 0x03, 0xf7, 0x00, 0xfb, 0xf6, 0x09, 0x00, 0x01, 0xfd, 0xfd,
+  0x2b, 0xaf, 0xdd, 0xad, 0x04, 0x29, 0x47, 0xda, 0xde, 0x25, 0xf0, 0xdb,
+  0xf7, 0xe9, 0xee, 0xff, 0xff, 0x0d, 0x13, 0x13, 0xfb, 0x03, 0x12, 0x0e,
+  0xff, 0xf5, 0x10, 0x05, 0x00, 0xfd, 0xff, 0xf1, 0xff, 0x0f, 0xff, 0x10,
+  0x00, 0xee, 0xfc, 0xf9, 0x1c, 0xc5, 0xc8, 0xb8, 0x23, 0xf0, 0x4e, 0xd3,
+  0x05, 0x26, 0x1a, 0xd8, 0x0e, 0x08, 0xec, 0x01, 0x07, 0x0a, 0x0b, 0x07,
+  0xfe, 0xf1, 0x0f, 0xf6, 0x0d, 0xfa, 0x0a, 0xfb, 0x00, 0xe4, 0xf9, 0xec,
+  0xff, 0xfb, 0xf9, 0x12, 0xfe, 0x00, 0xf7, 0x02, 0x04, 0xe3, 0xe4, 0xd5,
+  0x3b, 0xdd, 0x5c, 0xe8, 0x43, 0x05, 0x2a, 0xce, 0x0a, 0xec, 0xe8, 0x16,
+  0x05, 0xed, 0x0c, 0x0d, 0x10, 0xe9, 0xec, 0xef, 0x0e, 0x10, 0x1f, 0x07,
+  0x00, 0xec, 0xea, 0xfb, 0x00, 0xf3, 0xf5, 0x08, 0x00, 0xfc, 0xfe, 0xf9,
+  0x1a, 0x36, 0xbf, 0xe1, 0x4b, 0xc0, 0x0e, 0xf3, 0x60, 0xff, 0x3c, 0xf0,
+  0xff, 0xe3, 0xd5, 0x12, 0x03, 0xf6, 0xfc, 0x1f, 0xf1, 0xfe, 0x09, 0xef,
+  0xf7, 0x1d, 0xfd, 0x09, 0xfb, 0x08, 0x0c, 0x0b, 0xff, 0x07, 0xfc, 0x09,
+  0xfd, 0xf2, 0xfa, 0xfa, 0x0a, 0x2d, 0xc1, 0xe5, 0x3f, 0xd3, 0xca, 0xee,
+  0x5a, 0xe4, 0x2a, 0x07, 0x01, 0xb9, 0xe6, 0xe4, 0x05, 0xc1, 0xdc, 0xf6,
+  0xf0, 0xe7, 0xfe, 0x00, 0x07, 0xfb, 0x02, 0xf8, 0x01, 0xf2, 0xff, 0x04,
+  0xfe, 0x07, 0xf8, 0xff, 0xff, 0x11, 0x09, 0x08, 0x0d, 0x2c, 0x2a, 0x1a,
+  0x2e, 0x27, 0xc7, 0x02, 0x33, 0xe3, 0x38, 0x04, 0xee, 0xde, 0xfb, 0xed,
+  0xfb, 0xdc, 0xe7, 0xf7, 0xfb, 0xf9, 0xeb, 0x0e, 0x09, 0xf6, 0xf8, 0xf8,
+  0xfc, 0x01, 0x0a, 0x0a, 0xfa, 0xfd, 0xff, 0x04, 0x01, 0xf8, 0xfa, 0xfd,
+  0xf4, 0x0a, 0x2a, 0x37, 0x01, 0x41, 0xbf, 0xe4, 0xf4, 0x15, 0x2b, 0xf2,
+  0xe7, 0x27, 0x16, 0xf5, 0xf9, 0x07, 0x15, 0x00, 0xfb, 0x1f, 0xe5, 0x09,
+  0xf7, 0x03, 0xf0, 0x09, 0xf9, 0x08, 0xff, 0x09, 0xfc, 0x04, 0x0e, 0x11,
+  0xfc, 0x05, 0x05, 0x04, 0x08, 0xf3, 0x55, 0x36, 0xbe, 0x51, 0xe5, 0xfb,
+  0xdd, 0x36, 0x12, 0xfb, 0xee, 0x25, 0x37, 0xd1, 0x07, 0x14, 0x13, 0xd0,
+  0xfc, 0x0c, 0x0a, 0xf3, 0xfb, 0x19, 0xef, 0x01, 0xf7, 0x02, 0x04, 0xf6,
+  0xf7, 0x02, 0x14, 0x06, 0xfe, 0xff, 0x06, 0xff, 0x0e, 0x0d, 0x37, 0x2f,
+  0xc8, 0x4c, 0xe1, 0xfc, 0xec, 0x19, 0x0e, 0xff, 0xf7, 0x27, 0x2a, 0xdf,
+  0xfe, 0x18, 0x2a, 0xed, 0xf6, 0x0a, 0x13, 0xf6, 0x06, 0xf6, 0xf7, 0x03,
+  0xfd, 0x01, 0xff, 0xf2, 0xf7, 0xf9, 0x06, 0x0f, 0xf5, 0xf9, 0xf7, 0x06,
+  0x1c, 0xf7, 0x1b, 0x0a, 0xdb, 0x03, 0xe3, 0xf5, 0xf7, 0x1e, 0xf2, 0x03,
+  0x09, 0x0e, 0x27, 0xe9, 0x0d, 0x09, 0x10, 0xf1, 0xf4, 0x15, 0x02, 0xf5,
+  0xfe, 0xfb, 0xfd, 0x09, 0xfa, 0xe3, 0x0c, 0xf2, 0xf6, 0x03, 0xf0, 0x03,
+  0xff, 0xfc, 0x00, 0x02, 0x04, 0xee, 0xe4, 0xd7, 0xdf, 0xe8, 0xe6, 0xf5,
+  0x0e, 0x0b, 0xcd, 0x03, 0x11, 0xd7, 0x00, 0xdb, 0x12, 0xe8, 0x03, 0xee,
+  0xfc, 0x01, 0x16, 0xf1, 0x03, 0xf1, 0xf2, 0xfd, 0xff, 0xf5, 0xfb, 0xf8,
+  0xf7, 0xfa, 0xff, 0x04, 0x00, 0xfe, 0x0b, 0x00, 0x00, 0x08, 0xdb, 0xff,
+  0xef, 0xf6, 0xde, 0xf1, 0x08, 0x03, 0xee, 0xf0, 0x08, 0xf2, 0x00, 0xea,
+  0xf9, 0xeb, 0xef, 0xfc, 0xfe, 0xf4, 0x09, 0x01, 0x03, 0xed, 0x02, 0xf8,
+  0x00, 0xf5, 0xfc, 0xfa, 0x00, 0xfb, 0xff, 0xf9, 0x00, 0xff, 0x03, 0xfe,
+  0x21, 0xf2, 0xce, 0x06, 0xec, 0xea, 0x02, 0xf0, 0x24, 0xf0, 0x0a, 0xf9,
+  0x14, 0xf5, 0xfd, 0xef, 0xfe, 0xf9, 0xf7, 0xf7, 0x01, 0xf3, 0xef, 0x03,
+  0x00, 0xea, 0x0a, 0xf4, 0x00, 0xf3, 0xfb, 0xea, 0x00, 0xf6, 0x02, 0x02,
+  0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0x1a, 0xfb, 0xd5, 0x25, 0x0d, 0x39, 0xfa,
+  0xfc, 0x39, 0xf2, 0xef, 0x04, 0xe2, 0xf8, 0xea, 0x00, 0xfb, 0xfb, 0x14,
+  0xfe, 0xff, 0x03, 0x13, 0xfe, 0xfa, 0xfa, 0xf7, 0xff, 0x07, 0xf7, 0x0b,
+  0x08, 0x23, 0x18, 0x0d, 0x0d, 0xf6, 0x01, 0xf3, 0x2a, 0x0f, 0xfc, 0xd3,
+  0x15, 0xd3, 0x58, 0xe4, 0x1c, 0x20, 0x15, 0xf1, 0xf3, 0xf4, 0xfa, 0xe2,
+  0x04, 0x0b, 0xfc, 0x16, 0xfd, 0x0b, 0x04, 0x09, 0xfe, 0x03, 0x0b, 0xea,
+  0xff, 0xe0, 0xf5, 0xfb, 0x00, 0xf9, 0xfa, 0xff, 0x00, 0x00, 0x05, 0xfe,
+  0x06, 0x2e, 0xff, 0xec, 0x1d, 0xe1, 0x2e, 0xdf, 0x42, 0x13, 0x2c, 0xfa,
+  0xf8, 0xf0, 0xfe, 0xf8, 0xe9, 0xec, 0xfc, 0xff, 0xfe, 0xe6, 0xf1, 0xea,
+  0x07, 0xf2, 0x01, 0xf3, 0xff, 0xeb, 0xf5, 0x03, 0xff, 0x00, 0x01, 0xfc,
+  0x00, 0x05, 0xfc, 0xfe, 0x02, 0x44, 0xda, 0xe6, 0x0e, 0xc2, 0xde, 0xea,
+  0x57, 0xfe, 0x33, 0xf6, 0xf4, 0xd0, 0xfd, 0xd8, 0x02, 0xf3, 0x01, 0xf6,
+  0x09, 0xef, 0xf6, 0xeb, 0x01, 0x0b, 0xfd, 0xf6, 0xfc, 0x14, 0xf1, 0xff,
+  0x00, 0x09, 0x00, 0x07, 0x00, 0xfd, 0x0c, 0xed, 0x15, 0x4f, 0xea, 0xeb,
+  0x17, 0xf1, 0xc2, 0xf2, 0x41, 0xde, 0x31, 0xfe, 0x0c, 0xd0, 0xf7, 0xef,
+  0x03, 0xe6, 0xf6, 0xfa, 0x12, 0x01, 0xe4, 0x02, 0x0e, 0xfa, 0xec, 0xed,
+  0x00, 0xf5, 0x11, 0x06, 0xfe, 0x01, 0x0d, 0x03, 0x00, 0x00, 0x03, 0xf5,
+  0x06, 0x2c, 0x27, 0x2d, 0x00, 0x22, 0xcd, 0x03, 0x0b, 0x02, 0xfe, 0x05,
+  0xfc, 0xe1, 0x14, 0xfa, 0x05, 0x05, 0x0a, 0x09, 0xf8, 0xfc, 0xf6, 0xff,
+  0xf8, 0xf3, 0xf0, 0xe4, 0x01, 0xea, 0xf4, 0xf8, 0xff, 0xf0, 0xf8, 0xfc,
+  0xff, 0xef, 0x03, 0xfe, 0x0f, 0x10, 0x14, 0x1d, 0xcd, 0x22, 0xdd, 0x16,
+  0xcc, 0x27, 0xf0, 0x11, 0xe8, 0x29, 0x28, 0xef, 0xf4, 0x05, 0x0d, 0xfa,
+  0xf2, 0x11, 0xe0, 0xed, 0xf3, 0x00, 0xf8, 0xed, 0xff, 0xf4, 0xf4, 0xfd,
+  0xfe, 0xfc, 0xef, 0x03, 0xfd, 0xf6, 0xfc, 0x0e, 0xee, 0xf6, 0x1d, 0x0d,
+  0xaf, 0x30, 0xd1, 0x07, 0xc9, 0x29, 0xdd, 0x02, 0xf1, 0x2b, 0x26, 0xef,
+  0xf8, 0x02, 0x07, 0xf2, 0xf5, 0x16, 0xf6, 0x11, 0xf2, 0xf5, 0x09, 0xfd,
+  0xfd, 0x03, 0xfa, 0x0b, 0xfe, 0xf9, 0xfc, 0xf6, 0xfe, 0x04, 0xff, 0x03,
+  0x00, 0xfd, 0x0d, 0x16, 0xb2, 0x12, 0xf3, 0xf7, 0xe2, 0x12, 0xd3, 0x0b,
+  0xf8, 0x2b, 0x07, 0xfd, 0xff, 0x13, 0x15, 0x07, 0xfd, 0x18, 0x04, 0x05,
+  0x02, 0xf4, 0x10, 0xfd, 0xfe, 0xfb, 0x02, 0xfb, 0xff, 0xe9, 0xfc, 0xe3,
+  0x04, 0xf7, 0xfd, 0xf2, 0x16, 0x26, 0xef, 0x13, 0xc5, 0xd7, 0xf7, 0x0b,
+  0xe4, 0xfe, 0xd0, 0x09, 0xf9, 0x29, 0xfe, 0x11, 0xfe, 0xfd, 0x0b, 0xfc,
+  0xee, 0xf8, 0xfa, 0xef, 0xf8, 0xf0, 0x0e, 0xf9, 0xfc, 0xea, 0xfb, 0x01,
+  0xff, 0x04, 0x0b, 0xf9, 0xff, 0x05, 0xee, 0xff, 0xf1, 0x23, 0xff, 0x02,
+  0xcd, 0x07, 0xf3, 0x0e, 0xfd, 0xfe, 0xd0, 0xf4, 0xff, 0x0b, 0xec, 0xf2,
+  0x0e, 0xdc, 0xfc, 0xe6, 0xfa, 0xf6, 0xf3, 0xf9, 0xf1, 0xf3, 0x08, 0xf7,
+  0xfd, 0x06, 0xf9, 0x09, 0xff, 0xf7, 0x05, 0xf1, 0xff, 0x01, 0xf0, 0x04,
+  0xfb, 0xe3, 0xeb, 0xdf, 0xe4, 0xef, 0xee, 0xff, 0xf8, 0xf1, 0xd1, 0xf3,
+  0xfa, 0xea, 0xe7, 0x0e, 0xf0, 0xd0, 0xf6, 0xf1, 0xf8, 0xe4, 0xed, 0xe4,
+  0xf2, 0xd8, 0xf7, 0xe5, 0xfe, 0xe6, 0xf4, 0xfc, 0x00, 0xf4, 0x02, 0xfd,
+  0x00, 0x05, 0x02, 0x0b, 0xe9, 0xd6, 0xf6, 0xcd, 0xd6, 0xf2, 0xe3, 0xf0,
+  0xe1, 0xe2, 0xd7, 0xeb, 0xee, 0xf1, 0xf3, 0x07, 0xf3, 0xcf, 0xf3, 0xe7,
+  0xfe, 0xd6, 0xee, 0xda, 0xfd, 0xde, 0xf0, 0xdd, 0x00, 0xeb, 0xfd, 0xe6,
+  0x00, 0xec, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xfe, 0x18, 0xb5, 0x09, 0xc8,
+  0xe9, 0x22, 0x02, 0xdd, 0xe4, 0xfe, 0xc8, 0xda, 0xfb, 0xd5, 0xe5, 0xfd,
+  0xfd, 0xc8, 0xfe, 0xec, 0xfe, 0xdf, 0xe9, 0xf0, 0xff, 0xeb, 0xe4, 0xec,
+  0xff, 0xf2, 0xe9, 0xec, 0x00, 0xf4, 0xfb, 0xfc, 0x00, 0xfd, 0xfe, 0xfe,
+  0xfa, 0xbe, 0xe6, 0xa4, 0x09, 0x07, 0x3a, 0xdc, 0xe7, 0x11, 0xde, 0xeb,
+  0xfb, 0xdb, 0xd3, 0xef, 0xfd, 0xcf, 0x0f, 0x0a, 0xfe, 0xe9, 0xfb, 0x08,
+  0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xe3, 0xf8, 0xeb, 0x00, 0xe9, 0xf3, 0xfe,
+  0x00, 0xf9, 0xfa, 0x02, 0xf9, 0xd4, 0xdb, 0xa9, 0x0a, 0x03, 0x4a, 0xf8,
+  0xe7, 0x19, 0xfb, 0xed, 0xe9, 0x02, 0xea, 0xed, 0xf9, 0x07, 0xf2, 0x10,
+  0xfb, 0xea, 0xfc, 0xf2, 0xfe, 0xe4, 0xfd, 0xe7, 0xff, 0xe6, 0xe6, 0xf1,
+  0x00, 0xfb, 0xf5, 0x01, 0xff, 0xfc, 0xf1, 0x07, 0x0b, 0xe6, 0xdb, 0xc8,
+  0x15, 0x05, 0x48, 0xf6, 0x1d, 0x0c, 0x19, 0xff, 0xf3, 0x05, 0xf7, 0x1a,
+  0xed, 0xfd, 0x09, 0x0d, 0xf5, 0xfb, 0xfa, 0xf9, 0xfe, 0xfa, 0xf1, 0xff,
+  0xfe, 0xf1, 0xfb, 0xef, 0xfe, 0xff, 0xff, 0x07, 0xff, 0x02, 0xeb, 0x0c,
+  0xf9, 0x0b, 0xd9, 0xcf, 0x21, 0xe3, 0x1a, 0xf4, 0x2a, 0x12, 0x34, 0x1e,
+  0xfb, 0xe8, 0xef, 0x01, 0xec, 0xfc, 0xf0, 0x1d, 0xf7, 0x08, 0xfa, 0xff,
+  0xfe, 0x0a, 0xfe, 0x0a, 0xf2, 0x0b, 0xee, 0xe9, 0x00, 0x14, 0x03, 0x09,
+  0xff, 0x07, 0xf5, 0x06, 0xf1, 0x1a, 0xd8, 0xc0, 0x33, 0xde, 0xff, 0xf7,
+  0x43, 0x09, 0x41, 0xf8, 0xf3, 0x03, 0xe8, 0x01, 0xf6, 0xe9, 0x01, 0x18,
+  0x05, 0x08, 0xf6, 0x00, 0x02, 0x0b, 0xf7, 0x09, 0xfb, 0x20, 0xf9, 0xf9,
+  0xff, 0x0b, 0x03, 0xfd, 0x00, 0x07, 0x03, 0xfa, 0xfb, 0x14, 0x01, 0x02,
+  0x22, 0xf9, 0xb4, 0xfd, 0x34, 0xfa, 0x26, 0xe3, 0xf8, 0xfa, 0xe7, 0xe2,
+  0x04, 0xfb, 0x02, 0x0e, 0x0d, 0x0f, 0xf9, 0xe1, 0x04, 0xf3, 0xf8, 0xf6,
+  0xfb, 0x1f, 0xf4, 0xfb, 0xff, 0x0c, 0x0c, 0x13, 0x00, 0x0d, 0x05, 0x02,
+  0xe6, 0x2b, 0x1c, 0x23, 0x10, 0x29, 0xde, 0x08, 0x0b, 0xf4, 0x19, 0xee,
+  0x11, 0xe7, 0xfa, 0xf9, 0xfe, 0xec, 0x09, 0xff, 0xf7, 0xf8, 0xee, 0xe9,
+  0x01, 0xeb, 0xf3, 0xff, 0x00, 0xf3, 0xfc, 0x03, 0x00, 0xdd, 0x04, 0x04,
+  0x00, 0xeb, 0xf9, 0xfb, 0xfa, 0x10, 0x52, 0x2d, 0xdf, 0x3d, 0xbd, 0x03,
+  0xfb, 0x0c, 0x18, 0xf0, 0x15, 0x35, 0x1f, 0x13, 0xf3, 0x0a, 0x0c, 0x0f,
+  0xfe, 0x19, 0x15, 0x02, 0xf8, 0x03, 0xf4, 0xfb, 0xff, 0xe6, 0xfe, 0xfa,
+  0x00, 0x02, 0x06, 0x04, 0x00, 0xf3, 0x03, 0xfc, 0xe7, 0xf2, 0x4b, 0x23,
+  0xd6, 0x35, 0xcd, 0xf0, 0x0b, 0x15, 0x05, 0xff, 0xf8, 0x22, 0x14, 0xf1,
+  0xfa, 0xff, 0x10, 0xf1, 0xfe, 0x0e, 0x0a, 0xf3, 0xfd, 0x02, 0xf4, 0xff,
+  0xfe, 0xef, 0xfa, 0xf8, 0xfd, 0xfb, 0xfd, 0xf6, 0xff, 0xfa, 0x0e, 0xfa,
+  0x00, 0xde, 0x29, 0xf6, 0xbe, 0x38, 0xf2, 0xf0, 0xf3, 0x0c, 0xed, 0x0a,
+  0xf5, 0x11, 0x1c, 0xfd, 0xf8, 0x01, 0x11, 0x03, 0xfa, 0xf2, 0x01, 0x02,
+  0xfd, 0xe3, 0xff, 0xf3, 0xfd, 0x09, 0xf8, 0xef, 0xfb, 0x06, 0x00, 0xf3,
+  0xff, 0xfc, 0xf6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xff, 0xff,
+  0x6d, 0xff, 0xff, 0xff, 0xde, 0xfe, 0xff, 0xff, 0x32, 0x0e, 0x00, 0x00,
+  0x9c, 0xff, 0xff, 0xff, 0x05, 0xf4, 0xff, 0xff, 0xba, 0xff, 0xff, 0xff,
+  0x9b, 0x1d, 0x00, 0x00, 0x85, 0x17, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff,
+  0x3e, 0xfa, 0xff, 0xff, 0x09, 0xeb, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00,
+  0x6f, 0xfe, 0xff, 0xff, 0xcb, 0xed, 0xff, 0xff, 0xab, 0xd4, 0xff, 0xff,
+  0x78, 0xf0, 0xff, 0xff, 0xd9, 0xfe, 0xff, 0xff, 0x59, 0x1a, 0x00, 0x00,
+  0x7d, 0x13, 0x00, 0x00, 0x7b, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff,
+  0x9c, 0xf4, 0xff, 0xff, 0x70, 0xe4, 0xff, 0xff, 0xa6, 0xcd, 0xff, 0xff,
+  0x86, 0xf0, 0xff, 0xff, 0xd1, 0xf2, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff,
+  0xf1, 0xfe, 0xff, 0xff, 0xbc, 0x0a, 0x00, 0x00, 0x53, 0xdc, 0xff, 0xff,
+  0x3a, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x2a, 0x07, 0x00, 0x00,
+  0x5c, 0xf8, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xf3, 0xda, 0xff, 0xff,
+  0x62, 0xf7, 0xff, 0xff, 0xc5, 0x0a, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x91,
+  0x52, 0x00, 0x86, 0x00, 0x98, 0x00, 0x8f, 0x73, 0x63, 0x00, 0xd4, 0x8f,
+  0x00, 0x00, 0x00, 0x82, 0x6a, 0x00, 0xa2, 0x00, 0x00, 0x5b, 0x59, 0x00,
+  0x00, 0x9d, 0x00, 0x00, 0x7f, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf9, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0xf2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf3, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00,
+  0x40, 0x02, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00,
+  0x68, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x82, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xc0, 0xf3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x54, 0x0a, 0x00, 0x00, 0xc0, 0x09, 0x00, 0x00, 0x58, 0x09, 0x00, 0x00,
+  0xdc, 0x08, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00,
+  0x38, 0x07, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x84, 0x05, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00,
+  0xd8, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00,
+  0x14, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xb4, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x94, 0xf6, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x31, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2c, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0xf7, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x86, 0xf5, 0x5f, 0x3e, 0x32, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbc, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0xa4, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x28, 0x00, 0x00, 0x00, 0x9c, 0xf7, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd8, 0xda, 0x91, 0x3d,
+  0x5e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x5f, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x68,
+  0x69, 0x64, 0x64, 0x65, 0x6e, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x31,
+  0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x5f,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
+  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x74, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0x00, 0x00, 0x54, 0xf8, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x76, 0x7f, 0x3d, 0x1a, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66,
+  0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
+  0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x03, 0x00, 0x00, 0xec, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x6c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xd4, 0xf8, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x14, 0x76, 0x7f, 0x3d,
+  0x1f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+  0x6e, 0x67, 0x32, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x74, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0xd4, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5c, 0xf9, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x76, 0x7f, 0x3d, 0x86, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x32, 0x2f, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65,
+  0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c,
+  0x61, 0x79, 0x65, 0x72, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
+  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
+  0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x32, 0x2f,
+  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
+  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x6c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4c, 0xfa, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x6d, 0x1c, 0x91, 0x3d, 0x1f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
+  0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50,
+  0x6f, 0x6f, 0x6c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xec, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x63, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd4, 0xfa, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x1c, 0x91, 0x3d,
+  0xa4, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65,
+  0x72, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
+  0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
+  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72,
+  0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+  0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x32, 0x44, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
+  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72,
+  0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65,
+  0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x5c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x63, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfc, 0xfb, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf7, 0x24, 0x1e, 0x3d, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xda, 0xfb, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x7c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x46, 0xcb, 0xc2, 0x3b, 0x67, 0x43, 0x94, 0x3b,
+  0xa2, 0xd2, 0x96, 0x3b, 0x7a, 0x12, 0xca, 0x3b, 0x1d, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63,
+  0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x31, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x72, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x88, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xf4, 0xfc, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0xab, 0x70, 0x39,
+  0x04, 0x2e, 0x37, 0x39, 0x8e, 0x57, 0x3a, 0x39, 0x2a, 0xa9, 0x79, 0x39,
+  0x2d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65,
+  0x72, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
+  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0a, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x8c, 0xfd, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb3, 0x01, 0x29, 0x3b,
+  0x9b, 0x7d, 0x73, 0x3b, 0x72, 0xce, 0xde, 0x3b, 0xe1, 0x6a, 0x9a, 0x3b,
+  0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x6c, 0x61, 0x79, 0x65,
+  0x72, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa2, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0xfe, 0xff, 0xff,
+  0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x75, 0x99, 0x3f, 0x39, 0x2e, 0x05, 0x8a, 0x39, 0x58, 0x97, 0xfc, 0x39,
+  0x5e, 0x0f, 0xaf, 0x39, 0x2d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x5f,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
+  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x54, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xbc, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf7, 0x0c, 0xf3, 0x3a,
+  0x1f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x5f, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x31, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+  0xa2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x68, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x24, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x8a, 0xf2, 0x38,
+  0x2f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x5f, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
+  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x4f, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x1a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x9c, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x5b, 0xb2, 0xcc, 0x3b, 0x18, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x70, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x40, 0xe9, 0x39, 0x28, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65,
+  0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x43,
+  0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xe6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00,
+  0xc6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00,
+  0xd2, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x16, 0xf2, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x0e, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72
+};
+unsigned int converted_model_int8_tflite_len = 43056;
+// the tensor arena structures hold pointers so the size depends on the pointer size - the 32 bit figure is the ESP32's
+#if UINTPTR_MAX == 0xFFFFFFFF
+unsigned int converted_model_int8_tflite_arena_size = 22584;
+#else
+unsigned int converted_model_int8_tflite_arena_size = 23312;
+#endif
@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include <string.h>
+#include "HostTest.h"
+#include "NeuralNetwork.h"
+#include "model.h"
+
+static int aligned_size(int size)
+{
+    return (size + 15) & ~15;
+}
+
+// the recorded arena sizes are the exact ones for this pointer size - nothing gets sized again
+static void test_recorded_arena_sizes()
+{
+    NeuralNetwork float_model(converted_model_tflite, converted_model_tflite_arena_size);
+    CHECK(float_model.isLoaded());
+    CHECK(float_model.getArenaSize() == aligned_size(converted_model_tflite_arena_size));
+    CHECK(float_model.getInputBuffer() != NULL);
+    CHECK(float_model.getInputSize() > 0);
+    NeuralNetwork int8_model(converted_model_int8_tflite, converted_model_int8_tflite_arena_size);
+    CHECK(int8_model.isLoaded());
+    CHECK(int8_model.isQuantized());
+    CHECK(int8_model.getArenaSize() == aligned_size(converted_model_int8_tflite_arena_size));
+    CHECK(int8_model.getInputBufferInt8() != NULL);
+    // too small and the model sizes itself - it comes out the same
+    NeuralNetwork resized(converted_model_tflite, converted_model_tflite_arena_size - 16);
+    CHECK(resized.isLoaded());
+    CHECK(resized.getArenaSize() == float_model.getArenaSize());
+    // and the model runs in exactly that much arena
+    memset(float_model.getInputBuffer(), 0, float_model.getInputSize() * sizeof(float));
+    float score = float_model.predict();
+    CHECK(score >= 0 && score <= 1);
+}
+
+// a model that couldn't be loaded, or is suspended, has no input or output - everything says so instead of crashing
+static void test_not_loaded()
+{
+    unsigned char *junk = (unsigned char *)calloc(1, 256);
+    NeuralNetwork bad(junk, 0);
+    CHECK(!bad.isLoaded());
+    CHECK(bad.getInputBuffer() == NULL);
+    CHECK(bad.getInputBufferInt8() == NULL);
+    CHECK(bad.getInputSize() == 0);
+    CHECK(bad.getOutputSize() == 0);
+    CHECK(bad.predict() == 0);
+    CHECK(!bad.resume());
+    free(junk);
+
+    NeuralNetwork model(converted_model_int8_tflite, converted_model_int8_tflite_arena_size);
+    model.suspend();
+    CHECK(!model.isLoaded());
+    CHECK(model.getInputBufferInt8() == NULL);
+    CHECK(model.predict() == 0);
+    model.resetState();
+    CHECK(model.resume());
+    CHECK(model.isLoaded());
+    CHECK(model.getInputBufferInt8() != NULL);
+}
+
+int main()
+{
+    test_recorded_arena_sizes();
+    test_not_loaded();
+    return host_test_result("test_neural_network");
+}
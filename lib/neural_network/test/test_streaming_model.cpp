@@ -0,0 +1,271 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "HostTest.h"
+#include "RingBuffer.h"
+#include "AudioProcessor.h"
+#include "NeuralNetwork.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/version.h"
+
+// the wake word detector's settings - streaming models need the noise reduction so the rows don't change once computed
+#define AUDIO_LENGTH 16000
+#define WINDOW_SIZE 320
+#define STEP_SIZE 160
+#define POOLING_SIZE 6
+// the number of units in the SVDF layer
+#define UNITS 32
+
+/**
+ * Builds small float tflite models in memory - the streaming model and the windowed one it is checked against are made
+ * from the same weights here rather than being checked in as model files
+ **/
+class ModelBuilder
+{
+private:
+    flatbuffers::FlatBufferBuilder m_fbb;
+    std::vector<flatbuffers::Offset<tflite::Buffer>> m_buffers;
+    std::vector<flatbuffers::Offset<tflite::Tensor>> m_tensors;
+    std::vector<flatbuffers::Offset<tflite::Operator>> m_operators;
+
+public:
+    enum
+    {
+        SVDF,
+        FULLY_CONNECTED,
+        LOGISTIC
+    };
+    ModelBuilder()
+    {
+        // buffer 0 is the empty buffer for tensors without any data
+        m_buffers.push_back(tflite::CreateBuffer(m_fbb));
+    }
+    int addTensor(std::vector<int> shape, const std::vector<float> *data = NULL, bool is_variable = false)
+    {
+        int buffer = 0;
+        if (data)
+        {
+            m_buffers.push_back(tflite::CreateBuffer(m_fbb, m_fbb.CreateVector((const uint8_t *)data->data(), data->size() * sizeof(float))));
+            buffer = m_buffers.size() - 1;
+        }
+        m_tensors.push_back(tflite::CreateTensor(m_fbb, m_fbb.CreateVector(shape), tflite::TensorType_FLOAT32, buffer, 0, 0, is_variable));
+        return m_tensors.size() - 1;
+    }
+    void addOperator(int opcode, std::vector<int> inputs, std::vector<int> outputs, tflite::BuiltinOptions options_type = tflite::BuiltinOptions_NONE,
+                     flatbuffers::Offset<void> options = 0)
+    {
+        m_operators.push_back(tflite::CreateOperator(m_fbb, opcode, m_fbb.CreateVector(inputs), m_fbb.CreateVector(outputs), options_type, options));
+    }
+    flatbuffers::FlatBufferBuilder &fbb()
+    {
+        return m_fbb;
+    }
+    std::vector<uint8_t> finish(int input, int output)
+    {
+        std::vector<flatbuffers::Offset<tflite::OperatorCode>> opcodes;
+        opcodes.push_back(tflite::CreateOperatorCode(m_fbb, tflite::BuiltinOperator_SVDF));
+        opcodes.push_back(tflite::CreateOperatorCode(m_fbb, tflite::BuiltinOperator_FULLY_CONNECTED));
+        opcodes.push_back(tflite::CreateOperatorCode(m_fbb, tflite::BuiltinOperator_LOGISTIC));
+        std::vector<int> inputs(1, input), outputs(1, output);
+        std::vector<flatbuffers::Offset<tflite::SubGraph>> subgraphs(1, tflite::CreateSubGraph(m_fbb, m_fbb.CreateVector(m_tensors), m_fbb.CreateVector(inputs),
+                                                                                               m_fbb.CreateVector(outputs), m_fbb.CreateVector(m_operators)));
+        m_fbb.Finish(tflite::CreateModel(m_fbb, TFLITE_SCHEMA_VERSION, m_fbb.CreateVector(opcodes), m_fbb.CreateVector(subgraphs), 0,
+                                         m_fbb.CreateVector(m_buffers)),
+                     "TFL3");
+        return std::vector<uint8_t>(m_fbb.GetBufferPointer(), m_fbb.GetBufferPointer() + m_fbb.GetSize());
+    }
+};
+
+struct Weights
+{
+    int row_size;
+    int number_of_rows;
+    // the rank 1 SVDF filters - a weight for each value in a row and for each row in the window
+    std::vector<float> feature;
+    std::vector<float> time;
+    std::vector<float> bias;
+    // a single output fully connected layer and a logistic make the score
+    std::vector<float> output;
+    std::vector<float> output_bias;
+};
+
+static Weights make_weights(int row_size, int number_of_rows)
+{
+    uint32_t state = 25;
+    Weights weights;
+    weights.row_size = row_size;
+    weights.number_of_rows = number_of_rows;
+    weights.feature.resize(UNITS * row_size);
+    weights.time.resize(UNITS * number_of_rows);
+    weights.bias.resize(UNITS);
+    weights.output.resize(UNITS);
+    weights.output_bias.assign(1, -0.5f);
+    for (size_t i = 0; i < weights.feature.size(); i++)
+    {
+        weights.feature[i] = ((int)(host_random(state) % 2001) - 1000) * 0.0003f;
+    }
+    for (size_t i = 0; i < weights.time.size(); i++)
+    {
+        weights.time[i] = ((int)(host_random(state) % 2001) - 1000) * 0.0003f;
+    }
+    for (int i = 0; i < UNITS; i++)
+    {
+        weights.bias[i] = ((int)(host_random(state) % 2001) - 1000) * 0.0001f;
+        weights.output[i] = ((int)(host_random(state) % 2001) - 1000) * 0.0005f;
+    }
+    return weights;
+}
+
+// SVDF -> RELU -> fully connected -> logistic, taking a row at a time and keeping the rows it needs in the SVDF's state
+static std::vector<uint8_t> make_streaming_model(const Weights &weights)
+{
+    ModelBuilder builder;
+    int input = builder.addTensor({1, weights.row_size});
+    int feature = builder.addTensor({UNITS, weights.row_size}, &weights.feature);
+    int time = builder.addTensor({UNITS, weights.number_of_rows}, &weights.time);
+    int bias = builder.addTensor({UNITS}, &weights.bias);
+    int svdf_state = builder.addTensor({1, weights.number_of_rows * UNITS}, NULL, true);
+    int svdf_output = builder.addTensor({1, UNITS});
+    int output_weights = builder.addTensor({1, UNITS}, &weights.output);
+    int output_bias = builder.addTensor({1}, &weights.output_bias);
+    int logit = builder.addTensor({1, 1});
+    int score = builder.addTensor({1, 1});
+    builder.addOperator(ModelBuilder::SVDF, {input, feature, time, bias, svdf_state}, {svdf_output}, tflite::BuiltinOptions_SVDFOptions,
+                        tflite::CreateSVDFOptions(builder.fbb(), 1, tflite::ActivationFunctionType_RELU).Union());
+    builder.addOperator(ModelBuilder::FULLY_CONNECTED, {svdf_output, output_weights, output_bias}, {logit}, tflite::BuiltinOptions_FullyConnectedOptions,
+                        tflite::CreateFullyConnectedOptions(builder.fbb()).Union());
+    builder.addOperator(ModelBuilder::LOGISTIC, {logit}, {score});
+    return builder.finish(input, score);
+}
+
+// the same thing over the whole window - a rank 1 SVDF is a fully connected layer whose weights are the outer product of
+// the time and feature weights
+static std::vector<uint8_t> make_windowed_model(const Weights &weights)
+{
+    int window_size = weights.number_of_rows * weights.row_size;
+    std::vector<float> window_weights(UNITS * window_size);
+    for (int unit = 0; unit < UNITS; unit++)
+    {
+        for (int row = 0; row < weights.number_of_rows; row++)
+        {
+            for (int i = 0; i < weights.row_size; i++)
+            {
+                window_weights[unit * window_size + row * weights.row_size + i] =
+                    weights.time[unit * weights.number_of_rows + row] * weights.feature[unit * weights.row_size + i];
+            }
+        }
+    }
+    ModelBuilder builder;
+    int input = builder.addTensor({1, window_size});
+    int window = builder.addTensor({UNITS, window_size}, &window_weights);
+    int bias = builder.addTensor({UNITS}, &weights.bias);
+    int units = builder.addTensor({1, UNITS});
+    int output_weights = builder.addTensor({1, UNITS}, &weights.output);
+    int output_bias = builder.addTensor({1}, &weights.output_bias);
+    int logit = builder.addTensor({1, 1});
+    int score = builder.addTensor({1, 1});
+    builder.addOperator(ModelBuilder::FULLY_CONNECTED, {input, window, bias}, {units}, tflite::BuiltinOptions_FullyConnectedOptions,
+                        tflite::CreateFullyConnectedOptions(builder.fbb(), tflite::ActivationFunctionType_RELU).Union());
+    builder.addOperator(ModelBuilder::FULLY_CONNECTED, {units, output_weights, output_bias}, {logit}, tflite::BuiltinOptions_FullyConnectedOptions,
+                        tflite::CreateFullyConnectedOptions(builder.fbb()).Union());
+    builder.addOperator(ModelBuilder::LOGISTIC, {logit}, {score});
+    return builder.finish(input, score);
+}
+
+// a word that comes and goes over background noise
+static void write_audio(AudioRingBuffer *ring_buffer, uint64_t &sequence, uint32_t &state, int count)
+{
+    ring_buffer->beginWrite(count);
+    for (int i = 0; i < count; i++, sequence++)
+    {
+        double envelope = std::max(0.0, sin(sequence * 0.0004));
+        double word = envelope * (4000 * sin(sequence * 0.06) + 2500 * sin(sequence * 0.23 + sin(sequence * 0.001)));
+        ring_buffer->writeSample((int16_t)(word + (int)(host_random(state) % 401) - 200));
+    }
+    ring_buffer->endWrite();
+}
+
+// feed rows to the streaming model a row at a time like DetectWakeWordState::detectStreaming does
+static float stream_rows(NeuralNetwork *model, const float *rows, int number_of_rows, int row_size)
+{
+    float score = 0;
+    for (int row = 0; row < number_of_rows; row++)
+    {
+        memcpy(model->getInputBuffer(), rows + row * row_size, row_size * sizeof(float));
+        score = model->predict();
+    }
+    return score;
+}
+
+/**
+ * A streaming model that has seen each row of the spectrogram once has to give the same score as the windowed model that
+ * sees the whole window at once - run both on the same audio a hop at a time, including starting again part way through
+ * like the detector does when it has missed too many rows
+ **/
+static void test_streaming_matches_windowed()
+{
+    AudioProcessor *processor = new AudioProcessor(AUDIO_LENGTH, WINDOW_SIZE, STEP_SIZE, POOLING_SIZE, true, false, 0, true);
+    int row_size = processor->get_row_size();
+    int number_of_rows = processor->get_number_of_rows();
+    Weights weights = make_weights(row_size, number_of_rows);
+    std::vector<uint8_t> streaming_model_data = make_streaming_model(weights);
+    std::vector<uint8_t> windowed_model_data = make_windowed_model(weights);
+    NeuralNetwork streaming_model(streaming_model_data.data(), 0);
+    NeuralNetwork windowed_model(windowed_model_data.data(), 0);
+    CHECK(streaming_model.isStreaming());
+    CHECK(!windowed_model.isStreaming());
+    CHECK(streaming_model.getInputSize() == row_size);
+    CHECK(windowed_model.getInputSize() == processor->get_spectrogram_size());
+
+    AudioRingBuffer *ring_buffer = new AudioRingBuffer();
+    RingBufferAccessor reader(ring_buffer);
+    uint64_t sequence = 0;
+    uint32_t state = 2025;
+    write_audio(ring_buffer, sequence, state, AUDIO_LENGTH);
+    std::vector<float> rows(processor->get_spectrogram_size());
+    // the first time the streaming model sees every row in the window
+    reader.setPosition(sequence - AUDIO_LENGTH);
+    processor->get_spectrogram_rows(&reader, rows.data(), number_of_rows);
+    float streaming_score = stream_rows(&streaming_model, rows.data(), number_of_rows, row_size);
+    float max_difference = 0;
+    float min_score = 1;
+    float max_score = 0;
+    for (int hop = 0; hop < 400; hop++)
+    {
+        reader.setPosition(sequence - AUDIO_LENGTH);
+        processor->get_spectrogram(&reader, windowed_model.getInputBuffer());
+        float windowed_score = windowed_model.predict();
+        max_difference = std::max(max_difference, fabsf(streaming_score - windowed_score));
+        min_score = std::min(min_score, windowed_score);
+        max_score = std::max(max_score, windowed_score);
+
+        write_audio(ring_buffer, sequence, state, STEP_SIZE);
+        reader.setPosition(sequence - AUDIO_LENGTH);
+        if (hop == 200)
+        {
+            // missed too many rows - forget them and stream the whole window again
+            streaming_model.resetState();
+            processor->get_spectrogram_rows(&reader, rows.data(), number_of_rows);
+            streaming_score = stream_rows(&streaming_model, rows.data(), number_of_rows, row_size);
+        }
+        else
+        {
+            processor->get_spectrogram_rows(&reader, rows.data(), 1);
+            streaming_score = stream_rows(&streaming_model, rows.data(), 1, row_size);
+        }
+    }
+    printf("Streaming and windowed scores differ by at most %g over 400 hops (scores from %.3f to %.3f)\n", max_difference, min_score, max_score);
+    CHECK(max_difference < 1e-4f);
+    // the audio has to move the score about or this doesn't show much
+    CHECK(max_score - min_score > 0.05f);
+    delete ring_buffer;
+    delete processor;
+}
+
+int main()
+{
+    test_streaming_matches_windowed();
+    return host_test_result("test_streaming_model");
+}
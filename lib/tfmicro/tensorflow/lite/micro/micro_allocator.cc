@@ -872,6 +872,11 @@ TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensor(
   // around for the lifetime of the application.
   TfLiteTensor* tensor =
       AllocatePersistentTfLiteTensorInternal(model, eval_tensors, tensor_index);
+  if (tensor == nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Failed to allocate a persistent TfLiteTensor struct!");
+    return nullptr;
+  }
 
   // Populate any fields from the flatbuffer, since this TfLiteTensor struct is
   // allocated in the persistent section of the arena, ensure that additional
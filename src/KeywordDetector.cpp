@@ -0,0 +1,327 @@
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "NeuralNetwork.h"
+#include "KeywordDetector.h"
+
+// tflite lines up the start of the arena and the allocations from the end of it to 16 bytes so each slice has to be too
+#define KEYWORD_ARENA_ALIGNMENT 16
+
+static int aligned_slice_size(int arena_size)
+{
+    return (arena_size + KEYWORD_ARENA_ALIGNMENT - 1) & ~(KEYWORD_ARENA_ALIGNMENT - 1);
+}
+
+static int8_t quantize(float value, float scale, int zero_point)
+{
+    return std::max(-128, std::min(127, (int)lrintf(value / scale) + zero_point));
+}
+
+KeywordDetector::KeywordDetector(int arena_budget)
+{
+    m_arena_budget = aligned_slice_size(arena_budget);
+    m_arena_allocation = NULL;
+    m_arena = NULL;
+    m_arena_used = 0;
+    m_number_of_models = 0;
+    m_number_of_keywords = 0;
+    m_number_of_runs = 0;
+    memset(m_model_time_us, 0, sizeof(m_model_time_us));
+    allocateArena();
+}
+
+KeywordDetector::~KeywordDetector()
+{
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        delete m_models[i];
+    }
+    free(m_arena_allocation);
+}
+
+bool KeywordDetector::allocateArena()
+{
+    m_arena_allocation = (uint8_t *)malloc(m_arena_budget + KEYWORD_ARENA_ALIGNMENT - 1);
+    if (!m_arena_allocation)
+    {
+        Serial.printf("Could not allocate the %d byte keyword arena\n", m_arena_budget);
+        m_arena = NULL;
+        return false;
+    }
+    m_arena = (uint8_t *)(((uintptr_t)m_arena_allocation + KEYWORD_ARENA_ALIGNMENT - 1) & ~(uintptr_t)(KEYWORD_ARENA_ALIGNMENT - 1));
+    return true;
+}
+
+int KeywordDetector::addModel(const unsigned char *model_data, int arena_size)
+{
+    if (m_number_of_models == KEYWORD_DETECTOR_MAX_MODELS)
+    {
+        Serial.printf("Can't run more than %d keyword models\n", KEYWORD_DETECTOR_MAX_MODELS);
+        return -1;
+    }
+    int model = m_number_of_models;
+    // a model that doesn't fit in what's left of the budget still works, it just gets an arena of its own
+    int slice_size = aligned_slice_size(arena_size);
+    uint8_t *slice = NULL;
+    if (m_arena && slice_size > 0 && m_arena_used + slice_size <= m_arena_budget)
+    {
+        slice = m_arena + m_arena_used;
+    }
+    else
+    {
+        Serial.printf("Keyword model %d needs %d bytes of arena but only %d of the %d byte budget are left - it will allocate its own\n",
+                      model, slice_size, m_arena_budget - m_arena_used, m_arena_budget);
+    }
+    NeuralNetwork *nn = new NeuralNetwork(model_data, arena_size, slice);
+    if (!nn->isLoaded())
+    {
+        Serial.printf("Keyword model %d could not be loaded\n", model);
+        delete nn;
+        return -1;
+    }
+    // they all get the spectrogram the same way so they can share it
+    if (model > 0 && nn->isStreaming() != m_models[0]->isStreaming())
+    {
+        Serial.printf("Keyword model %d %s streaming model and model 0 %s - they can't share the spectrogram\n", model,
+                      nn->isStreaming() ? "is a" : "isn't a", m_models[0]->isStreaming() ? "is" : "isn't");
+        delete nn;
+        return -1;
+    }
+    // if the arena size was wrong the model sized itself in its own arena and didn't use the slice
+    if (slice && nn->getArenaSize() <= slice_size)
+    {
+        m_model_arena_offsets[model] = m_arena_used;
+        m_model_arena_sizes[model] = slice_size;
+        m_arena_used += slice_size;
+    }
+    else
+    {
+        m_model_arena_offsets[model] = 0;
+        m_model_arena_sizes[model] = 0;
+    }
+    m_models[model] = nn;
+    m_number_of_models++;
+    return model;
+}
+
+int KeywordDetector::addKeyword(const char *name, int model, int output, float threshold, int smoothing_runs)
+{
+    if (m_number_of_keywords == KEYWORD_DETECTOR_MAX_KEYWORDS)
+    {
+        Serial.printf("Can't listen for more than %d keywords\n", KEYWORD_DETECTOR_MAX_KEYWORDS);
+        return -1;
+    }
+    if (model < 0 || model >= m_number_of_models || output >= m_models[model]->getOutputSize())
+    {
+        Serial.printf("Keyword %s is output %d of model %d but there isn't one\n", name, output, model);
+        return -1;
+    }
+    Keyword &keyword = m_keywords[m_number_of_keywords];
+    keyword.name = name;
+    keyword.model = model;
+    keyword.output = output;
+    keyword.threshold = threshold;
+    keyword.smoothing_runs = std::max(1, std::min(KEYWORD_DETECTOR_MAX_SMOOTHING_RUNS, smoothing_runs));
+    keyword.scores_count = 0;
+    keyword.next_score = 0;
+    keyword.smoothed_score = 0;
+    return m_number_of_keywords++;
+}
+
+// copy the spectrogram from model 0's input into this model's input converting it if they take different types and
+// pad out the rest of the input
+void KeywordDetector::shareInput(int model, int spectrogram_size)
+{
+    NeuralNetwork *source = m_models[0];
+    NeuralNetwork *nn = m_models[model];
+    int size = std::min(spectrogram_size, nn->getInputSize());
+    if (nn->isQuantized())
+    {
+        int8_t *input = nn->getInputBufferInt8();
+        int zero_point = nn->getInputZeroPoint();
+        if (model == 0)
+        {
+            // already there
+        }
+        else if (source->isQuantized() && source->getInputScale() == nn->getInputScale() && source->getInputZeroPoint() == zero_point)
+        {
+            memcpy(input, source->getInputBufferInt8(), size);
+        }
+        else if (source->isQuantized())
+        {
+            const int8_t *source_input = source->getInputBufferInt8();
+            float source_scale = source->getInputScale();
+            int source_zero_point = source->getInputZeroPoint();
+            for (int i = 0; i < size; i++)
+            {
+                input[i] = quantize((source_input[i] - source_zero_point) * source_scale, nn->getInputScale(), zero_point);
+            }
+        }
+        else
+        {
+            const float *source_input = source->getInputBuffer();
+            for (int i = 0; i < size; i++)
+            {
+                input[i] = quantize(source_input[i], nn->getInputScale(), zero_point);
+            }
+        }
+        // the float models' quantize op turns the zeros in the padding into the zero point so do the same
+        memset(input + size, zero_point, nn->getInputSize() - size);
+    }
+    else
+    {
+        float *input = nn->getInputBuffer();
+        if (model == 0)
+        {
+            // already there
+        }
+        else if (!source->isQuantized())
+        {
+            memcpy(input, source->getInputBuffer(), size * sizeof(float));
+        }
+        else
+        {
+            const int8_t *source_input = source->getInputBufferInt8();
+            float source_scale = source->getInputScale();
+            int source_zero_point = source->getInputZeroPoint();
+            for (int i = 0; i < size; i++)
+            {
+                input[i] = (source_input[i] - source_zero_point) * source_scale;
+            }
+        }
+        memset(input + size, 0, (nn->getInputSize() - size) * sizeof(float));
+    }
+}
+
+int KeywordDetector::detect(int spectrogram_size)
+{
+    // a model that couldn't be resumed has nowhere to put the spectrogram
+    if (!isReady())
+    {
+        return -1;
+    }
+    // share the spectrogram with every model before any of them run - running a model can overwrite its input
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        int64_t start = esp_timer_get_time();
+        shareInput(i, spectrogram_size);
+        m_model_time_us[i] += esp_timer_get_time() - start;
+    }
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        int64_t start = esp_timer_get_time();
+        m_models[i]->predict();
+        m_model_time_us[i] += esp_timer_get_time() - start;
+    }
+    m_number_of_runs++;
+    // smooth each keyword's score and pick the one that's furthest over its threshold
+    int detected = -1;
+    float best_score = 0;
+    for (int i = 0; i < m_number_of_keywords; i++)
+    {
+        Keyword &keyword = m_keywords[i];
+        keyword.scores[keyword.next_score] = m_models[keyword.model]->getOutput(keyword.output);
+        keyword.next_score = (keyword.next_score + 1) % keyword.smoothing_runs;
+        keyword.scores_count = std::min(keyword.scores_count + 1, keyword.smoothing_runs);
+        float total = 0;
+        for (int j = 0; j < keyword.scores_count; j++)
+        {
+            total += keyword.scores[j];
+        }
+        keyword.smoothed_score = total / keyword.scores_count;
+        // only decide once we've got a full set of runs to average over
+        if (keyword.scores_count == keyword.smoothing_runs && keyword.smoothed_score > keyword.threshold &&
+            (detected == -1 || keyword.smoothed_score - keyword.threshold > best_score))
+        {
+            detected = i;
+            best_score = keyword.smoothed_score - keyword.threshold;
+        }
+    }
+    if (detected != -1)
+    {
+        // start again for this keyword so it has to be heard afresh to be detected again
+        m_keywords[detected].scores_count = 0;
+        m_keywords[detected].next_score = 0;
+    }
+    return detected;
+}
+
+void KeywordDetector::clearScores()
+{
+    for (int i = 0; i < m_number_of_keywords; i++)
+    {
+        m_keywords[i].scores_count = 0;
+        m_keywords[i].next_score = 0;
+        m_keywords[i].smoothed_score = 0;
+    }
+}
+
+bool KeywordDetector::isStreaming()
+{
+    return m_number_of_models > 0 && m_models[0]->isStreaming();
+}
+
+bool KeywordDetector::isReady()
+{
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        if (!m_models[i]->isLoaded())
+        {
+            return false;
+        }
+    }
+    return m_number_of_models > 0;
+}
+
+void KeywordDetector::resetState()
+{
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        if (m_models[i]->isStreaming())
+        {
+            m_models[i]->resetState();
+        }
+    }
+    clearScores();
+}
+
+void KeywordDetector::suspend()
+{
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        m_models[i]->suspend();
+    }
+    free(m_arena_allocation);
+    m_arena_allocation = NULL;
+    m_arena = NULL;
+}
+
+bool KeywordDetector::resume()
+{
+    if (!m_arena && !allocateArena())
+    {
+        return false;
+    }
+    bool resumed = true;
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        // each model goes back into the same slice it was loaded into
+        uint8_t *slice = m_model_arena_sizes[i] > 0 ? m_arena + m_model_arena_offsets[i] : NULL;
+        resumed &= m_models[i]->resume(slice);
+    }
+    return resumed;
+}
+
+void KeywordDetector::printStats()
+{
+    if (m_number_of_runs == 0)
+    {
+        return;
+    }
+    for (int i = 0; i < m_number_of_models; i++)
+    {
+        Serial.printf("Keyword model %d took %lldus per run with %d bytes of arena\n", i, m_model_time_us[i] / m_number_of_runs,
+                      m_models[i]->getArenaSize());
+    }
+    m_number_of_runs = 0;
+    memset(m_model_time_us, 0, sizeof(m_model_time_us));
+}
@@ -0,0 +1,112 @@
+#ifndef _keyword_detector_h_
+#define _keyword_detector_h_
+
+#include <stdint.h>
+
+class NeuralNetwork;
+
+#define KEYWORD_DETECTOR_MAX_MODELS 4
+#define KEYWORD_DETECTOR_MAX_KEYWORDS 8
+// enough for 300ms of runs every 10ms hop
+#define KEYWORD_DETECTOR_MAX_SMOOTHING_RUNS 32
+
+/**
+ * Runs several keyword models - or several outputs of a multi-class model - on the same spectrogram. The spectrogram is
+ * written into the first model's input and copied (and converted if the models take different types) into the others
+ * so it only gets computed once however many keywords there are.
+ *
+ * The models are built in slices of a single arena allocated up front, each keyword has its own threshold and its
+ * score is averaged over its last few runs before it's compared to the threshold.
+ *
+ * The models either all take the whole spectrogram or are all streaming models that take it a row at a time - then
+ * detect is called for each new row.
+ **/
+class KeywordDetector
+{
+private:
+    struct Keyword
+    {
+        const char *name;
+        int model;
+        int output;
+        float threshold;
+        int smoothing_runs;
+        // the last smoothing_runs scores - scores_count of them are valid and the next one goes in at next_score
+        float scores[KEYWORD_DETECTOR_MAX_SMOOTHING_RUNS];
+        int scores_count;
+        int next_score;
+        float smoothed_score;
+    };
+
+    int m_arena_budget;
+    // the malloced arena and where it starts lined up for tflite - NULL while we are suspended
+    uint8_t *m_arena_allocation;
+    uint8_t *m_arena;
+    int m_arena_used;
+
+    NeuralNetwork *m_models[KEYWORD_DETECTOR_MAX_MODELS];
+    // where each model's slice of the arena starts and how big it is - a model that didn't fit has a size of 0 and its own arena
+    int m_model_arena_offsets[KEYWORD_DETECTOR_MAX_MODELS];
+    int m_model_arena_sizes[KEYWORD_DETECTOR_MAX_MODELS];
+    int m_number_of_models;
+    Keyword m_keywords[KEYWORD_DETECTOR_MAX_KEYWORDS];
+    int m_number_of_keywords;
+
+    // profiling - time spent sharing the input with and running each model since the stats were printed
+    int64_t m_model_time_us[KEYWORD_DETECTOR_MAX_MODELS];
+    int m_number_of_runs;
+
+    bool allocateArena();
+    void shareInput(int model, int spectrogram_size);
+
+public:
+    // arena_budget is the total number of bytes of tensor arena all the models have to share
+    KeywordDetector(int arena_budget);
+    ~KeywordDetector();
+    // load a model into the next slice of the arena - returns the index of the model for addKeyword or -1 if it can't be loaded
+    int addModel(const unsigned char *model_data, int arena_size);
+    /**
+     * Listen for a keyword that is the given output of a model. It's detected when the average score of the last
+     * smoothing_runs runs goes over the threshold - work this out from how often detect is called so the keyword has to be
+     * heard for the same length of time whatever the interval. Returns the index of the keyword or -1 if there are too many.
+     **/
+    int addKeyword(const char *name, int model, int output, float threshold, int smoothing_runs);
+    // the spectrogram goes into the input of model 0 - NULL if there isn't a model with this index
+    NeuralNetwork *getModel(int index)
+    {
+        return index >= 0 && index < m_number_of_models ? m_models[index] : NULL;
+    }
+    int getNumberOfModels()
+    {
+        return m_number_of_models;
+    }
+    // the models take a row of the spectrogram at a time
+    bool isStreaming();
+    // there is at least one model and they all have their inputs - false if none could be loaded or one couldn't be resumed
+    bool isReady();
+    const char *getKeywordName(int index)
+    {
+        return m_keywords[index].name;
+    }
+    float getKeywordScore(int index)
+    {
+        return m_keywords[index].smoothed_score;
+    }
+    /**
+     * Run all the models on the spectrogram (or the row of it for streaming models) that has been written into model 0's
+     * input - spectrogram_size is how many values of it were written, the rest of each model's input is padded with zeros. Returns the index of the keyword
+     * with the highest score over its threshold or -1 if none of them are (or the models aren't ready).
+     **/
+    int detect(int spectrogram_size);
+    // forget the scores of earlier runs - the next detection only depends on new audio
+    void clearScores();
+    // forget the rows the streaming models have seen as well as the scores
+    void resetState();
+    // free the arena while we aren't listening - the models stay loaded so resume is quick
+    void suspend();
+    bool resume();
+    // print the average time each model has taken to run and start timing again
+    void printStats();
+};
+
+#endif
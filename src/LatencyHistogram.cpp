@@ -0,0 +1,72 @@
+#include <Arduino.h>
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram(const char *name, int bucket_width_us, int number_of_buckets)
+{
+    m_name = name;
+    m_bucket_width_us = bucket_width_us;
+    m_number_of_buckets = number_of_buckets;
+    m_buckets = static_cast<uint32_t *>(malloc(sizeof(uint32_t) * number_of_buckets));
+    reset();
+}
+
+LatencyHistogram::~LatencyHistogram()
+{
+    free(m_buckets);
+}
+
+void LatencyHistogram::reset()
+{
+    memset(m_buckets, 0, sizeof(uint32_t) * m_number_of_buckets);
+    m_count = 0;
+    m_max_latency = 0;
+}
+
+void LatencyHistogram::add(int64_t latency_us)
+{
+    int bucket = std::max<int64_t>(0, latency_us / m_bucket_width_us);
+    m_buckets[std::min(bucket, m_number_of_buckets - 1)]++;
+    m_count++;
+    m_max_latency = std::max(m_max_latency, latency_us);
+}
+
+int64_t LatencyHistogram::getPercentile(float percentile)
+{
+    uint32_t target = (uint32_t)ceilf(m_count * percentile / 100.0f);
+    uint32_t total = 0;
+    for (int i = 0; i < m_number_of_buckets - 1; i++)
+    {
+        total += m_buckets[i];
+        if (total >= target)
+        {
+            return (int64_t)(i + 1) * m_bucket_width_us;
+        }
+    }
+    // it's in the overflow bucket so the best we can do is the max
+    return m_max_latency;
+}
+
+void LatencyHistogram::print()
+{
+    if (m_count == 0)
+    {
+        return;
+    }
+    Serial.printf("%s latency: p50 %lldus, p90 %lldus, p99 %lldus, max %lldus over %u samples\n",
+                  m_name, getPercentile(50), getPercentile(90), getPercentile(99), m_max_latency, m_count);
+    // dump the buckets that have something in them
+    for (int i = 0; i < m_number_of_buckets; i++)
+    {
+        if (m_buckets[i] > 0)
+        {
+            if (i == m_number_of_buckets - 1)
+            {
+                Serial.printf("  >= %dus: %u\n", i * m_bucket_width_us, m_buckets[i]);
+            }
+            else
+            {
+                Serial.printf("  %d-%dus: %u\n", i * m_bucket_width_us, (i + 1) * m_bucket_width_us, m_buckets[i]);
+            }
+        }
+    }
+}
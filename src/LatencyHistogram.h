@@ -0,0 +1,29 @@
+#ifndef _latency_histogram_h_
+#define _latency_histogram_h_
+
+#include <stdint.h>
+
+/**
+ * Fixed width histogram of latencies - the last bucket collects everything that doesn't fit in the others
+ **/
+class LatencyHistogram
+{
+private:
+    const char *m_name;
+    int m_bucket_width_us;
+    int m_number_of_buckets;
+    uint32_t *m_buckets;
+    uint32_t m_count;
+    int64_t m_max_latency;
+
+public:
+    LatencyHistogram(const char *name, int bucket_width_us, int number_of_buckets);
+    ~LatencyHistogram();
+    void add(int64_t latency_us);
+    // upper bound of the bucket containing the given percentile (0-100) in microseconds
+    int64_t getPercentile(float percentile);
+    void print();
+    void reset();
+};
+
+#endif
@@ -22,5 +22,45 @@
 #define I2S_SPEAKER_LEFT_RIGHT_CLOCK GPIO_NUM_12
 #define I2S_SPEAKER_SERIAL_DATA GPIO_NUM_27
 
+// how often (in samples) to wake up the application task - a windowed wake word model runs the whole network on the last
+// second of audio so it runs every 100ms, a streaming model only takes the newest row so it runs every 160 sample hop for
+// the lowest latency. While recognising a command we only need to send audio up every 100ms.
+#define WAKE_WORD_NOTIFICATION_INTERVAL 1600
+#define STREAMING_WAKE_WORD_NOTIFICATION_INTERVAL 160
+#define COMMAND_NOTIFICATION_INTERVAL 1600
+
+// compute the spectrogram in fixed point - uncomment this on chips without a fast floating point unit
+// #define USE_FIXED_POINT_FRONTEND
+
+// use log mel band energies as the features instead of the average pooled spectrum - the model has to have
+// been trained on the same features
+// #define MEL_BANDS 40
+
+// take out background noise and normalise the features with noise reduction and PCAN (per channel energy normalisation)
+// instead of normalising each second of audio by its loudest sample - the model has to have been trained with it too
+// #define USE_NOISE_REDUCTION
+
+// split the work of computing the spectrogram between this many workers - 2 uses both cores of the ESP32. This
+// mostly helps after a cold start when the whole second of audio needs computing, normally there's only a frame or two to do.
+#define SPECTROGRAM_WORKERS 2
+
+// run the fully int8 quantized version of the wake word model - the spectrogram is quantized straight into the model's
+// input instead of the model converting a float input, and only the score is converted back to a float
+// #define USE_INT8_MODEL
+
+// the bytes of tensor arena all the keyword models share - each model takes a slice the size of its _arena_size (rounded
+// up to 16 bytes) so this needs to go up when more models are added
+#define KEYWORD_ARENA_BUDGET (24 * 1024)
+
+// band pass filter the audio before it goes into the ring buffer to take out DC, mains hum and low frequency rumble
+// (the ADC input has lots of all of these). Taking out 50Hz needs a long filter so it's done with FFTs, which
+// delays the audio by about 55ms. The model should be trained on filtered audio too.
+// #define USE_PRE_FILTER
+#define PRE_FILTER_TAPS 255
+#define PRE_FILTER_LOW_FREQUENCY 100
+#define PRE_FILTER_HIGH_FREQUENCY 7500
+// boost the high frequencies as well - 0 turns this off
+#define PRE_FILTER_PRE_EMPHASIS 0
+
 // command recognition settings
 #define COMMAND_RECOGNITION_ACCESS_KEY "P5QMUSMFV6IRRSTABXFQ7UIXPFRMC4L5"
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "I2SMicSampler.h"
 #include "ADCSampler.h"
 #include "I2SOutput.h"
+#include "FIRFilter.h"
 #include "config.h"
 #include "SPIFFS.h" 
 #include "IntentProcessor.h" // thư viện xử lý ý định
@@ -131,6 +132,15 @@ void app_main(void)
     // Use the internal ADC
     I2SSampler *i2s_sampler = new ADCSampler(ADC_UNIT_1, ADC_MIC_CHANNEL);
 #endif
+#ifdef USE_PRE_FILTER
+    // filter the samples as they arrive - the filter makes its own copy of the taps
+    float *pre_filter_taps = (float *)malloc(sizeof(float) * PRE_FILTER_TAPS);
+    FIRFilter::designBandPass(pre_filter_taps, PRE_FILTER_TAPS, 16000, PRE_FILTER_LOW_FREQUENCY, PRE_FILTER_HIGH_FREQUENCY, PRE_FILTER_PRE_EMPHASIS);
+    FIRFilter *pre_filter = new FIRFilter(pre_filter_taps, PRE_FILTER_TAPS);
+    free(pre_filter_taps);
+    Serial.printf("Pre-filter using %s with a delay of %d samples\n", pre_filter->isUsingFFT() ? "FFTs" : "direct form", pre_filter->getDelay());
+    i2s_sampler->setFilter(pre_filter);
+#endif
 
     // Start the i2s speaker output
     I2SOutput *i2s_output = new I2SOutput();
@@ -3,16 +3,80 @@
 #include <freertos/semphr.h>
 #include <driver/gpio.h>
 #include <driver/i2s.h>
+#include <esp_timer.h>
 #include "I2SSampler.h"
 #include "AudioProcessor.h"
 #include "NeuralNetwork.h"
+#include "model.h"
+#include "VoiceActivityDetector.h"
 #include "RingBuffer.h"
 #include "DetectWakeWordState.h"
+#include "LatencyHistogram.h"
+#include "KeywordDetector.h"
+#include "FIRFilter.h"
+#include "../config.h"
 
 #define WINDOW_SIZE 320
 #define STEP_SIZE 160
 #define POOLING_SIZE 6
 #define AUDIO_LENGTH 16000
+// AUDIO_LENGTH is a second of audio
+#define SAMPLES_PER_MS (AUDIO_LENGTH / 1000)
+#ifdef USE_FIXED_POINT_FRONTEND
+#define FIXED_POINT_FRONTEND true
+#else
+#define FIXED_POINT_FRONTEND false
+#endif
+// 0 means average pool the spectrum instead of using mel bands
+#ifndef MEL_BANDS
+#define MEL_BANDS 0
+#endif
+#ifdef USE_NOISE_REDUCTION
+#define NOISE_REDUCTION true
+#else
+#define NOISE_REDUCTION false
+#endif
+#ifdef USE_INT8_MODEL
+#define WAKE_WORD_MODEL converted_model_int8_tflite
+#define WAKE_WORD_ARENA_SIZE converted_model_int8_tflite_arena_size
+#else
+#define WAKE_WORD_MODEL converted_model_tflite
+#define WAKE_WORD_ARENA_SIZE converted_model_tflite_arena_size
+#endif
+// the wake word is detected when its score averaged over the runs in the last WAKE_WORD_SMOOTHING_MS goes over the threshold
+#define WAKE_WORD_THRESHOLD 0.95f
+#define WAKE_WORD_SMOOTHING_MS 200
+// enough arena for the wake word model on its own
+#ifndef KEYWORD_ARENA_BUDGET
+#define KEYWORD_ARENA_BUDGET (24 * 1024)
+#endif
+// compute the frames of the spectrogram on one core unless we've been told otherwise
+#ifndef SPECTROGRAM_WORKERS
+#define SPECTROGRAM_WORKERS 1
+#endif
+// voice activity detection - a frame needs to be 9dB above the noise floor to count as speech and we keep
+// listening until we've been back within 6dB of the noise floor for a whole window's worth of audio
+#define VAD_SPEECH_THRESHOLD 8.0f
+#define VAD_RELEASE_THRESHOLD 4.0f
+#define VAD_MAX_ZERO_CROSSING_RATE 0.45f
+#define VAD_HANGOVER_FRAMES (AUDIO_LENGTH / STEP_SIZE)
+// how often to print the timing stats
+#define STATS_INTERVAL_MS 10000
+
+// how often the models run - streaming models can run on every hop, windowed ones run the whole network so they don't
+// get woken up as often
+static int notification_interval(bool streaming)
+{
+    return streaming ? STREAMING_WAKE_WORD_NOTIFICATION_INTERVAL : WAKE_WORD_NOTIFICATION_INTERVAL;
+}
+
+// the number of runs of the models in the smoothing time - streaming models run once for every hop and the others each time
+// we're woken up (if a run takes longer than the notification interval there are fewer runs and the time stretches out)
+static int smoothing_runs(bool streaming)
+{
+    int samples_per_run = streaming ? STEP_SIZE : std::max(STEP_SIZE, notification_interval(streaming));
+    return std::max(1, (WAKE_WORD_SMOOTHING_MS * SAMPLES_PER_MS + samples_per_run / 2) / samples_per_run);
+}
 
 DetectWakeWordState::DetectWakeWordState(I2SSampler *sample_provider)
 {
@@ -21,64 +85,238 @@ DetectWakeWordState::DetectWakeWordState(I2SSampler *sample_provider)
     // some stats on performance
     m_average_detect_time = 0;
     m_number_of_runs = 0;
+    m_stats_start_time = 0;
+    m_overwritten_samples = 0;
+    m_number_of_skipped_runs = 0;
+    // time from the newest samples arriving to making a decision on them in 5ms buckets
+    m_latency_histogram = new LatencyHistogram("Detection", 5000, 40);
+    // the voice activity detector is cheap so it stays around between states
+    m_voice_activity_detector = new VoiceActivityDetector(STEP_SIZE, VAD_SPEECH_THRESHOLD, VAD_RELEASE_THRESHOLD, VAD_MAX_ZERO_CROSSING_RATE, VAD_HANGOVER_FRAMES);
+    // the keyword models are loaded the first time we enter the state
+    m_keyword_detector = NULL;
+    m_wake_word = -1;
+    m_streaming_rows = NULL;
+    m_streaming_rows_int8 = NULL;
+    m_last_streamed_hop = -1;
 }
 void DetectWakeWordState::enterState()
 {
-    // Create our neural network
-    m_nn = new NeuralNetwork();
-    Serial.println("Created Neural Net");
-    // create our audio processor
-    m_audio_processor = new AudioProcessor(AUDIO_LENGTH, WINDOW_SIZE, STEP_SIZE, POOLING_SIZE);
-    Serial.println("Created audio processor");
+    // we can't hear the wake word until this is done so keep track of how long it takes
+    int64_t neural_network_start = esp_timer_get_time();
+    // load our keyword models the first time - after that they stay loaded between states with just their arena freed
+    // so coming back from the command state only needs the arena allocating again
+    bool resumed = m_keyword_detector != NULL;
+    if (!resumed)
+    {
+        m_keyword_detector = new KeywordDetector(KEYWORD_ARENA_BUDGET);
+        int wake_word_model = m_keyword_detector->addModel(WAKE_WORD_MODEL, WAKE_WORD_ARENA_SIZE);
+        m_wake_word = m_keyword_detector->addKeyword("wake word", wake_word_model, 0, WAKE_WORD_THRESHOLD,
+                                                     smoothing_runs(m_keyword_detector->isStreaming()));
+        // other keywords (a stop word for example) go here - either another output of a multi-class model or another
+        // model. They all run on the same spectrogram.
+    }
+    else if (!m_keyword_detector->resume())
+    {
+        Serial.println("Not enough memory to resume the keyword models");
+    }
+    // without the models there's nowhere to put the spectrogram - we carry on so the other states still work but nothing
+    // will be detected
+    bool ready = m_keyword_detector->isReady();
+    if (!ready)
+    {
+        Serial.println("The keyword models aren't loaded - the wake word can't be detected");
+    }
+    // the spectrogram is written into the first model's input and shared with the rest from there
+    NeuralNetwork *nn = m_keyword_detector->getModel(0);
+    // create our audio processor - in streaming mode so we only compute the spectrogram for new audio. The fft plan
+    // and window tables are cached so this is much quicker when we come back from the command state
+    int64_t audio_processor_start = esp_timer_get_time();
+    m_audio_processor = new AudioProcessor(AUDIO_LENGTH, WINDOW_SIZE, STEP_SIZE, POOLING_SIZE, true, FIXED_POINT_FRONTEND, MEL_BANDS, NOISE_REDUCTION,
+                                           SPECTROGRAM_WORKERS);
+    int64_t ready_time = esp_timer_get_time();
+    Serial.printf("%s %d keyword models in %lldus, created audio processor in %lldus\n", resumed ? "Resumed" : "Loaded",
+                  m_keyword_detector->getNumberOfModels(), audio_processor_start - neural_network_start, ready_time - audio_processor_start);
+    // the spectrogram is written straight into the models' inputs so it had better fit - streaming models take it a row at a time
+    int features_size = m_keyword_detector->isStreaming() ? m_audio_processor->get_row_size() : m_audio_processor->get_spectrogram_size();
+    for (int i = 0; ready && i < m_keyword_detector->getNumberOfModels(); i++)
+    {
+        if (features_size > m_keyword_detector->getModel(i)->getInputSize())
+        {
+            Serial.printf("The %s has %d values but keyword model %d expects %d - check MEL_BANDS matches the model\n",
+                          m_keyword_detector->isStreaming() ? "spectrogram row" : "spectrogram", features_size, i,
+                          m_keyword_detector->getModel(i)->getInputSize());
+        }
+    }
+    // a quantized model takes the spectrogram as int8 values with the same scaling its quantize op used to have
+    if (ready && nn->isQuantized())
+    {
+        m_audio_processor->set_output_quantization(nn->getInputScale(), nn->getInputZeroPoint());
+    }
 
-    m_number_of_detections = 0;
+    // streaming models get the new rows of the spectrogram from a buffer of their own instead of it going straight into
+    // the model's input
+    if (ready && m_keyword_detector->isStreaming())
+    {
+        if (!NOISE_REDUCTION)
+        {
+            Serial.println("Streaming models need USE_NOISE_REDUCTION - otherwise every row is normalised by the whole window");
+        }
+        if (nn->isQuantized())
+        {
+            m_streaming_rows_int8 = static_cast<int8_t *>(malloc(m_audio_processor->get_spectrogram_size()));
+        }
+        else
+        {
+            m_streaming_rows = static_cast<float *>(malloc(sizeof(float) * m_audio_processor->get_spectrogram_size()));
+        }
+    }
+    // the models have just been loaded or resumed so they haven't seen any rows yet
+    m_last_streamed_hop = -1;
+    m_keyword_detector->clearScores();
+    // streaming models run on every hop of the spectrogram, the others less often
+    m_sample_provider->setNotificationInterval(notification_interval(m_keyword_detector->isStreaming()));
+    m_stats_start_time = millis();
 }
 bool DetectWakeWordState::run()
 {
     // time how long this takes for stats
     long start = millis();
+    // when the newest samples we are going to process arrived
+    int64_t arrival_time = m_sample_provider->getLastPublishTime();
     // get access to the samples that have been read in
     RingBufferAccessor *reader = m_sample_provider->getRingBufferReader();
-    // rewind by 1 second
-    reader->rewind(16000);
-    // get hold of the input buffer for the neural network so we can feed it data
-    float *input_buffer = m_nn->getInputBuffer();
-    // process the samples to get the spectrogram
-    m_audio_processor->get_spectrogram(reader, input_buffer);
+    // only bother with the spectrogram and the neural networks if something speech like has arrived recently
+    int keyword = -1;
+    if (m_voice_activity_detector->process(reader) && m_keyword_detector->isReady())
+    {
+        // rewind by 1 second
+        reader->rewind(16000);
+        if (m_keyword_detector->isStreaming())
+        {
+            keyword = detectStreaming(reader);
+        }
+        else
+        {
+            // process the samples to get the spectrogram straight into the first model's input - keep track of any samples
+            // that were overwritten before we could process them
+            NeuralNetwork *nn = m_keyword_detector->getModel(0);
+            if (nn->isQuantized())
+            {
+                m_overwritten_samples += m_audio_processor->get_spectrogram(reader, nn->getInputBufferInt8());
+            }
+            else
+            {
+                m_overwritten_samples += m_audio_processor->get_spectrogram(reader, nn->getInputBuffer());
+            }
+            // the spectrogram is computed once and all the models run on it - the models take one more row than the
+            // spectrogram has and the detector pads that out
+            keyword = m_keyword_detector->detect(m_audio_processor->get_spectrogram_size());
+        }
+        long end = millis();
+        m_latency_histogram->add(esp_timer_get_time() - arrival_time);
+        // compute the stats
+        m_average_detect_time = (end - start) * 0.1 + m_average_detect_time * 0.9;
+    }
+    else
+    {
+        m_number_of_skipped_runs++;
+        // the scores from before the silence don't have anything to do with what comes next
+        m_keyword_detector->clearScores();
+    }
     // finished with the sample reader
     delete reader;
-    // get the prediction for the spectrogram
-    float output = m_nn->predict();
-    long end = millis();
-    // compute the stats
-    m_average_detect_time = (end - start) * 0.1 + m_average_detect_time * 0.9;
     m_number_of_runs++;
-    // log out some timing info
-    if (m_number_of_runs == 100)
+    // log out some timing info every so often - how many runs that is depends on how often we're woken up
+    if (millis() - m_stats_start_time >= STATS_INTERVAL_MS)
     {
+        m_stats_start_time = millis();
+        Serial.printf("Average detection time %.fms, overwritten samples %d, skipped %d%% of runs, %u cycles per spectrogram frame, %u in noise reduction\n",
+                      m_average_detect_time, m_overwritten_samples, 100 * m_number_of_skipped_runs / m_number_of_runs,
+                      m_audio_processor->get_average_frame_cycles(), m_audio_processor->get_average_noise_reduction_cycles());
+        if (m_sample_provider->getFilter())
+        {
+            Serial.printf("%u cycles per block in the pre-filter\n", m_sample_provider->getFilter()->getAverageBlockCycles());
+        }
         m_number_of_runs = 0;
-        Serial.printf("Average detection time %.fms\n", m_average_detect_time);
+        m_number_of_skipped_runs = 0;
+        m_latency_histogram->print();
+        m_latency_histogram->reset();
+        m_keyword_detector->printStats();
     }
-    // use quite a high threshold to prevent false positives
-    if (output > 0.95)
+    // the wake word moves us on to the next state, the other keywords are just reported for now
+    if (keyword == m_wake_word && keyword != -1)
     {
-        m_number_of_detections++;
-        if (m_number_of_detections > 1)
-        {
-            m_number_of_detections = 0;
-            // detected the wake word in several runs, move to the next state
-            Serial.printf("P(%.2f): Here I am, brain the size of a planet...\n", output);
-            return true;
-        }
+        Serial.printf("P(%.2f): Here I am, brain the size of a planet...\n", m_keyword_detector->getKeywordScore(keyword));
+        return true;
+    }
+    if (keyword != -1)
+    {
+        Serial.printf("P(%.2f): Heard %s\n", m_keyword_detector->getKeywordScore(keyword), m_keyword_detector->getKeywordName(keyword));
     }
     // nothing detected stay in the current state
     return false;
 }
+// streaming models see each row of the spectrogram once - the rows that are new since the last run are run through them in
+// order. Returns the keyword that was detected or -1.
+int DetectWakeWordState::detectStreaming(RingBufferAccessor *reader)
+{
+    int number_of_rows = m_audio_processor->get_number_of_rows();
+    int row_size = m_audio_processor->get_row_size();
+    // the rows line up with the hops so the newest row is the last whole hop of the window
+    int64_t newest_hop = reader->getPosition() / STEP_SIZE + number_of_rows - 1;
+    int64_t new_rows = m_last_streamed_hop < 0 ? number_of_rows : newest_hop - m_last_streamed_hop;
+    if (new_rows <= 0)
+    {
+        return -1;
+    }
+    // if we've missed more than the window the models start again with the whole window
+    if (new_rows >= number_of_rows)
+    {
+        m_keyword_detector->resetState();
+        new_rows = number_of_rows;
+    }
+    NeuralNetwork *nn = m_keyword_detector->getModel(0);
+    int overwritten;
+    if (nn->isQuantized())
+    {
+        overwritten = m_audio_processor->get_spectrogram_rows(reader, m_streaming_rows_int8, new_rows);
+    }
+    else
+    {
+        overwritten = m_audio_processor->get_spectrogram_rows(reader, m_streaming_rows, new_rows);
+    }
+    m_overwritten_samples += overwritten;
+    // run the models on each row - the wake word wins if it's detected along with anything else
+    int keyword = -1;
+    for (int row = 0; row < new_rows; row++)
+    {
+        if (nn->isQuantized())
+        {
+            memcpy(nn->getInputBufferInt8(), m_streaming_rows_int8 + row * row_size, row_size);
+        }
+        else
+        {
+            memcpy(nn->getInputBuffer(), m_streaming_rows + row * row_size, row_size * sizeof(float));
+        }
+        int detected = m_keyword_detector->detect(row_size);
+        if (detected != -1 && keyword != m_wake_word)
+        {
+            keyword = detected;
+        }
+    }
+    // rows made from overwritten samples can't be trusted so start again from the whole window next time
+    m_last_streamed_hop = overwritten > 0 ? -1 : newest_hop;
+    return keyword;
+}
 void DetectWakeWordState::exitState()
 {
-    // Create our neural network
-    delete m_nn;
-    m_nn = NULL;
+    // free the keyword arena and the audio processor to make room for the command state - the models stay loaded so
+    // we can get going again quickly
+    m_keyword_detector->suspend();
+    free(m_streaming_rows);
+    m_streaming_rows = NULL;
+    free(m_streaming_rows_int8);
+    m_streaming_rows_int8 = NULL;
     delete m_audio_processor;
     m_audio_processor = NULL;
     uint32_t free_ram = esp_get_free_heap_size();
@@ -1,21 +1,37 @@
 #ifndef _detect_wake_word_state_h_
 #define _detect_wake_word_state_h_
 
+#include <stdint.h>
 #include "States.h"
 
 class I2SSampler;
-class NeuralNetwork;
+class KeywordDetector;
 class AudioProcessor;
+class LatencyHistogram;
+class VoiceActivityDetector;
+class RingBufferAccessor;
 
 class DetectWakeWordState : public State
 {
 private:
     I2SSampler *m_sample_provider;
-    NeuralNetwork *m_nn;
+    KeywordDetector *m_keyword_detector;
+    // the index of the wake word keyword in the detector
+    int m_wake_word;
+    // streaming models - the new rows of the spectrogram and the hop of the last row they were given (-1 if they haven't had any)
+    float *m_streaming_rows;
+    int8_t *m_streaming_rows_int8;
+    int64_t m_last_streamed_hop;
     AudioProcessor *m_audio_processor;
     float m_average_detect_time;
-    int m_number_of_detections;
     int m_number_of_runs;
+    unsigned long m_stats_start_time;
+    int m_overwritten_samples;
+    int m_number_of_skipped_runs;
+    LatencyHistogram *m_latency_histogram;
+    VoiceActivityDetector *m_voice_activity_detector;
+
+    int detectStreaming(RingBufferAccessor *reader);
 
 public:
     DetectWakeWordState(I2SSampler *sample_provider);
@@ -1,7 +1,8 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "esp_log.h"
 #include "I2SSampler.h"
-#include "RingBuffer.h"
+#include "CaptureStore.h"
 #include "RecogniseCommandState.h"
 #include "IndicatorLight.h"
 #include "Speaker.h"
@@ -14,6 +15,8 @@
 #define STEP_SIZE 160
 #define POOLING_SIZE 6
 #define AUDIO_LENGTH 16000
+// the samples are copied out of the capture store and sent up in chunks of at most this many - 100ms
+#define UPLOAD_CHUNK_SAMPLES 1600
 
 RecogniseCommandState::RecogniseCommandState(I2SSampler *sample_provider, IndicatorLight *indicator_light, Speaker *speaker, IntentProcessor *intent_processor)
 {
@@ -23,22 +26,28 @@ RecogniseCommandState::RecogniseCommandState(I2SSampler *sample_provider, Indica
     m_speaker = speaker;
     m_intent_processor = intent_processor;
     m_speech_recogniser = NULL;
+    m_reader = NULL;
+    m_upload_buffer = NULL;
 }
 void RecogniseCommandState::enterState()
 {
+    // the command starts now - remember where so we don't depend on how long it takes to connect to the server
+    m_command_start = m_sample_provider->getCurrentWritePosition();
     // indicate that we are now recording audio
     m_indicator_light->setState(ON);
     m_speaker->playReady();
+    // we only need to send audio up every 100ms or so
+    m_sample_provider->setNotificationInterval(COMMAND_NOTIFICATION_INTERVAL);
 
     // stash the start time - we will limit ourselves to 5 seconds of data
     m_start_time = millis();
     m_elapsed_time = 0;
-    m_last_audio_position = -1;
 
     uint32_t free_ram = esp_get_free_heap_size();
     Serial.printf("Free ram before connection %d\n", free_ram);
 
     m_speech_recogniser = new WitAiChunkedUploader(COMMAND_RECOGNITION_ACCESS_KEY);
+    m_upload_buffer = static_cast<int16_t *>(malloc(sizeof(int16_t) * UPLOAD_CHUNK_SAMPLES));
 
     Serial.println("Ready for action");
 
@@ -47,44 +56,44 @@ void RecogniseCommandState::enterState()
 }
 bool RecogniseCommandState::run()
 {
-    if (!m_speech_recogniser || !m_speech_recogniser->connected())
+    if (!m_speech_recogniser || !m_speech_recogniser->connected() || !m_upload_buffer)
     {
         // no http client - something went wrong somewhere move to the next state as there's nothing for us to do
         Serial.println("Error - Attempt to run with no http client");
         return true;
     }
-    if (m_last_audio_position == -1)
+    if (!m_reader)
     {
-        // set to 1 seconds in the past the allow for the really slow connection time
-        m_last_audio_position = m_sample_provider->getCurrentWritePosition() - 16000;
+        // start from where the command started - samples that have gone from the ring buffer will come from the cold tier
+        m_reader = m_sample_provider->getCaptureReader();
+        m_reader->setPosition(m_command_start);
     }
-    // how many samples have been captured since we last ran
-    int audio_position = m_sample_provider->getCurrentWritePosition();
-    // work out how many samples there are taking into account that we can wrap around
-    int sample_count = (audio_position - m_last_audio_position + m_sample_provider->getRingBufferSize()) % m_sample_provider->getRingBufferSize();
-    // Serial.printf("Last sample position %d, current position %d, number samples %d\n", m_last_audio_position, audio_position, sample_count);
-    if (sample_count > 0)
+    // send the samples that have been captured since we last ran a chunk at a time. Sending can take long enough for the
+    // writer to get to the samples so they are copied out first - samples it got to while they were being copied (or
+    // that it overwrote before we got to them) are dropped rather than sent.
+    uint64_t end = m_reader->getWritePosition();
+    int sample_count = 0;
+    while (m_reader->getPosition() < end)
     {
-        // send the samples to the server
-        m_speech_recogniser->startChunk(sample_count * sizeof(int16_t));
-        RingBufferAccessor *reader = m_sample_provider->getRingBufferReader();
-        reader->setIndex(m_last_audio_position);
-        // send the samples up in chunks
-        int16_t sample_buffer[500];
-        while (sample_count > 0)
+        uint64_t lost = 0;
+        int chunk_count = m_reader->read(m_upload_buffer, std::min<uint64_t>(UPLOAD_CHUNK_SAMPLES, end - m_reader->getPosition()), &lost);
+        if (lost > 0)
         {
-            for (int i = 0; i < sample_count && i < 500; i++)
-            {
-                sample_buffer[i] = reader->getCurrentSample();
-                reader->moveToNextSample();
-            }
-            m_speech_recogniser->sendChunkData((const uint8_t *)sample_buffer, std::min(sample_count, 500) * 2);
-            sample_count -= 500;
+            // these samples are missing from the middle of the command so the recognition is likely to be wrong
+            ESP_LOGE("RecogniseCommandState", "Lost %d samples of the command (%d in total) - the reader fell behind the capture store",
+                     (int)lost, (int)m_reader->getLostSamples());
+        }
+        if (chunk_count == 0)
+        {
+            break;
         }
-        m_last_audio_position = reader->getIndex();
+        m_speech_recogniser->startChunk(chunk_count * sizeof(int16_t));
+        m_speech_recogniser->sendChunkData((const uint8_t *)m_upload_buffer, chunk_count * sizeof(int16_t));
         m_speech_recogniser->finishChunk();
-        delete (reader);
-
+        sample_count += chunk_count;
+    }
+    if (sample_count > 0)
+    {
         // has 3 seconds passed?
         unsigned long current_time = millis();
         m_elapsed_time += current_time - m_start_time;
@@ -125,6 +134,10 @@ void RecogniseCommandState::exitState()
     // clean up the speech recognizer client as it takes up a lot of RAM
     delete m_speech_recogniser;
     m_speech_recogniser = NULL;
+    delete m_reader;
+    m_reader = NULL;
+    free(m_upload_buffer);
+    m_upload_buffer = NULL;
     uint32_t free_ram = esp_get_free_heap_size();
     Serial.printf("Free ram after request %d\n", free_ram);
 }
\ No newline at end of file
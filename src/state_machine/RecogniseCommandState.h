@@ -4,6 +4,7 @@
 #include "States.h"
 
 class I2SSampler;
+class CaptureReader;
 class WiFiClient;
 class HTTPClient;
 class IndicatorLight;
@@ -17,7 +18,11 @@ private:
     I2SSampler *m_sample_provider;
     unsigned long m_start_time;
     unsigned long m_elapsed_time;
-    int m_last_audio_position;
+    // where the command starts and the reader that sends it up to the server
+    uint64_t m_command_start;
+    CaptureReader *m_reader;
+    // the samples are copied into here before they're sent
+    int16_t *m_upload_buffer;
 
     IndicatorLight *m_indicator_light;
     Speaker *m_speaker;
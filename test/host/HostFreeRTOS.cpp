@@ -0,0 +1,164 @@
+#include <string.h>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+// a task's notification value - anything can have one, the tasks are just threads
+struct HostTask
+{
+    std::mutex mutex;
+    std::condition_variable notified;
+    uint32_t value;
+};
+
+struct HostQueue
+{
+    std::mutex mutex;
+    std::condition_variable received;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t item_size;
+};
+
+// the tasks live until the program exits so none of these are ever freed
+static thread_local HostTask *current_task = NULL;
+
+static bool wait_for(std::condition_variable &condition, std::unique_lock<std::mutex> &lock, TickType_t ticks_to_wait,
+                     const std::function<bool()> &ready)
+{
+    if (ticks_to_wait == portMAX_DELAY)
+    {
+        condition.wait(lock, ready);
+        return true;
+    }
+    return condition.wait_for(lock, std::chrono::milliseconds(ticks_to_wait * portTICK_PERIOD_MS), ready);
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack_depth, void *param, UBaseType_t priority,
+                       TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(function, name, stack_depth, param, priority, handle, 0);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stack_depth, void *param,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    HostTask *task = new HostTask();
+    task->value = 0;
+    if (handle)
+    {
+        *handle = task;
+    }
+    std::thread([task, function, param]
+                {
+                    current_task = task;
+                    function(param); })
+        .detach();
+    return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    if (!current_task)
+    {
+        current_task = new HostTask();
+        current_task->value = 0;
+    }
+    return current_task;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action)
+{
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        switch (action)
+        {
+        case eSetBits:
+            task->value |= value;
+            break;
+        case eIncrement:
+            task->value++;
+            break;
+        case eSetValueWithOverwrite:
+        case eSetValueWithoutOverwrite:
+            task->value = value;
+            break;
+        default:
+            break;
+        }
+    }
+    task->notified.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    HostTask *task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    wait_for(task->notified, lock, ticks_to_wait, [task]
+             { return task->value != 0; });
+    uint32_t value = task->value;
+    if (value != 0)
+    {
+        task->value = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+BaseType_t xPortGetCoreID()
+{
+    return 0;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    HostQueue *queue = new HostQueue();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (queue->items.size() >= queue->length)
+        {
+            return pdFAIL;
+        }
+        const uint8_t *bytes = static_cast<const uint8_t *>(item);
+        queue->items.push_back(std::vector<uint8_t>(bytes, bytes + queue->item_size));
+    }
+    queue->received.notify_one();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks_to_wait)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!wait_for(queue->received, lock, ticks_to_wait, [queue]
+                  { return !queue->items.empty(); }))
+    {
+        return pdFAIL;
+    }
+    memcpy(item, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    return pdPASS;
+}
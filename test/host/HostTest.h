@@ -0,0 +1,57 @@
+#ifndef _host_test_h_
+#define _host_test_h_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+
+/**
+ * Just enough of a test framework for the host tests - each test is a program that counts the checks that fail and
+ * returns non zero from main if there were any.
+ **/
+static int host_test_failures = 0;
+
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            host_test_failures++;                                                 \
+        }                                                                         \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tolerance)                                                                                        \
+    do                                                                                                                     \
+    {                                                                                                                      \
+        double _a = (a), _b = (b);                                                                                         \
+        if (!(_a - _b <= (tolerance) && _b - _a <= (tolerance)))                                                           \
+        {                                                                                                                  \
+            printf("%s:%d: check failed: %s = %g, %s = %g (tolerance %g)\n", __FILE__, __LINE__, #a, _a, #b, _b, (double)(tolerance)); \
+            host_test_failures++;                                                                                          \
+        }                                                                                                                  \
+    } while (0)
+
+// print the result at the end of main and return it
+static inline int host_test_result(const char *name)
+{
+    printf("%s: %s\n", name, host_test_failures == 0 ? "passed" : "FAILED");
+    return host_test_failures == 0 ? 0 : 1;
+}
+
+// wall clock time in microseconds for the benchmarks
+static inline int64_t host_time_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// a simple repeatable random number generator so the test data is the same every run
+static inline uint32_t host_random(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include "freertos/queue.h"
+#include "SimulatedI2S.h"
+
+struct SimulatedI2S
+{
+    std::mutex mutex;
+    std::condition_variable buffer_filled;
+    std::condition_variable buffer_emptied;
+    QueueHandle_t event_queue;
+    size_t buffer_size;
+    // the buffer the peripheral is filling and how much is in it
+    std::vector<uint8_t> filling;
+    // full buffers waiting to be read, and how much of the front one has been read so far
+    std::deque<std::vector<uint8_t>> full;
+    size_t read_offset;
+    size_t max_full;
+    const uint8_t *destination;
+    size_t destination_size;
+    SimulatedI2SStats stats;
+};
+
+// like the driver these are never freed once installed
+static SimulatedI2S *ports[I2S_NUM_MAX] = {NULL};
+
+esp_err_t i2s_driver_install(i2s_port_t i2s_num, const i2s_config_t *i2s_config, int queue_size, void *i2s_queue)
+{
+    SimulatedI2S *i2s = new SimulatedI2S();
+    // the ADC and the mono formats give one sample per frame
+    int channels = i2s_config->channel_format == I2S_CHANNEL_FMT_RIGHT_LEFT ? 2 : 1;
+    i2s->buffer_size = i2s_config->dma_buf_len * channels * i2s_config->bits_per_sample / 8;
+    i2s->max_full = i2s_config->dma_buf_count;
+    i2s->read_offset = 0;
+    i2s->destination = NULL;
+    i2s->destination_size = 0;
+    memset(&i2s->stats, 0, sizeof(i2s->stats));
+    i2s->event_queue = NULL;
+    if (i2s_queue)
+    {
+        i2s->event_queue = xQueueCreate(queue_size, sizeof(i2s_event_t));
+        *static_cast<QueueHandle_t *>(i2s_queue) = i2s->event_queue;
+    }
+    ports[i2s_num] = i2s;
+    return ESP_OK;
+}
+
+esp_err_t i2s_set_pin(i2s_port_t i2s_num, const i2s_pin_config_t *pin)
+{
+    return ports[i2s_num] ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t i2s_read(i2s_port_t i2s_num, void *dest, size_t size, size_t *bytes_read, TickType_t ticks_to_wait)
+{
+    SimulatedI2S *i2s = ports[i2s_num];
+    uint8_t *dst = static_cast<uint8_t *>(dest);
+    size_t read = 0;
+    std::unique_lock<std::mutex> lock(i2s->mutex);
+    while (read < size)
+    {
+        // like the real driver we give up if a DMA buffer doesn't fill in time and return what we've got
+        if (!i2s->buffer_filled.wait_for(lock, std::chrono::milliseconds(ticks_to_wait * portTICK_PERIOD_MS), [i2s]
+                                         { return !i2s->full.empty(); }))
+        {
+            break;
+        }
+        std::vector<uint8_t> &buffer = i2s->full.front();
+        size_t length = std::min(size - read, buffer.size() - i2s->read_offset);
+        memcpy(dst + read, buffer.data() + i2s->read_offset, length);
+        read += length;
+        i2s->read_offset += length;
+        if (i2s->read_offset == buffer.size())
+        {
+            i2s->full.pop_front();
+            i2s->read_offset = 0;
+            i2s->buffer_emptied.notify_all();
+        }
+    }
+    i2s->stats.reads++;
+    i2s->stats.bytes_read += read;
+    if (dst < i2s->destination || dst + read > i2s->destination + i2s->destination_size)
+    {
+        i2s->stats.bytes_read_elsewhere += read;
+    }
+    *bytes_read = read;
+    return ESP_OK;
+}
+
+void simulated_i2s_receive(i2s_port_t i2s_num, const void *data, size_t size, bool wait_for_reader)
+{
+    SimulatedI2S *i2s = ports[i2s_num];
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    while (size > 0)
+    {
+        size_t filled_buffers = 0;
+        {
+            std::unique_lock<std::mutex> lock(i2s->mutex);
+            size_t length = std::min(size, i2s->buffer_size - i2s->filling.size());
+            i2s->filling.insert(i2s->filling.end(), src, src + length);
+            src += length;
+            size -= length;
+            if (i2s->filling.size() == i2s->buffer_size)
+            {
+                if (wait_for_reader)
+                {
+                    i2s->buffer_emptied.wait(lock, [i2s]
+                                             { return i2s->full.size() < i2s->max_full; });
+                }
+                if (i2s->full.size() == i2s->max_full)
+                {
+                    // the reader is too slow - the DMA overwrites the oldest buffer
+                    i2s->stats.bytes_dropped += i2s->full.front().size() - i2s->read_offset;
+                    i2s->full.pop_front();
+                    i2s->read_offset = 0;
+                }
+                i2s->full.push_back(i2s->filling);
+                i2s->filling.clear();
+                filled_buffers++;
+            }
+        }
+        if (filled_buffers > 0)
+        {
+            i2s->buffer_filled.notify_all();
+            i2s_event_t event = {I2S_EVENT_RX_DONE, i2s->buffer_size};
+            if (i2s->event_queue)
+            {
+                xQueueSend(i2s->event_queue, &event, 0);
+            }
+        }
+    }
+}
+
+void simulated_i2s_set_destination(i2s_port_t i2s_num, const void *start, size_t size)
+{
+    std::lock_guard<std::mutex> lock(ports[i2s_num]->mutex);
+    ports[i2s_num]->destination = static_cast<const uint8_t *>(start);
+    ports[i2s_num]->destination_size = size;
+}
+
+SimulatedI2SStats simulated_i2s_get_stats(i2s_port_t i2s_num)
+{
+    std::lock_guard<std::mutex> lock(ports[i2s_num]->mutex);
+    return ports[i2s_num]->stats;
+}
+
+void simulated_i2s_reset_stats(i2s_port_t i2s_num)
+{
+    std::lock_guard<std::mutex> lock(ports[i2s_num]->mutex);
+    memset(&ports[i2s_num]->stats, 0, sizeof(SimulatedI2SStats));
+}
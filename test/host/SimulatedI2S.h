@@ -0,0 +1,39 @@
+#ifndef _simulated_i2s_h_
+#define _simulated_i2s_h_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "driver/i2s.h"
+
+/**
+ * The microphone side of the simulated I2S peripheral. The driver side is the normal i2s_driver_install and i2s_read.
+ *
+ * Received data goes into a queue of DMA buffers sized from the i2s_config_t. Each full buffer posts an
+ * I2S_EVENT_RX_DONE to the driver's event queue. i2s_read copies data out of the buffers the way the ESP-IDF driver
+ * does. If the reader falls behind, the oldest full buffer is dropped.
+ **/
+struct SimulatedI2SStats
+{
+    // the bytes i2s_read has copied out of the DMA buffers and how many calls it took
+    uint64_t bytes_read;
+    uint64_t reads;
+    // the bytes that were copied to somewhere other than the destination region - these have to be copied again
+    uint64_t bytes_read_elsewhere;
+    // bytes lost because every DMA buffer was full
+    uint64_t bytes_dropped;
+};
+
+/**
+ * Feed the peripheral raw data as if it had been clocked in from the microphone. If wait_for_reader is true and every
+ * DMA buffer is full, this waits for the reader to empty one instead of dropping the oldest.
+ **/
+void simulated_i2s_receive(i2s_port_t i2s_num, const void *data, size_t size, bool wait_for_reader = false);
+/**
+ * Reads that land in [start, start + size) are where the samples should end up (the ring buffer), so they count as
+ * direct. Reads anywhere else go through an intermediate buffer.
+ **/
+void simulated_i2s_set_destination(i2s_port_t i2s_num, const void *start, size_t size);
+SimulatedI2SStats simulated_i2s_get_stats(i2s_port_t i2s_num);
+void simulated_i2s_reset_stats(i2s_port_t i2s_num);
+
+#endif
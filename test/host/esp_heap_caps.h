@@ -0,0 +1,20 @@
+#ifndef _host_esp_heap_caps_h_
+#define _host_esp_heap_caps_h_
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+
+// the host doesn't have any PSRAM so anything that asks for it falls back to the normal heap
+static inline void *heap_caps_malloc(size_t size, unsigned int caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : malloc(size);
+}
+static inline size_t heap_caps_get_largest_free_block(unsigned int caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? 0 : (size_t)1 << 30;
+}
+
+#endif
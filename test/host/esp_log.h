@@ -0,0 +1,10 @@
+#ifndef _host_esp_log_h_
+#define _host_esp_log_h_
+
+#include <stdio.h>
+
+#define ESP_LOGI(tag, format, ...) printf("I (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) printf("W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGE(tag, format, ...) printf("E (%s) " format "\n", tag, ##__VA_ARGS__)
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef _host_esp_timer_h_
+#define _host_esp_timer_h_
+
+#include <stdint.h>
+#include <chrono>
+
+static inline int64_t esp_timer_get_time()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif
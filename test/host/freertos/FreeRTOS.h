@@ -0,0 +1,21 @@
+#ifndef _host_freertos_h_
+#define _host_freertos_h_
+
+// Just enough of FreeRTOS to run the samplers on the host - tasks are threads and queues are a mutex and a condition
+// variable (see HostFreeRTOS.cpp). A tick is a millisecond.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY ((TickType_t)0xffffffff)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#endif